@@ -0,0 +1,21 @@
+#ifndef BENCHMARKS_BENCH_COMMON_HPP
+#define BENCHMARKS_BENCH_COMMON_HPP
+
+#include <benchmark/benchmark.h>
+
+#include "null_spi.hpp"
+
+namespace tmcxx::bench {
+
+/**
+ * @brief Report SPI transfers per iteration next to ns/op.
+ */
+inline void report_transfers(benchmark::State& state, const NullSpi& spi)
+{
+    state.counters["transfers/op"] =
+        benchmark::Counter{static_cast<double>(spi.transfers()), benchmark::Counter::kAvgIterations};
+}
+
+} // namespace tmcxx::bench
+
+#endif // BENCHMARKS_BENCH_COMMON_HPP
@@ -0,0 +1,139 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_common.hpp"
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/core_communicator.hpp"
+#include "tmcxx/features/spi_transport.hpp"
+
+namespace tmcxx::bench {
+
+namespace regs = chip::tmc5160;
+
+using communicator_t = features::CoreCommunicator<NullSpi>;
+
+static void BM_Write(benchmark::State& state)
+{
+    NullSpi spi{};
+    communicator_t comm{spi};
+    uint32_t value{};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(comm.write<regs::VMAX>(++value));
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_Write);
+
+static void BM_WriteField(benchmark::State& state)
+{
+    NullSpi spi{};
+    communicator_t comm{spi};
+    uint32_t value{};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(comm.write_field<regs::CHOPCONF::toff_t>(++value & 0x0FU));
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_WriteField);
+
+static void BM_ReadCached(benchmark::State& state)
+{
+    NullSpi spi{};
+    communicator_t comm{spi};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(comm.read<regs::CHOPCONF>());
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_ReadCached);
+
+static void BM_ReadHardware(benchmark::State& state)
+{
+    NullSpi spi{};
+    communicator_t comm{spi};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(comm.read<regs::XACTUAL>());
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_ReadHardware);
+
+static void BM_ReadManyFour(benchmark::State& state)
+{
+    NullSpi spi{};
+    communicator_t comm{spi};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(comm.read_many<regs::XACTUAL, regs::VACTUAL, regs::DRV_STATUS, regs::GSTAT>());
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_ReadManyFour);
+
+static void BM_CommitTransaction(benchmark::State& state)
+{
+    NullSpi spi{};
+    communicator_t comm{spi};
+    uint32_t value{};
+
+    for (auto _: state)
+    {
+        comm.begin_transaction();
+        benchmark::DoNotOptimize(comm.write_field<regs::IHOLD_IRUN::i_run_t>(++value & 0x1FU));
+        benchmark::DoNotOptimize(comm.write_field<regs::IHOLD_IRUN::i_hold_t>(value & 0x0FU));
+        benchmark::DoNotOptimize(comm.write_field<regs::IHOLD_IRUN::i_hold_delay_t>(6U));
+        benchmark::DoNotOptimize(comm.commit());
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_CommitTransaction);
+
+// Thin-template mode: the same accesses through features::SpiTransport (one indirect call per transfer).
+
+static void BM_WriteThin(benchmark::State& state)
+{
+    NullSpi spi{};
+    features::SpiTransport transport{spi};
+    features::CoreCommunicator<features::SpiTransport> comm{transport};
+    uint32_t value{};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(comm.write<regs::VMAX>(++value));
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_WriteThin);
+
+static void BM_ReadManyFourThin(benchmark::State& state)
+{
+    NullSpi spi{};
+    features::SpiTransport transport{spi};
+    features::CoreCommunicator<features::SpiTransport> comm{transport};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(comm.read_many<regs::XACTUAL, regs::VACTUAL, regs::DRV_STATUS, regs::GSTAT>());
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_ReadManyFourThin);
+
+} // namespace tmcxx::bench
@@ -0,0 +1,90 @@
+#include <benchmark/benchmark.h>
+
+#include "tmcxx/features/converter.hpp"
+#include "tmcxx/features/fixed_point_converter.hpp"
+
+namespace tmcxx::bench {
+
+using namespace units::literals;
+
+template<typename TConverter>
+[[nodiscard]] TConverter make_converter()
+{
+    return TConverter{12.0_MHz, units::microsteps_t{200}, 75.0_mOhm};
+}
+
+template<typename TConverter>
+static void BM_RpmToVmax(benchmark::State& state)
+{
+    const auto converter{make_converter<TConverter>()};
+    float rpm{0.0f};
+
+    for (auto _: state)
+    {
+        rpm += 0.25f;
+        benchmark::DoNotOptimize(converter.rpm_to_vmax(units::rpm_t{rpm}));
+    }
+}
+BENCHMARK(BM_RpmToVmax<features::Converter>);
+BENCHMARK(BM_RpmToVmax<features::FixedPointConverter>);
+
+template<typename TConverter>
+static void BM_VmaxToRpm(benchmark::State& state)
+{
+    const auto converter{make_converter<TConverter>()};
+    uint32_t vmax{};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(converter.vmax_to_rpm(vmax += 97U));
+    }
+}
+BENCHMARK(BM_VmaxToRpm<features::Converter>);
+BENCHMARK(BM_VmaxToRpm<features::FixedPointConverter>);
+
+template<typename TConverter>
+static void BM_CurrentToCs(benchmark::State& state)
+{
+    const auto converter{make_converter<TConverter>()};
+    float amps{0.0f};
+
+    for (auto _: state)
+    {
+        amps = (amps > 3.0f) ? 0.0f : amps + 0.01f;
+        benchmark::DoNotOptimize(converter.current_to_cs(units::current_t{amps}));
+    }
+}
+BENCHMARK(BM_CurrentToCs<features::Converter>);
+BENCHMARK(BM_CurrentToCs<features::FixedPointConverter>);
+
+template<typename TConverter>
+static void BM_AccelToRegister(benchmark::State& state)
+{
+    const auto converter{make_converter<TConverter>()};
+    float accel{0.0f};
+
+    for (auto _: state)
+    {
+        accel += 3.0f;
+        benchmark::DoNotOptimize(converter.accel_to_register(units::acceleration_t{accel}));
+    }
+}
+BENCHMARK(BM_AccelToRegister<features::Converter>);
+BENCHMARK(BM_AccelToRegister<features::FixedPointConverter>);
+
+template<typename TConverter>
+static void BM_DurationToTzerowait(benchmark::State& state)
+{
+    const auto converter{make_converter<TConverter>()};
+    float seconds{0.0f};
+
+    for (auto _: state)
+    {
+        seconds = (seconds > 2.0f) ? 0.0f : seconds + 0.001f;
+        benchmark::DoNotOptimize(converter.duration_to_tzerowait(units::time_duration_t{seconds}));
+    }
+}
+BENCHMARK(BM_DurationToTzerowait<features::Converter>);
+BENCHMARK(BM_DurationToTzerowait<features::FixedPointConverter>);
+
+} // namespace tmcxx::bench
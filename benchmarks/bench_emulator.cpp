@@ -0,0 +1,98 @@
+#include <benchmark/benchmark.h>
+
+#include "mocks/tmc5160_emulator.hpp"
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/command_mailbox.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+#include <chrono>
+
+namespace tmcxx::bench {
+
+using namespace units::literals;
+namespace regs = chip::tmc5160;
+using test::TMC5160Emulator;
+
+using driver_t = TMC5160<TMC5160Emulator>;
+
+/**
+ * @brief Report datagrams and simulated bus time per iteration next to ns/op.
+ */
+static void report_chip(benchmark::State& state, const TMC5160Emulator& chip)
+{
+    state.counters["datagrams/op"] =
+        benchmark::Counter{static_cast<double>(chip.datagrams()), benchmark::Counter::kAvgIterations};
+    state.counters["bus_us/op"] = benchmark::Counter{
+        std::chrono::duration<double, std::micro>{chip.now()}.count(), benchmark::Counter::kAvgIterations};
+}
+
+/**
+ * @brief Mailbox post to the VMAX/XTARGET datagrams landing in the chip; arg = wire latency per datagram in ns.
+ */
+static void BM_MailboxMoveLatency(benchmark::State& state)
+{
+    const std::chrono::nanoseconds latency{state.range(0)};
+
+    TMC5160Emulator chip{};
+    chip.set_datagram_time(latency);
+    chip.set_blocking_latency(latency);
+
+    driver_t axis{chip, {}};
+    features::CommandMailbox mailbox{axis};
+    int32_t target{};
+
+    for (auto _: state)
+    {
+        mailbox.post(features::MotionSegment{
+            .mode = regs::RampModeType::POSITIONING, .vmax = 100'000U, .target = ++target});
+        benchmark::DoNotOptimize(mailbox.drain());
+    }
+
+    report_chip(state, chip);
+}
+BENCHMARK(BM_MailboxMoveLatency)->Arg(0)->Arg(1'000)->Arg(10'000);
+
+/**
+ * @brief Status poll of a moving axis; arg = wire latency per datagram in ns.
+ */
+static void BM_MotionSnapshotLatency(benchmark::State& state)
+{
+    const std::chrono::nanoseconds latency{state.range(0)};
+
+    TMC5160Emulator chip{};
+    chip.set_datagram_time(latency);
+    chip.set_blocking_latency(latency);
+
+    driver_t axis{chip, {}};
+    (void)axis.write_register<regs::AMAX>(1'000U);
+    (void)axis.rotate(60_rpm);
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(axis.get_motion_snapshot());
+    }
+
+    report_chip(state, chip);
+}
+BENCHMARK(BM_MotionSnapshotLatency)->Arg(0)->Arg(1'000)->Arg(10'000);
+
+/**
+ * @brief Ramp generator cost of one simulated millisecond per virtual axis.
+ */
+static void BM_EmulatorAdvance(benchmark::State& state)
+{
+    TMC5160Emulator chip{};
+    driver_t axis{chip, {}};
+    (void)axis.write_register<regs::AMAX>(1'000U);
+    (void)axis.rotate(60_rpm);
+
+    for (auto _: state)
+    {
+        chip.advance(std::chrono::milliseconds{1});
+        benchmark::DoNotOptimize(chip.position());
+    }
+}
+BENCHMARK(BM_EmulatorAdvance);
+
+} // namespace tmcxx::bench
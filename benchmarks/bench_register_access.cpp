@@ -0,0 +1,122 @@
+#include <benchmark/benchmark.h>
+
+#include "bench_common.hpp"
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/detail/tmc5160_bus.hpp"
+#include "tmcxx/detail/tmc5160_register_access.hpp"
+
+#include <array>
+
+namespace tmcxx::bench {
+
+using bus_t = detail::TMC5160Bus<NullSpi>;
+using access_t = detail::TMC5160RegisterAccess<bus_t>;
+using chip::tmc5160::RegAddress;
+
+/**
+ * @brief Mixed set of cached, volatile and read-only addresses for the runtime lookup tables.
+ */
+constexpr std::array<RegAddress, 6> lookup_addresses{
+    RegAddress::GCONF, RegAddress::XACTUAL, RegAddress::VMAX, RegAddress::CHOPCONF, RegAddress::DRV_STATUS,
+    RegAddress::GSTAT};
+
+static void BM_GetAllRegisters(benchmark::State& state)
+{
+    NullSpi spi{};
+    bus_t bus{spi};
+    access_t access{bus};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(access.get_all_registers());
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_GetAllRegisters);
+
+static void BM_SnapshotMotionMask(benchmark::State& state)
+{
+    constexpr features::RegisterMask mask{RegAddress::XACTUAL, RegAddress::VACTUAL, RegAddress::DRV_STATUS,
+        RegAddress::VMAX};
+
+    NullSpi spi{};
+    bus_t bus{spi};
+    access_t access{bus};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(access.snapshot<mask>());
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_SnapshotMotionMask);
+
+static void BM_SnapshotRuntimeMask(benchmark::State& state)
+{
+    const features::RegisterMask mask{RegAddress::XACTUAL, RegAddress::VACTUAL, RegAddress::DRV_STATUS,
+        RegAddress::VMAX};
+
+    NullSpi spi{};
+    bus_t bus{spi};
+    access_t access{bus};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(access.snapshot(mask));
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_SnapshotRuntimeMask);
+
+static void BM_GetRegisterValueLookup(benchmark::State& state)
+{
+    NullSpi spi{};
+    bus_t bus{spi};
+    access_t access{bus};
+    std::size_t idx{};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(access.get_register_value(lookup_addresses[idx++ % lookup_addresses.size()]));
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_GetRegisterValueLookup);
+
+static void BM_SetRegisterValueLookup(benchmark::State& state)
+{
+    NullSpi spi{};
+    bus_t bus{spi};
+    access_t access{bus};
+    uint32_t value{};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(access.set_register_value(RegAddress::VMAX, ++value));
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_SetRegisterValueLookup);
+
+static void BM_GetRegisterValueInvalid(benchmark::State& state)
+{
+    NullSpi spi{};
+    bus_t bus{spi};
+    access_t access{bus};
+
+    for (auto _: state)
+    {
+        benchmark::DoNotOptimize(access.get_register_value(RegAddress::MSCNT));
+    }
+
+    report_transfers(state, spi);
+}
+BENCHMARK(BM_GetRegisterValueInvalid);
+
+} // namespace tmcxx::bench
@@ -0,0 +1,51 @@
+#ifndef BENCHMARKS_NULL_SPI_HPP
+#define BENCHMARKS_NULL_SPI_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace tmcxx::bench {
+
+/**
+ * @brief Zero-latency SPI device: no allocation, no logging, only a transfer counter.
+ *
+ * Every reply carries the same canned 40-bit datagram, which is enough to exercise the decode paths.
+ */
+class NullSpi {
+  public:
+    bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, [[maybe_unused]] uint32_t timeout_ms)
+    {
+        ++m_transfers;
+        std::copy_n(m_reply.begin(), std::min(rx_data.size(), m_reply.size()), rx_data.begin());
+        return true;
+    }
+
+    void select() noexcept
+    {
+    }
+
+    void deselect() noexcept
+    {
+    }
+
+    [[nodiscard]] std::size_t transfers() const noexcept
+    {
+        return m_transfers;
+    }
+
+    void reset() noexcept
+    {
+        m_transfers = 0U;
+    }
+
+  private:
+    std::array<uint8_t, 5> m_reply{0x00U, 0x12U, 0x34U, 0x56U, 0x78U};
+    std::size_t m_transfers{};
+};
+
+} // namespace tmcxx::bench
+
+#endif // BENCHMARKS_NULL_SPI_HPP
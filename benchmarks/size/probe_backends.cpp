@@ -0,0 +1,34 @@
+// Code-size probe: the full TMC5160 driver on three SPI backend types, one instantiation each.
+
+#include "probe_spi.hpp"
+
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::bench {
+
+using namespace units::literals;
+
+namespace {
+
+template<typename TSpi>
+bool run_axis(TSpi& spi, int32_t target)
+{
+    typename TMC5160<TSpi>::Settings settings{};
+    settings.run_current = 1.0_A;
+    settings.hold_current = 0.5_A;
+    settings.v_max = 120.0_rpm;
+
+    TMC5160<TSpi> motor{spi, settings};
+
+    return motor.apply_settings().has_value() && motor.move_to(units::microsteps_t{target}, 60.0_rpm).has_value() &&
+           motor.get_actual_motor_position().has_value() && motor.stop().has_value();
+}
+
+} // namespace
+
+bool probe_backends(ProbeBackend<0>& spi1, ProbeBackend<1>& spi2, ProbeBackend<2>& spi3, int32_t target)
+{
+    return run_axis(spi1, target) && run_axis(spi2, target) && run_axis(spi3, target);
+}
+
+} // namespace tmcxx::bench
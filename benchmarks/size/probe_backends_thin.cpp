@@ -0,0 +1,37 @@
+// Code-size probe: probe_backends.cpp in thin-template mode, one ThinTMC5160 shared by the three backends.
+
+#include "probe_spi.hpp"
+
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::bench {
+
+using namespace units::literals;
+
+namespace {
+
+bool run_axis(features::SpiTransport& spi, int32_t target)
+{
+    ThinTMC5160<>::Settings settings{};
+    settings.run_current = 1.0_A;
+    settings.hold_current = 0.5_A;
+    settings.v_max = 120.0_rpm;
+
+    ThinTMC5160<> motor{spi, settings};
+
+    return motor.apply_settings().has_value() && motor.move_to(units::microsteps_t{target}, 60.0_rpm).has_value() &&
+           motor.get_actual_motor_position().has_value() && motor.stop().has_value();
+}
+
+} // namespace
+
+bool probe_backends_thin(ProbeBackend<0>& spi1, ProbeBackend<1>& spi2, ProbeBackend<2>& spi3, int32_t target)
+{
+    features::SpiTransport transport1{spi1};
+    features::SpiTransport transport2{spi2};
+    features::SpiTransport transport3{spi3};
+
+    return run_axis(transport1, target) && run_axis(transport2, target) && run_axis(transport3, target);
+}
+
+} // namespace tmcxx::bench
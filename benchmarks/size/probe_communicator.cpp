@@ -0,0 +1,20 @@
+// Code-size probe: CoreCommunicator write / write_field / read only.
+
+#include "probe_spi.hpp"
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/core_communicator.hpp"
+
+namespace tmcxx::bench {
+
+namespace regs = chip::tmc5160;
+
+bool probe_communicator(ProbeSpi& spi, uint32_t value)
+{
+    features::CoreCommunicator<ProbeSpi> comm{spi};
+
+    return comm.write<regs::VMAX>(value).has_value() && comm.write_field<regs::CHOPCONF::toff_t>(3U).has_value() &&
+           comm.read<regs::XACTUAL>().has_value();
+}
+
+} // namespace tmcxx::bench
@@ -0,0 +1,24 @@
+// Code-size probe: typical firmware use of the full TMC5160 driver.
+
+#include "probe_spi.hpp"
+
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::bench {
+
+using namespace units::literals;
+
+bool probe_driver(ProbeSpi& spi, int32_t target)
+{
+    TMC5160<ProbeSpi>::Settings settings{};
+    settings.run_current = 1.0_A;
+    settings.hold_current = 0.5_A;
+    settings.v_max = 120.0_rpm;
+
+    TMC5160<ProbeSpi> motor{spi, settings};
+
+    return motor.apply_settings().has_value() && motor.move_to(units::microsteps_t{target}, 60.0_rpm).has_value() &&
+           motor.get_actual_motor_position().has_value() && motor.stop().has_value();
+}
+
+} // namespace tmcxx::bench
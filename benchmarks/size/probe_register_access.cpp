@@ -0,0 +1,19 @@
+// Code-size probe: runtime register lookup tables and get_all_registers().
+
+#include "probe_spi.hpp"
+
+#include "tmcxx/detail/tmc5160_bus.hpp"
+#include "tmcxx/detail/tmc5160_register_access.hpp"
+
+namespace tmcxx::bench {
+
+bool probe_register_access(ProbeSpi& spi, chip::tmc5160::RegAddress address, uint32_t value)
+{
+    detail::TMC5160Bus<ProbeSpi> bus{spi};
+    detail::TMC5160RegisterAccess<detail::TMC5160Bus<ProbeSpi>> access{bus};
+
+    return access.set_register_value(address, value).has_value() &&
+           access.get_register_value(address).has_value() && access.get_all_registers().has_value();
+}
+
+} // namespace tmcxx::bench
@@ -0,0 +1,45 @@
+#ifndef BENCHMARKS_SIZE_PROBE_SPI_HPP
+#define BENCHMARKS_SIZE_PROBE_SPI_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace tmcxx::bench {
+
+/**
+ * @brief Opaque HAL hooks: declared only, so the probes are compiled as a real firmware would see them.
+ */
+bool probe_spi_transfer(const uint8_t* tx_data, uint8_t* rx_data, std::size_t size, uint32_t timeout_ms);
+void probe_spi_select();
+void probe_spi_deselect();
+
+struct ProbeSpi
+{
+    bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, uint32_t timeout_ms)
+    {
+        return probe_spi_transfer(tx_data.data(), rx_data.data(), tx_data.size(), timeout_ms);
+    }
+
+    void select()
+    {
+        probe_spi_select();
+    }
+
+    void deselect()
+    {
+        probe_spi_deselect();
+    }
+};
+
+/**
+ * @brief Distinct SPI backend types (e.g. SPI1 DMA, SPI2 polled, bit-banged), for the per-backend template cost.
+ */
+template<std::size_t Bus>
+struct ProbeBackend : ProbeSpi
+{
+};
+
+} // namespace tmcxx::bench
+
+#endif // BENCHMARKS_SIZE_PROBE_SPI_HPP
@@ -0,0 +1,31 @@
+# Script mode (cmake -P): print text/data/bss of the size probe objects and store them next to the build.
+#
+# Inputs: SIZE_TOOL, OBJECTS ('|' separated), CONFIG_NAME, COMPILER, OUTPUT
+
+if (NOT SIZE_TOOL)
+    message(WARNING "TMCxx size report: no 'size' tool found for this toolchain, report skipped")
+    return()
+endif ()
+
+string(REPLACE "|" ";" OBJECT_LIST "${OBJECTS}")
+list(SORT OBJECT_LIST)
+
+execute_process(
+        COMMAND "${SIZE_TOOL}" ${OBJECT_LIST}
+        OUTPUT_VARIABLE SIZE_OUTPUT
+        ERROR_VARIABLE SIZE_ERROR
+        RESULT_VARIABLE SIZE_RESULT
+)
+
+if (NOT SIZE_RESULT EQUAL 0)
+    message(FATAL_ERROR "TMCxx size report: ${SIZE_TOOL} failed: ${SIZE_ERROR}")
+endif ()
+
+# Keep only the object file names, build directories differ per preset.
+string(REGEX REPLACE "[^\n\t ]*/([^/\n]+\\.o(bj)?)" "\\1" SIZE_OUTPUT "${SIZE_OUTPUT}")
+
+set(REPORT "TMCxx code size\nconfiguration: ${CONFIG_NAME}\ncompiler: ${COMPILER}\n\n${SIZE_OUTPUT}")
+
+file(WRITE "${OUTPUT}" "${REPORT}")
+message(STATUS "\n${REPORT}")
+message(STATUS "Size report written to ${OUTPUT}")
@@ -0,0 +1,211 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : spi_driver
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_ADAPTERS_SPIDEV_SPI_DRIVER_HPP
+#define TMCXX_ADAPTERS_SPIDEV_SPI_DRIVER_HPP
+
+#include "tmcxx/helpers/error.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+#include <fcntl.h>
+#include <linux/spi/spidev.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+namespace tmcxx::adapters::spidev {
+
+/**
+ * @brief Linux spidev device (/dev/spidevB.C) satisfying SpiDevice and BatchSpiDevice.
+ *
+ * The kernel drives the chip select of the device node. transfer_frames() sends up to max_frames_per_message
+ * datagrams per SPI_IOC_MESSAGE ioctl, with cs_change set between them, so a pipelined burst or a commit() costs
+ * one syscall instead of one per 5-byte datagram. spidev has no per-transfer timeout; timeout_ms is ignored.
+ *
+ * @code
+ * adapters::spidev::SpiDriver spi{};
+ * if (!spi.open("/dev/spidev0.0")) { ... }
+ * TMC5160<adapters::spidev::SpiDriver> driver{spi, settings};
+ * @endcode
+ */
+class SpiDriver {
+  public:
+    /**
+     * @brief SCK frequency; the TMC5160 accepts up to 4 MHz with its internal clock.
+     */
+    static constexpr uint32_t default_speed_hz{4'000'000U};
+
+    /**
+     * @brief The TMC5160 samples on the rising edge with SCK idle high (Datasheet 4.1).
+     */
+    static constexpr uint8_t default_mode{SPI_MODE_3};
+
+    static constexpr std::size_t max_frames_per_message{32U};
+
+    SpiDriver() = default;
+
+    SpiDriver(const SpiDriver&) = delete;
+    SpiDriver& operator=(const SpiDriver&) = delete;
+
+    ~SpiDriver()
+    {
+        close();
+    }
+
+    /**
+     * @brief Open and configure a spidev node.
+     *
+     * @param path Device node, e.g. "/dev/spidev0.0".
+     * @param speed_hz SCK frequency.
+     * @param mode SPI mode (SPI_MODE_0..3).
+     * @return Result<void>: SPI_TRANSFER_FAILED if the node cannot be opened, INVALID_PARAMETER if the controller
+     * rejects the configuration.
+     */
+    [[nodiscard]] helpers::result_t<void> open(
+        const char* path, uint32_t speed_hz = default_speed_hz, uint8_t mode = default_mode) noexcept
+    {
+        close();
+
+        m_fd = ::open(path, O_RDWR | O_CLOEXEC);
+        if (m_fd < 0) [[unlikely]]
+        {
+            return tl::make_unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+        }
+
+        uint8_t bits_per_word{bits_per_byte};
+        if (::ioctl(m_fd, SPI_IOC_WR_MODE, &mode) < 0 || ::ioctl(m_fd, SPI_IOC_WR_BITS_PER_WORD, &bits_per_word) < 0 ||
+            ::ioctl(m_fd, SPI_IOC_WR_MAX_SPEED_HZ, &speed_hz) < 0) [[unlikely]]
+        {
+            close();
+            return tl::make_unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        m_speed_hz = speed_hz;
+        return {};
+    }
+
+    void close() noexcept
+    {
+        if (m_fd >= 0)
+        {
+            ::close(m_fd);
+            m_fd = -1;
+        }
+    }
+
+    [[nodiscard]] bool is_open() const noexcept
+    {
+        return m_fd >= 0;
+    }
+
+    bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, uint32_t timeout_ms)
+    {
+        return transfer_frames(tx_data, rx_data, tx_data.size(), timeout_ms);
+    }
+
+    void select() noexcept
+    {
+    }
+
+    void deselect() noexcept
+    {
+    }
+
+    /**
+     * @brief Send tx_data as consecutive frames of @p frame_size bytes, each framed by its own chip select pulse.
+     *
+     * @return False if the device is closed, the spans do not split into whole frames, or an ioctl failed.
+     */
+    bool transfer_frames(std::span<const uint8_t> tx_data,
+        std::span<uint8_t> rx_data,
+        std::size_t frame_size,
+        [[maybe_unused]] uint32_t timeout_ms)
+    {
+        if (!is_open() || 0U == frame_size || tx_data.size() != rx_data.size() || tx_data.size() % frame_size != 0U)
+            [[unlikely]]
+        {
+            return false;
+        }
+
+        for (std::size_t first{}; first < tx_data.size() / frame_size; first += max_frames_per_message)
+        {
+            const std::size_t count{build_message(tx_data, rx_data, frame_size, first, m_speed_hz, m_messages)};
+
+            if (::ioctl(m_fd, message_request(count), m_messages.data()) != static_cast<int>(count * frame_size))
+                [[unlikely]]
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Fill the transfers of one SPI_IOC_MESSAGE: frames [first, first + max_frames_per_message) of a burst.
+     *
+     * Each frame gets its own transfer; cs_change is set on all but the last, so the chip select is released
+     * between datagrams. No syscall is made.
+     *
+     * @param tx_data Whole burst, a multiple of @p frame_size bytes.
+     * @param rx_data Receive buffer, same size as @p tx_data.
+     * @param frame_size Bytes per frame (non-zero).
+     * @param first Index of the first frame of this message.
+     * @param speed_hz SCK frequency of every transfer.
+     * @param messages Destination.
+     * @return Transfers filled, 0 if @p first is past the last frame.
+     */
+    [[nodiscard]] static std::size_t build_message(std::span<const uint8_t> tx_data,
+        std::span<uint8_t> rx_data,
+        std::size_t frame_size,
+        std::size_t first,
+        uint32_t speed_hz,
+        std::span<spi_ioc_transfer, max_frames_per_message> messages) noexcept
+    {
+        const std::size_t frames{tx_data.size() / frame_size};
+        const std::size_t count{(first < frames) ? std::min(max_frames_per_message, frames - first) : 0U};
+
+        for (std::size_t idx{}; idx < count; ++idx)
+        {
+            const std::size_t offset{(first + idx) * frame_size};
+
+            messages[idx] = spi_ioc_transfer{};
+            messages[idx].tx_buf = reinterpret_cast<std::uintptr_t>(tx_data.data() + offset);
+            messages[idx].rx_buf = reinterpret_cast<std::uintptr_t>(rx_data.data() + offset);
+            messages[idx].len = static_cast<uint32_t>(frame_size);
+            messages[idx].speed_hz = speed_hz;
+            messages[idx].bits_per_word = bits_per_byte;
+            // Release the chip select between datagrams; the last one releases it anyway.
+            messages[idx].cs_change = (idx + 1U < count) ? 1U : 0U;
+        }
+
+        return count;
+    }
+
+    /**
+     * @brief SPI_IOC_MESSAGE(count) without the variable length array the macro expands to for runtime counts.
+     */
+    [[nodiscard]] static unsigned long message_request(std::size_t count) noexcept
+    {
+        return _IOC(_IOC_WRITE, SPI_IOC_MAGIC, 0U, count * sizeof(spi_ioc_transfer));
+    }
+
+  private:
+    static constexpr uint8_t bits_per_byte{8U};
+
+    int m_fd{-1};
+    uint32_t m_speed_hz{default_speed_hz};
+    std::array<spi_ioc_transfer, max_frames_per_message> m_messages{};
+};
+
+} // namespace tmcxx::adapters::spidev
+
+#endif // TMCXX_ADAPTERS_SPIDEV_SPI_DRIVER_HPP
@@ -9,8 +9,10 @@
 #define TMCXX_CORE_CONCEPTS_HPP
 
 #include "register_base.hpp"
+#include "tmcxx/helpers/units.hpp"
 
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <span>
 
@@ -60,6 +62,51 @@ concept SpiDevice =
         { device.deselect() } -> std::same_as<void>;
     };
 
+/**
+ * @brief SPI device that sends several datagrams with one call (e.g. one SPI_IOC_MESSAGE ioctl).
+ *
+ * transfer_frames() shifts tx_data out as consecutive frames of frame_size bytes, each framed by its own chip
+ * select pulse driven by the device, and fills rx_data (same size) with the replies. False means the batch failed
+ * as a whole.
+ *
+ * @tparam T SPI Class.
+ */
+template<typename T>
+concept BatchSpiDevice = SpiDevice<T> && requires(T device,
+                                             std::span<const uint8_t> tx_data,
+                                             std::span<uint8_t> rx_data,
+                                             std::size_t frame_size,
+                                             uint32_t timeout_ms) {
+    { device.transfer_frames(tx_data, rx_data, frame_size, timeout_ms) } -> std::same_as<bool>;
+};
+
+/**
+ * @brief Completion callback of an asynchronous SPI transfer.
+ *
+ * Called once per submitted transfer, typically from the DMA/SPI interrupt.
+ * @param context Opaque pointer given at submission.
+ * @param success True if the transfer completed without error.
+ */
+using spi_completion_t = void (*)(void* context, bool success);
+
+/**
+ * @brief Asynchronous (DMA capable) SPI Device Concept.
+ *
+ * transfer_async() starts a transfer and returns immediately; false means the transfer could not be submitted.
+ * The tx/rx buffers stay valid until the completion callback is invoked. Chip select stays under the caller's
+ * control through select()/deselect().
+ *
+ * @tparam T SPI Class.
+ */
+template<typename T>
+concept AsyncSpiDevice = SpiDevice<T> && requires(T device,
+                                             std::span<const uint8_t> tx_data,
+                                             std::span<uint8_t> rx_data,
+                                             spi_completion_t on_complete,
+                                             void* context) {
+    { device.transfer_async(tx_data, rx_data, on_complete, context) } -> std::same_as<bool>;
+};
+
 /**
  * @brief Concept for writable registers (WO or RW).
  */
@@ -72,6 +119,24 @@ concept WritableRegister = Register<T> && (T::access != Access::RO);
 template<typename T>
 concept VolatileRegister = Register<T> && std::is_same_v<typename T::type_t, Volatile>;
 
+/**
+ * @brief Concept for trigger registers (writing starts an action).
+ */
+template<typename T>
+concept TriggerRegister = Register<T> && std::is_same_v<typename T::type_t, Trigger>;
+
+/**
+ * @brief Concept for registers whose shadow value can be replayed after a chip reset.
+ */
+template<typename T>
+concept RestorableRegister = WritableRegister<T> && !VolatileRegister<T> && !TriggerRegister<T>;
+
+/**
+ * @brief Concept for registers that must be fetched from the chip (volatile or RO) instead of the shadow copy.
+ */
+template<typename T>
+concept HardwareReadRegister = Register<T> && (VolatileRegister<T> || T::access == Access::RO);
+
 /**
  * @brief Concept for readable registers (RO or RW).
  */
@@ -91,6 +156,25 @@ concept WritableField = Field<T> && WritableRegister<typename T::register_t>;
  */
 template<typename T>
 concept ReadableField = Field<T> && ReadableRegister<typename T::register_t>;
+
+/**
+ * @brief Concept for unit converters (physical units <-> register values).
+ *
+ * Satisfied by features::Converter and features::FixedPointConverter.
+ */
+template<typename T>
+concept UnitConverter = requires(const T& converter,
+    units::rpm_t rpm,
+    units::current_t current,
+    units::acceleration_t accel,
+    units::time_duration_t duration,
+    uint32_t raw) {
+    { converter.rpm_to_vmax(rpm) } -> std::same_as<uint32_t>;
+    { converter.vmax_to_rpm(raw) } -> std::same_as<units::rpm_t>;
+    { converter.current_to_cs(current) } -> std::same_as<uint8_t>;
+    { converter.accel_to_register(accel) } -> std::same_as<uint32_t>;
+    { converter.duration_to_tzerowait(duration) } -> std::same_as<uint32_t>;
+};
 } // namespace tmcxx::core::concepts
 
 #endif // TMCXX_CORE_CONCEPTS_HPP
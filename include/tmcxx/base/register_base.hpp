@@ -92,6 +92,15 @@ struct Volatile
 {
 };
 
+/**
+ * @brief Marker type for registers whose write starts an action (e.g. XTARGET starts a move).
+ *
+ * They are shadowed like any other register, but never replayed by a shadow restore.
+ */
+struct Trigger
+{
+};
+
 } // namespace tmcxx::core
 
 #endif // TMCXX_CORE_REGISTER_BASE_HPP
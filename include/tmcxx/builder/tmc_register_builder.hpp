@@ -234,6 +234,36 @@ class TMC5160Builder {
         return m_config;
     }
 
+    /**
+     * @brief Precompute the motion and current registers of the configuration for TMC5160::apply_profile().
+     *
+     * @code
+     * const auto precision{TMC5160Builder{spi, settings}.v_max(60_rpm).run_current(0.8_A).build_profile()};
+     * (void)motor.apply_profile(precision);
+     * @endcode
+     *
+     * @return Profile with the final register words.
+     */
+    [[nodiscard]] constexpr features::Profile build_profile() const noexcept
+    {
+        return features::compute_profile(m_config);
+    }
+
+    /**
+     * @brief Serialize the final register words of the configuration as a binary image for flash or a file.
+     *
+     * @code
+     * const auto blob{TMC5160Builder{spi}.run_current(1.5_A).v_max(300_rpm).build_image()};
+     * // at boot: motor.apply_image(*features::RegisterImageView::parse(blob));
+     * @endcode
+     *
+     * @return Image bytes (see features::RegisterImageView).
+     */
+    [[nodiscard]] constexpr auto build_image() const noexcept
+    {
+        return features::encode_register_image(features::compute_register_image(m_config));
+    }
+
     /**
      * @brief Build and return a configured TMC5160 instance.
      *
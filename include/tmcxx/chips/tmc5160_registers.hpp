@@ -10,7 +10,10 @@
 
 #include "tmcxx/base/concepts.hpp"
 #include "tmcxx/base/register_base.hpp"
+#include "tmcxx/helpers/constants.hpp"
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <tuple>
 #include <type_traits>
@@ -24,7 +27,7 @@ enum class RegAddress : uint8_t {
     // --- General Configuration Registers ---
     GCONF = 0x00U,         // Global Configuration
     GSTAT = 0x01U,         // Global Status Flags
-    IFCNT = 0x02U,         // Interface Transmission Counter
+    IFCNT = 0x02U,         // Interface Transmission Counter (UART writes only)
     SLAVECONF = 0x03U,     // Slave Configuration
     IOIN = 0x04U,          // Input / Output Reads
     OUTPUT = 0x04U,        // Output Settings (Write only)
@@ -110,6 +113,97 @@ enum class RampModeType : uint32_t {
     HOLD = 3U          // Hold mode
 };
 
+/**
+ * @brief SPI status byte returned in the first byte of every reply datagram.
+ * Reference: Datasheet Page 23, Section 4.1.2
+ */
+struct SpiStatus
+{
+  private:
+    static constexpr uint8_t p_reset_flag{0U};
+    static constexpr uint8_t p_driver_error{1U};
+    static constexpr uint8_t p_sg2{2U};
+    static constexpr uint8_t p_standstill{3U};
+    static constexpr uint8_t p_velocity_reached{4U};
+    static constexpr uint8_t p_position_reached{5U};
+    static constexpr uint8_t p_status_stop_l{6U};
+    static constexpr uint8_t p_status_stop_r{7U};
+
+    [[nodiscard]] constexpr bool bit(uint8_t pos) const noexcept
+    {
+        return ((raw >> pos) & 1U) != 0U;
+    }
+
+  public:
+    uint8_t raw{};
+
+    /**
+     * @brief GSTAT[0]: chip has been reset since the last GSTAT read.
+     */
+    [[nodiscard]] constexpr bool reset_flag() const noexcept
+    {
+        return bit(p_reset_flag);
+    }
+
+    /**
+     * @brief GSTAT[1]: driver shut down (over temperature or short).
+     */
+    [[nodiscard]] constexpr bool driver_error() const noexcept
+    {
+        return bit(p_driver_error);
+    }
+
+    /**
+     * @brief DRV_STATUS[24]: StallGuard2 active.
+     */
+    [[nodiscard]] constexpr bool stallguard() const noexcept
+    {
+        return bit(p_sg2);
+    }
+
+    /**
+     * @brief DRV_STATUS[31]: motor standstill.
+     */
+    [[nodiscard]] constexpr bool standstill() const noexcept
+    {
+        return bit(p_standstill);
+    }
+
+    /**
+     * @brief RAMP_STAT[8]: VACTUAL matches VMAX.
+     */
+    [[nodiscard]] constexpr bool velocity_reached() const noexcept
+    {
+        return bit(p_velocity_reached);
+    }
+
+    /**
+     * @brief RAMP_STAT[9]: XACTUAL matches XTARGET.
+     */
+    [[nodiscard]] constexpr bool position_reached() const noexcept
+    {
+        return bit(p_position_reached);
+    }
+
+    /**
+     * @brief RAMP_STAT[0]: left reference switch active.
+     */
+    [[nodiscard]] constexpr bool status_stop_l() const noexcept
+    {
+        return bit(p_status_stop_l);
+    }
+
+    /**
+     * @brief RAMP_STAT[1]: right reference switch active.
+     */
+    [[nodiscard]] constexpr bool status_stop_r() const noexcept
+    {
+        return bit(p_status_stop_r);
+    }
+
+    constexpr bool operator==(const SpiStatus&) const noexcept = default;
+};
+
 /**
  * @brief Register Address enum under type alias.
  */
@@ -357,6 +451,81 @@ struct SW_MODE : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegA
     using en_softstop_t = core::Field<SW_MODE, p_en_softstop>;
 };
 
+/**
+ * @brief Ramp Status (0x35)
+ * Event flags (event_*) are cleared by writing 1 to them. Declared read-only so it gets no shadow slot and no
+ * read-modify-write: a stale shadow would clear events nobody asked to clear. Use TMC5160::clear_ramp_events().
+ * Reference: Datasheet Page 44, Section 6.3.2.2
+ */
+struct RAMP_STAT
+    : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::RAMP_STAT),
+          core::Access::RO,
+          core::Volatile>
+{
+  private:
+    static constexpr uint8_t p_status_stop_l{0U};
+    static constexpr uint8_t p_status_stop_r{1U};
+    static constexpr uint8_t p_status_latch_l{2U};
+    static constexpr uint8_t p_status_latch_r{3U};
+    static constexpr uint8_t p_event_stop_l{4U};
+    static constexpr uint8_t p_event_stop_r{5U};
+    static constexpr uint8_t p_event_stop_sg{6U};
+    static constexpr uint8_t p_event_pos_reached{7U};
+    static constexpr uint8_t p_velocity_reached{8U};
+    static constexpr uint8_t p_position_reached{9U};
+    static constexpr uint8_t p_vzero{10U};
+    static constexpr uint8_t p_t_zerowait_active{11U};
+    static constexpr uint8_t p_second_move{12U};
+    static constexpr uint8_t p_status_sg{13U};
+
+  public:
+    // Bit 0: status_stop_l (Left reference switch active)
+    using status_stop_l_t = core::Field<RAMP_STAT, p_status_stop_l>;
+
+    // Bit 1: status_stop_r (Right reference switch active)
+    using status_stop_r_t = core::Field<RAMP_STAT, p_status_stop_r>;
+
+    // Bit 2: status_latch_l (Latch left ready)
+    using status_latch_l_t = core::Field<RAMP_STAT, p_status_latch_l>;
+
+    // Bit 3: status_latch_r (Latch right ready)
+    using status_latch_r_t = core::Field<RAMP_STAT, p_status_latch_r>;
+
+    // Bit 4: event_stop_l (Motor stopped by left switch)
+    using event_stop_l_t = core::Field<RAMP_STAT, p_event_stop_l>;
+
+    // Bit 5: event_stop_r (Motor stopped by right switch)
+    using event_stop_r_t = core::Field<RAMP_STAT, p_event_stop_r>;
+
+    // Bit 6: event_stop_sg (Motor stopped by StallGuard)
+    using event_stop_sg_t = core::Field<RAMP_STAT, p_event_stop_sg>;
+
+    // Bit 7: event_pos_reached (Target position reached, sticky)
+    using event_pos_reached_t = core::Field<RAMP_STAT, p_event_pos_reached>;
+
+    // Bit 8: velocity_reached (VACTUAL equals VMAX)
+    using velocity_reached_t = core::Field<RAMP_STAT, p_velocity_reached>;
+
+    // Bit 9: position_reached (XACTUAL equals XTARGET)
+    using position_reached_t = core::Field<RAMP_STAT, p_position_reached>;
+
+    // Bit 10: vzero (VACTUAL is zero)
+    using vzero_t = core::Field<RAMP_STAT, p_vzero>;
+
+    // Bit 11: t_zerowait_active (TZEROWAIT is running)
+    using t_zerowait_active_t = core::Field<RAMP_STAT, p_t_zerowait_active>;
+
+    // Bit 12: second_move (Automatic ramp required moving back)
+    using second_move_t = core::Field<RAMP_STAT, p_second_move>;
+
+    // Bit 13: status_sg (StallGuard active)
+    using status_sg_t = core::Field<RAMP_STAT, p_status_sg>;
+
+    // Write-1-to-clear event flags
+    static constexpr uint32_t event_mask{
+        event_stop_l_t::mask | event_stop_r_t::mask | event_stop_sg_t::mask | event_pos_reached_t::mask};
+};
+
 /**
  *
  */
@@ -423,7 +592,8 @@ struct GLOBAL_SCALER
  * The target position for ramp mode.
  * [cite_start]Reference: Datasheet Page 41 [cite: 1475]
  */
-struct XTARGET : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::XTARGET), core::Access::WO>
+struct XTARGET
+    : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::XTARGET), core::Access::WO, core::Trigger>
 {
 };
 
@@ -512,6 +682,233 @@ struct PWMCONF : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegA
 {
 };
 
+/**
+ * @brief CoolStep / StallGuard Lower Velocity Threshold (0x14)
+ *
+ * StallGuard2 output and sg_stop are enabled while TSTEP <= TCOOLTHRS, i.e. above this velocity.
+ * Range: 0 ... (2^20)-1
+ */
+struct TCOOLTHRS : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::TCOOLTHRS), core::Access::WO>
+{
+};
+
+/**
+ * @brief Encoder Configuration (0x38)
+ * Reference: Datasheet, Encoder Registers
+ */
+struct ENCMODE : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::ENCMODE), core::Access::RW>
+{
+  private:
+    static constexpr uint8_t p_pol_a{0U};
+    static constexpr uint8_t p_pol_b{1U};
+    static constexpr uint8_t p_pol_n{2U};
+    static constexpr uint8_t p_ignore_ab{3U};
+    static constexpr uint8_t p_clr_cont{4U};
+    static constexpr uint8_t p_clr_once{5U};
+    static constexpr uint8_t p_pos_edge{6U};
+    static constexpr uint8_t p_neg_edge{7U};
+    static constexpr uint8_t p_clr_enc_x{8U};
+    static constexpr uint8_t p_latch_x_act{9U};
+    static constexpr uint8_t p_enc_sel_decimal{10U};
+
+  public:
+    // Bits 0..3: N event condition (A/B polarity, N polarity, ignore A/B)
+    using pol_a_t = core::Field<ENCMODE, p_pol_a>;
+    using pol_b_t = core::Field<ENCMODE, p_pol_b>;
+    using pol_n_t = core::Field<ENCMODE, p_pol_n>;
+    using ignore_ab_t = core::Field<ENCMODE, p_ignore_ab>;
+
+    // Bits 4..7: Latch on every / the next N event, on its rising / falling edge
+    using clr_cont_t = core::Field<ENCMODE, p_clr_cont>;
+    using clr_once_t = core::Field<ENCMODE, p_clr_once>;
+    using pos_edge_t = core::Field<ENCMODE, p_pos_edge>;
+    using neg_edge_t = core::Field<ENCMODE, p_neg_edge>;
+
+    // Bit 8: clr_enc_x (Clear X_ENC on the latch event)
+    using clr_enc_x_t = core::Field<ENCMODE, p_clr_enc_x>;
+
+    // Bit 9: latch_x_act (Latch XACTUAL together with X_ENC)
+    using latch_x_act_t = core::Field<ENCMODE, p_latch_x_act>;
+
+    /**
+     * @brief ENC_CONST fraction: 0 = binary (/ 65536), 1 = decimal (/ 10000).
+     */
+    using enc_sel_decimal_t = core::Field<ENCMODE, p_enc_sel_decimal>;
+};
+
+/**
+ * @brief Actual Encoder Position (0x39)
+ * Signed, in XACTUAL units when ENC_CONST matches the encoder. Writable to align it with XACTUAL.
+ * Not shadowed: it counts with the motor (see features::EncoderMonitor).
+ * Reference: Datasheet, Encoder Registers
+ */
+struct X_ENC
+    : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::X_ENC), core::Access::RW, core::Volatile>
+{
+};
+
+/**
+ * @brief Encoder Constant (0x3A)
+ * Added to X_ENC on every encoder count: signed 16.16 (binary) or integer.fraction / 10000 (decimal), see
+ * Converter::encoder_to_enc_const().
+ * Reference: Datasheet, Encoder Registers
+ */
+struct ENC_CONST
+    : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::ENC_CONST), core::Access::WO>
+{
+  private:
+    static constexpr uint8_t p_fraction{0U};
+    static constexpr uint8_t p_integer{16U};
+    static constexpr uint8_t l_part{16U};
+
+  public:
+    // Bits 0..15: Fractional part
+    using fraction_t = core::Field<ENC_CONST, p_fraction, l_part>;
+
+    // Bits 16..31: Integer part, two's complement
+    using integer_t = core::Field<ENC_CONST, p_integer, l_part>;
+};
+
+/**
+ * @brief Encoder Status (0x3B)
+ * Note: R+WC (Read + Write 1 to Clear).
+ * Reference: Datasheet, Encoder Registers
+ */
+struct ENC_STATUS
+    : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::ENC_STATUS),
+          core::Access::RW,
+          core::Volatile>
+{
+  private:
+    static constexpr uint8_t p_n_event{0U};
+    static constexpr uint8_t p_deviation_warn{1U};
+
+  public:
+    // Bit 0: n_event (N event detected)
+    using n_event_t = core::Field<ENC_STATUS, p_n_event>;
+
+    // Bit 1: deviation_warn (Deviation between X_ENC and XACTUAL detected by the chip)
+    using deviation_warn_t = core::Field<ENC_STATUS, p_deviation_warn>;
+};
+
+/**
+ * @brief Microstep Table Entries (0x60 ... 0x67)
+ * Bit n of MSLUT_k is the differential entry 32 * k + n of the quarter wave, decoded with the MSLUTSEL widths.
+ * Not shadowed: the table is uploaded once per power cycle (see features::MicrostepTable).
+ * Reference: Datasheet, Microstepping Control Registers
+ *
+ * @tparam Index Table word (0-7).
+ */
+template<std::size_t Index>
+requires(Index < 8U)
+struct MSLUT
+    : core::RegisterAddress<static_cast<reg_address_undertype_t>(
+                                static_cast<std::size_t>(RegAddress::MSLUT_0) + Index),
+          core::Access::WO>
+{
+};
+
+using MSLUT_0 = MSLUT<0U>;
+using MSLUT_1 = MSLUT<1U>;
+using MSLUT_2 = MSLUT<2U>;
+using MSLUT_3 = MSLUT<3U>;
+using MSLUT_4 = MSLUT<4U>;
+using MSLUT_5 = MSLUT<5U>;
+using MSLUT_6 = MSLUT<6U>;
+using MSLUT_7 = MSLUT<7U>;
+
+/**
+ * @brief Microstep Table Segment Selection (0x68)
+ * The quarter wave is split into four segments at X1/X2/X3; segment n decodes a table bit of 0/1 as W_n - 1 / W_n.
+ * Reference: Datasheet, Microstepping Control Registers
+ */
+struct MSLUTSEL : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::MSLUTSEL), core::Access::WO>
+{
+  private:
+    static constexpr uint8_t p_w0{0U};
+    static constexpr uint8_t p_w1{2U};
+    static constexpr uint8_t p_w2{4U};
+    static constexpr uint8_t p_w3{6U};
+    static constexpr uint8_t l_w{2U};
+    static constexpr uint8_t p_x1{8U};
+    static constexpr uint8_t p_x2{16U};
+    static constexpr uint8_t p_x3{24U};
+    static constexpr uint8_t l_x{8U};
+
+  public:
+    // Bits 0..7: Segment widths W0..W3 (0 = -1/+0, 1 = +0/+1, 2 = +1/+2, 3 = +2/+3)
+    using w0_t = core::Field<MSLUTSEL, p_w0, l_w>;
+    using w1_t = core::Field<MSLUTSEL, p_w1, l_w>;
+    using w2_t = core::Field<MSLUTSEL, p_w2, l_w>;
+    using w3_t = core::Field<MSLUTSEL, p_w3, l_w>;
+
+    // Bits 8..31: First table entry of segments 1..3
+    using x1_t = core::Field<MSLUTSEL, p_x1, l_x>;
+    using x2_t = core::Field<MSLUTSEL, p_x2, l_x>;
+    using x3_t = core::Field<MSLUTSEL, p_x3, l_x>;
+};
+
+/**
+ * @brief Microstep Table Start Values (0x69)
+ * Reference: Datasheet, Microstepping Control Registers
+ */
+struct MSLUTSTART
+    : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::MSLUTSTART), core::Access::WO>
+{
+  private:
+    static constexpr uint8_t p_start_sin{0U};
+    static constexpr uint8_t p_start_sin90{16U};
+    static constexpr uint8_t l_start{8U};
+
+  public:
+    /**
+     * @brief Absolute current at table entry 0 (sine wave).
+     */
+    using start_sin_t = core::Field<MSLUTSTART, p_start_sin, l_start>;
+
+    /**
+     * @brief Absolute current at table entry 256 (cosine wave start).
+     */
+    using start_sin90_t = core::Field<MSLUTSTART, p_start_sin90, l_start>;
+};
+
+/**
+ * @brief CoolStep Smart Current Control and StallGuard2 Configuration (0x6D)
+ * Reference: Datasheet Page 49, Section 6.5.3
+ */
+struct COOLCONF : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::COOLCONF), core::Access::WO>
+{
+  private:
+    static constexpr uint8_t p_semin{0U};
+    static constexpr uint8_t l_semin{4U};
+    static constexpr uint8_t p_semax{8U};
+    static constexpr uint8_t l_semax{4U};
+    static constexpr uint8_t p_sgt{16U};
+    static constexpr uint8_t l_sgt{7U};
+    static constexpr uint8_t p_sfilt{24U};
+
+  public:
+    /**
+     * @brief CoolStep lower threshold (0 = CoolStep off).
+     */
+    using semin_t = core::Field<COOLCONF, p_semin, l_semin>;
+
+    /**
+     * @brief CoolStep upper threshold.
+     */
+    using semax_t = core::Field<COOLCONF, p_semax, l_semax>;
+
+    /**
+     * @brief StallGuard2 threshold, signed 7-bit (-64 ... 63, two's complement). Higher is less sensitive.
+     */
+    using sgt_t = core::Field<COOLCONF, p_sgt, l_sgt>;
+
+    /**
+     * @brief StallGuard2 filter: 1 = average over four full steps.
+     */
+    using sfilt_t = core::Field<COOLCONF, p_sfilt>;
+};
+
 // ========================================================================
 // READ-ONLY REGISTERS
 // ========================================================================
@@ -526,6 +923,24 @@ struct GSTAT : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAdd
 {
 };
 
+/**
+ * @brief Interface Transmission Counter (0x02)
+ * Incremented by every accepted UART (single wire) write access, wraps from 255 to 0; SPI writes and read accesses
+ * do not change it.
+ * [cite_start]Reference: Datasheet Page 33 [cite: 1433]
+ */
+struct IFCNT
+    : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::IFCNT), core::Access::RO, core::Volatile>
+{
+  private:
+    static constexpr uint8_t p_count{0U};
+    static constexpr uint8_t l_count{8U};
+
+  public:
+    // Bits 0..7: Write counter
+    using count_t = core::Field<IFCNT, p_count, l_count>;
+};
+
 /**
  * @brief Actual Motor Velocity (0x22)
  * Signed 24-bit value from the internal ramp generator.
@@ -544,6 +959,26 @@ struct VACTUAL
 struct DRV_STATUS
     : core::RegisterAddress<static_cast<reg_address_undertype_t>(RegAddress::DRV_STATUS), core::Access::RO>
 {
+  private:
+    static constexpr uint8_t p_sg_result{0U};
+    static constexpr uint8_t l_sg_result{10U};
+    static constexpr uint8_t p_cs_actual{16U};
+    static constexpr uint8_t l_cs_actual{5U};
+    static constexpr uint8_t p_stallguard{24U};
+    static constexpr uint8_t p_stst{31U};
+
+  public:
+    // Bits 0..9: SG_RESULT (StallGuard2 load; 0 = highest load)
+    using sg_result_t = core::Field<DRV_STATUS, p_sg_result, l_sg_result>;
+
+    // Bits 16..20: CS_ACTUAL (Actual current scale)
+    using cs_actual_t = core::Field<DRV_STATUS, p_cs_actual, l_cs_actual>;
+
+    // Bit 24: StallGuard (Stall detected, valid above TCOOLTHRS)
+    using stallguard_t = core::Field<DRV_STATUS, p_stallguard>;
+
+    // Bit 31: stst (Standstill)
+    using stst_t = core::Field<DRV_STATUS, p_stst>;
 };
 
 /**
@@ -553,6 +988,7 @@ inline constexpr RegisterTuple<GCONF,
     IHOLD_IRUN,
     CHOPCONF,
     SW_MODE,
+    RAMP_STAT,
     RAMPMODE,
     XACTUAL,
     VMAX,
@@ -570,9 +1006,117 @@ inline constexpr RegisterTuple<GCONF,
     PWMCONF,
     GSTAT,
     VACTUAL,
-    DRV_STATUS>
+    DRV_STATUS,
+    TCOOLTHRS,
+    COOLCONF,
+    ENCMODE,
+    ENC_CONST>
     register_tuple;
 
+/**
+ * @brief Dense shadow cache layout generated from register_tuple.
+ *
+ * Only writable registers own a slot; slots ascend with the register address, so iterating slots visits the
+ * registers in address order.
+ */
+struct ShadowLayout
+{
+    static constexpr uint8_t no_slot{0xFFU};
+
+    /**
+     * @brief Slot of every address, or no_slot.
+     */
+    static constexpr std::array<uint8_t, helpers::constant::tmc_register_count> slot_of_address{[] {
+        std::array<bool, helpers::constant::tmc_register_count> writable{};
+
+        std::apply(
+            [&writable]<typename... Regs>(Regs...) {
+                ((writable[std::decay_t<Regs>::address] = core::concepts::WritableRegister<std::decay_t<Regs>>), ...);
+            },
+            register_tuple.fields);
+
+        std::array<uint8_t, helpers::constant::tmc_register_count> table{};
+        uint8_t next{};
+
+        for (std::size_t addr{}; addr < table.size(); ++addr)
+        {
+            table[addr] = writable[addr] ? next++ : no_slot;
+        }
+
+        return table;
+    }()};
+
+    /**
+     * @brief Number of shadowed registers.
+     */
+    static constexpr std::size_t slot_count{[] {
+        std::size_t count{};
+        for (const auto slot: slot_of_address)
+        {
+            count += (no_slot != slot);
+        }
+        return count;
+    }()};
+
+    /**
+     * @brief Register address of every slot.
+     */
+    static constexpr std::array<uint8_t, slot_count> address_of_slot{[] {
+        std::array<uint8_t, slot_count> addresses{};
+        for (std::size_t addr{}; addr < slot_of_address.size(); ++addr)
+        {
+            if (no_slot != slot_of_address[addr])
+            {
+                addresses[slot_of_address[addr]] = static_cast<uint8_t>(addr);
+            }
+        }
+        return addresses;
+    }()};
+
+    /**
+     * @brief Addresses restore_from_shadow() replays: writable, neither volatile nor a trigger (RestorableRegister).
+     */
+    static constexpr std::array<bool, helpers::constant::tmc_register_count> restorable{[] {
+        std::array<bool, helpers::constant::tmc_register_count> table{};
+
+        std::apply(
+            [&table]<typename... Regs>(Regs...) {
+                ((table[std::decay_t<Regs>::address] = core::concepts::RestorableRegister<std::decay_t<Regs>>), ...);
+            },
+            register_tuple.fields);
+
+        return table;
+    }()};
+
+    /**
+     * @brief Slot of a register, resolved at compile time.
+     */
+    template<typename RegType>
+    [[nodiscard]] static consteval std::size_t slot() noexcept
+    {
+        constexpr uint8_t reg_slot{slot_of_address[RegType::address]};
+        static_assert(no_slot != reg_slot, "Register has no shadow slot: not a writable register of register_tuple");
+
+        return reg_slot;
+    }
+
+    /**
+     * @brief Slot of a runtime address, or no_slot.
+     */
+    [[nodiscard]] static constexpr uint8_t find(uint8_t addr) noexcept
+    {
+        return (addr < slot_of_address.size()) ? slot_of_address[addr] : no_slot;
+    }
+
+    /**
+     * @brief Whether a runtime address is restorable (false for unknown addresses).
+     */
+    [[nodiscard]] static constexpr bool is_restorable(uint8_t addr) noexcept
+    {
+        return addr < restorable.size() && restorable[addr];
+    }
+};
+
 } // namespace tmcxx::chip::tmc5160
 
 #endif // TMCXX_CHIPS_TMC5160_REGISTERS_HPP
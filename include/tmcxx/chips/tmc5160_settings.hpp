@@ -0,0 +1,55 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : tmc5160_settings
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_CHIPS_TMC5160_SETTINGS_HPP
+#define TMCXX_CHIPS_TMC5160_SETTINGS_HPP
+
+#include "tmcxx/helpers/constants.hpp"
+#include "tmcxx/helpers/units.hpp"
+
+#include <cstdint>
+
+namespace tmcxx::chip::tmc5160 {
+
+/**
+ * @brief Motor and driver configuration of one TMC5160.
+ *
+ * Structural type, so a constant Settings value can be passed as a template argument
+ * (see features::make_register_image).
+ */
+struct Settings
+{
+    units::frequency_t f_clk_hz{helpers::constant::default_clock_freq};
+    units::resistance_t r_sense{helpers::constant::default_r_sense_ohms};
+    units::microsteps_t full_steps{helpers::constant::default_full_steps};
+
+    units::current_t run_current{};
+    units::current_t hold_current{};
+    uint8_t hold_delay{};
+    uint8_t power_down_delay{};
+
+    units::rpm_t v_start{};
+    units::rpm_t v_stop{};
+    units::rpm_t v_1{};
+    units::rpm_t v_max{};
+
+    units::acceleration_t a_1{};
+    units::acceleration_t a_max{};
+    units::acceleration_t d_max{};
+    units::acceleration_t d_1{};
+
+    bool stealth_chop_enabled{};
+
+    uint8_t toff{};
+    uint8_t hstrt{};
+    int8_t hend{};
+    uint8_t tbl{};
+};
+
+} // namespace tmcxx::chip::tmc5160
+
+#endif // TMCXX_CHIPS_TMC5160_SETTINGS_HPP
@@ -12,7 +12,9 @@
 #include "tmcxx/features/core_communicator.hpp"
 #include "tmcxx/helpers/error.hpp"
 
+#include <array>
 #include <cstdint>
+#include <span>
 
 namespace tmcxx::detail {
 
@@ -22,8 +24,9 @@ namespace tmcxx::detail {
  * Wraps CoreCommunicator to provide a cleaner interface for register access.
  *
  * @tparam TSpi SPI device type satisfying hal::SpiDevice concept.
+ * @tparam TInstrument Transfer instrumentation policy of the CoreCommunicator (see features::TransferInstrument).
  */
-template<core::concepts::SpiDevice TSpi>
+template<core::concepts::SpiDevice TSpi, features::TransferInstrument TInstrument = features::NoInstrumentation>
 class TMC5160Bus {
   public:
     /**
@@ -61,6 +64,56 @@ class TMC5160Bus {
         return m_core.template read<Reg>();
     }
 
+    /**
+     * @brief Read several registers with one pipelined burst.
+     *
+     * @tparam Regs Register types from tmc5160_registers.hpp.
+     * @return Register values in template argument order, or error.
+     */
+    template<typename... Regs>
+    [[nodiscard]] helpers::result_t<std::array<uint32_t, sizeof...(Regs)>> read_many()
+    {
+        return m_core.template read_many<Regs...>();
+    }
+
+    /**
+     * @brief Read registers by runtime address with one pipelined burst, reporting every register's outcome.
+     *
+     * @param addresses Register addresses to read, in order.
+     * @param values Output span receiving one value per address.
+     * @param errors Output span receiving the outcome of every address.
+     * @return Result<void>: success if every register was read, else the first error.
+     */
+    [[nodiscard]] helpers::result_t<void> read_burst(
+        std::span<const uint8_t> addresses, std::span<uint32_t> values, std::span<helpers::ErrorCode> errors)
+    {
+        return m_core.read_burst(addresses, values, errors);
+    }
+
+    /**
+     * @brief Write unshadowed registers by runtime address, sent at once.
+     *
+     * @param addresses Register addresses without a shadow slot, in order.
+     * @param values One register word per address.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> write_burst(
+        std::span<const uint8_t> addresses, std::span<const uint32_t> values)
+    {
+        return m_core.write_burst(addresses, values);
+    }
+
+    /**
+     * @brief Get shadow register value.
+     *
+     * @param addr Register address (0-127).
+     * @return Cached value, or error if address invalid.
+     */
+    [[nodiscard]] helpers::result_t<uint32_t> get_shadow(uint8_t addr) const
+    {
+        return m_core.get_shadow(addr);
+    }
+
     /**
      * @brief Write a value to a specific field within a register.
      *
@@ -76,12 +129,80 @@ class TMC5160Bus {
         return m_core.template write_field<Field>(value);
     }
 
+    /**
+     * @brief SPI status byte of the most recent datagram.
+     */
+    [[nodiscard]] chip::tmc5160::SpiStatus last_status() const noexcept
+    {
+        return m_core.last_status();
+    }
+
+    /**
+     * @brief Refresh the SPI status byte with a single datagram.
+     *
+     * @return Current SPI status, or error.
+     */
+    [[nodiscard]] helpers::result_t<chip::tmc5160::SpiStatus> poll_status()
+    {
+        return m_core.poll_status();
+    }
+
+    /**
+     * @brief Rewrite every configured register from the shadow copy.
+     *
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> restore_from_shadow()
+    {
+        m_core.invalidate_shadow();
+        return m_core.restore_from_shadow();
+    }
+
+    /**
+     * @brief Forget that the shadow copy matches the chip; values and the configured set are kept.
+     */
+    void invalidate_shadow() noexcept
+    {
+        m_core.invalidate_shadow();
+    }
+
+    /**
+     * @brief Start staging register writes in the shadow cache.
+     */
+    void begin_transaction() noexcept
+    {
+        m_core.begin_transaction();
+    }
+
+    /**
+     * @brief Send every staged register exactly once.
+     *
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> commit()
+    {
+        return m_core.commit();
+    }
+
+    /**
+     * @brief Transfer instrumentation policy.
+     */
+    [[nodiscard]] TInstrument& instrument() noexcept
+    {
+        return m_core.instrument();
+    }
+
+    [[nodiscard]] const TInstrument& instrument() const noexcept
+    {
+        return m_core.instrument();
+    }
+
     /**
      * @brief Get mutable reference to underlying CoreCommunicator.
      *
      * @return Reference to CoreCommunicator.
      */
-    [[nodiscard]] features::CoreCommunicator<TSpi>& core() noexcept
+    [[nodiscard]] features::CoreCommunicator<TSpi, TInstrument>& core() noexcept
     {
         return m_core;
     }
@@ -91,13 +212,13 @@ class TMC5160Bus {
      *
      * @return Const reference to CoreCommunicator.
      */
-    [[nodiscard]] const features::CoreCommunicator<TSpi>& core() const noexcept
+    [[nodiscard]] const features::CoreCommunicator<TSpi, TInstrument>& core() const noexcept
     {
         return m_core;
     }
 
   private:
-    features::CoreCommunicator<TSpi> m_core;
+    features::CoreCommunicator<TSpi, TInstrument> m_core;
 };
 
 } // namespace tmcxx::detail
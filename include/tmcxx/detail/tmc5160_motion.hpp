@@ -8,8 +8,10 @@
 #ifndef TMCXX_TMC5160_MOTION_HPP
 #define TMCXX_TMC5160_MOTION_HPP
 
+#include "tmcxx/base/concepts.hpp"
 #include "tmcxx/chips/tmc5160_registers.hpp"
 #include "tmcxx/features/converter.hpp"
+#include "tmcxx/features/motion_snapshot.hpp"
 #include "tmcxx/helpers/error.hpp"
 
 #include <algorithm>
@@ -18,16 +20,15 @@
 
 namespace tmcxx::detail {
 
-constexpr uint32_t vactual_sign_bit{0x800000U};
-constexpr uint32_t vactual_sign_extension{0xFF000000U};
 /**
  * @brief Motion control interface for TMC5160.
  *
  * Handles velocity, position, ramp, and acceleration settings.
  *
  * @tparam Bus Bus type (e.g., TMC5160Bus<TSpi>).
+ * @tparam TConverter Unit converter (features::Converter or features::FixedPointConverter).
  */
-template<typename Bus>
+template<typename Bus, core::concepts::UnitConverter TConverter = features::Converter>
 class TMC5160Motion {
   public:
     /**
@@ -36,7 +37,7 @@ class TMC5160Motion {
      * @param bus Reference to bus (must outlive this object).
      * @param converter Reference to unit converter.
      */
-    TMC5160Motion(Bus& bus, features::Converter& converter)
+    TMC5160Motion(Bus& bus, TConverter& converter)
         : m_bus{bus}
         , m_converter{converter}
     {
@@ -332,18 +333,29 @@ class TMC5160Motion {
     [[nodiscard]] helpers::result_t<units::rpm_t> get_actual_velocity()
     {
         return m_bus.template read<chip::tmc5160::VACTUAL>().map([this](uint32_t val) {
-            auto signed_val{static_cast<int32_t>(val)};
-            if (val & vactual_sign_bit)
-            {
-                signed_val |= vactual_sign_extension;
-            }
-            return m_converter.vmax_to_rpm(static_cast<uint32_t>(std::abs(signed_val)));
+            return m_converter.vmax_to_rpm(static_cast<uint32_t>(std::abs(features::sign_extend_vactual(val))));
         });
     }
 
+    /**
+     * @brief Capture signed position, signed velocity, RAMP_STAT and the SPI status in one burst.
+     *
+     * XACTUAL, VACTUAL and RAMP_STAT are read with one pipelined burst (4 transfers) and no float math; use
+     * MotionSnapshot::velocity_rpm() to convert on demand.
+     *
+     * @return Result<MotionSnapshot> or error.
+     */
+    [[nodiscard]] helpers::result_t<features::MotionSnapshot> get_motion_snapshot()
+    {
+        return m_bus.template read_many<chip::tmc5160::XACTUAL, chip::tmc5160::VACTUAL, chip::tmc5160::RAMP_STAT>()
+            .map([this](const auto& values) {
+                return features::MotionSnapshot::from_registers(values[0], values[1], values[2], m_bus.last_status());
+            });
+    }
+
   private:
     Bus& m_bus;
-    features::Converter& m_converter;
+    TConverter& m_converter;
 };
 
 } // namespace tmcxx::detail
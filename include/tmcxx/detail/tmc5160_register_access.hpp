@@ -9,12 +9,14 @@
 #define TMCXX_TMC5160_REGISTER_ACCESS_HPP
 
 #include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/register_snapshot.hpp"
 #include "tmcxx/helpers/constants.hpp"
 #include "tmcxx/helpers/error.hpp"
 
 #include <array>
 #include <cstdint>
 #include <functional>
+#include <span>
 #include <tuple>
 #include <type_traits>
 
@@ -70,42 +72,72 @@ class TMC5160RegisterAccess {
     }
 
     /**
-     * @brief Read all registers into an array.
-     *
-     * @return Array of 128 register values if all reads succeed, else error.
+     * @brief Every register mapped in register_tuple.
      */
-    [[nodiscard]] helpers::result_t<std::array<uint32_t, helpers::constant::tmc_register_count>> get_all_registers()
-    {
-        std::array<uint32_t, helpers::constant::tmc_register_count> registers{};
-        std::size_t index{};
-        bool success{true};
+    static constexpr features::RegisterMask mapped_registers{[] {
+        features::RegisterMask mask{};
 
         std::apply(
-            [this, &registers, &index, &success]<typename... Regs>([[maybe_unused]] const Regs&... regs) {
-                ((success &=
-                     [this, &registers, &index, success]() {
-                         if (!success)
-                         {
-                             return false;
-                         }
-
-                         if (const auto read_val{m_bus.template read<std::decay_t<Regs>>()}; read_val)
-                         {
-                             registers[index++] = *read_val;
-                             return true;
-                         }
-                         return false;
-                     }()),
-                    ...);
+            [&mask]<typename... Regs>(Regs...) {
+                (mask.set(std::decay_t<Regs>::address), ...);
             },
             chip::tmc5160::register_tuple.fields);
 
-        if (false == success)
-        {
-            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
-        }
+        return mask;
+    }()};
 
-        return registers;
+    /**
+     * @brief Capture a compile-time selection of registers, indexed by address.
+     *
+     * Volatile and RO registers are fetched with one pipelined burst (N+1 transfers); the other registers are
+     * served from the shadow cache without SPI traffic. A failed transfer only fails the register it loses.
+     *
+     * @tparam Mask Registers to capture (all mapped registers by default).
+     * @return Snapshot with per-register errors.
+     */
+    template<features::RegisterMask Mask = mapped_registers>
+    [[nodiscard]] features::RegisterSnapshot snapshot()
+    {
+        static_assert((Mask | mapped_registers) == mapped_registers, "Mask selects a register that is not mapped");
+
+        static constexpr auto hardware{hardware_addresses<Mask>()};
+
+        return capture(Mask, hardware, hardware.size());
+    }
+
+    /**
+     * @brief Capture a runtime selection of registers, indexed by address.
+     *
+     * @param mask Registers to capture; unmapped addresses are reported as INVALID_PARAMETER.
+     * @return Snapshot with per-register errors.
+     */
+    [[nodiscard]] features::RegisterSnapshot snapshot(const features::RegisterMask& mask)
+    {
+        std::array<uint8_t, helpers::constant::tmc_register_count> hardware{};
+        std::size_t hardware_count{};
+
+        mask.for_each([&hardware, &hardware_count](uint8_t addr) {
+            if (ReadSource::HARDWARE == read_sources[addr])
+            {
+                hardware[hardware_count++] = addr;
+            }
+        });
+
+        return capture(mask, hardware, hardware_count);
+    }
+
+    /**
+     * @brief Read all registers into an array.
+     *
+     * @return Register values indexed by address (unmapped entries are 0), or the first error.
+     */
+    [[nodiscard]] helpers::result_t<std::array<uint32_t, helpers::constant::tmc_register_count>> get_all_registers()
+    {
+        const auto snap{snapshot()};
+
+        return snap.status().map([&snap] {
+            return snap.values;
+        });
     }
 
     /**
@@ -177,6 +209,15 @@ class TMC5160RegisterAccess {
     }
 
   private:
+    /**
+     * @brief Where a snapshot takes the value of an address from.
+     */
+    enum class ReadSource : uint8_t {
+        UNMAPPED,
+        SHADOW,
+        HARDWARE
+    };
+
     using register_read_method_t = helpers::result_t<uint32_t> (TMC5160RegisterAccess::*)();
     using setter_method_t = helpers::result_t<void> (TMC5160RegisterAccess::*)(uint32_t);
 
@@ -242,6 +283,97 @@ class TMC5160RegisterAccess {
         return table;
     }
 
+    /**
+     * @brief Create the snapshot source of every address.
+     */
+    static consteval auto create_read_sources() noexcept
+    {
+        std::array<ReadSource, helpers::constant::tmc_register_count> table{};
+
+        std::apply(
+            [&table]<typename... Regs>(Regs...) {
+                ((table[std::decay_t<Regs>::address] = core::concepts::HardwareReadRegister<std::decay_t<Regs>>
+                                                           ? ReadSource::HARDWARE
+                                                           : ReadSource::SHADOW),
+                    ...);
+            },
+            chip::tmc5160::register_tuple.fields);
+
+        return table;
+    }
+
+    static constexpr auto read_sources{create_read_sources()};
+
+    /**
+     * @brief Hardware backed addresses of a constant mask, ascending.
+     */
+    template<features::RegisterMask Mask>
+    [[nodiscard]] static consteval auto hardware_addresses() noexcept
+    {
+        constexpr std::size_t count{[] {
+            std::size_t total{};
+            for (uint8_t addr{}; addr < helpers::constant::tmc_register_count; ++addr)
+            {
+                total += (Mask.test(addr) && ReadSource::HARDWARE == read_sources[addr]);
+            }
+            return total;
+        }()};
+
+        std::array<uint8_t, count> addresses{};
+        std::size_t out{};
+
+        for (uint8_t addr{}; addr < helpers::constant::tmc_register_count; ++addr)
+        {
+            if (Mask.test(addr) && ReadSource::HARDWARE == read_sources[addr])
+            {
+                addresses[out++] = addr;
+            }
+        }
+
+        return addresses;
+    }
+
+    /**
+     * @brief Fill a snapshot: shadow registers from the cache, the first @p hardware_count entries of @p hardware
+     * with one burst.
+     */
+    template<std::size_t N>
+    [[nodiscard]] features::RegisterSnapshot capture(
+        const features::RegisterMask& mask, const std::array<uint8_t, N>& hardware, std::size_t hardware_count)
+    {
+        features::RegisterSnapshot snap{};
+        snap.requested = mask;
+
+        mask.for_each([this, &snap](uint8_t addr) {
+            if (ReadSource::UNMAPPED == read_sources[addr]) [[unlikely]]
+            {
+                snap.errors[addr] = helpers::ErrorCode::INVALID_PARAMETER;
+            }
+            else if (ReadSource::SHADOW == read_sources[addr])
+            {
+                snap.values[addr] = m_bus.get_shadow(addr).value_or(0U);
+            }
+        });
+
+        if constexpr (N > 0U)
+        {
+            std::array<uint32_t, N> values{};
+            std::array<helpers::ErrorCode, N> errors{};
+
+            const auto addresses{std::span{hardware}.first(hardware_count)};
+            (void)m_bus.read_burst(
+                addresses, std::span{values}.first(hardware_count), std::span{errors}.first(hardware_count));
+
+            for (std::size_t idx{}; idx < hardware_count; ++idx)
+            {
+                snap.values[addresses[idx]] = values[idx];
+                snap.errors[addresses[idx]] = errors[idx];
+            }
+        }
+
+        return snap;
+    }
+
     static constexpr auto register_lookup_table{create_lookup_table()};
     static constexpr auto register_set_lookup_table{create_set_lookup_table()};
 };
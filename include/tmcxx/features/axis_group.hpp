@@ -0,0 +1,322 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : axis_group
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_AXIS_GROUP_HPP
+#define TMCXX_FEATURES_AXIS_GROUP_HPP
+
+#include "tmcxx/helpers/error.hpp"
+#include "tmcxx/helpers/units.hpp"
+
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <tuple>
+#include <utility>
+
+namespace tmcxx::features {
+
+/**
+ * @brief One unit of work handed to a lane executor.
+ */
+struct LaneTask
+{
+    void (*run)(void* context){};
+    void* context{};
+};
+
+/**
+ * @brief Concept for lane executors.
+ *
+ * execute() must run every task exactly once and return only after all of them finished. Tasks of different
+ * lanes touch different buses and may run concurrently.
+ */
+template<typename T>
+concept LaneExecutor = requires(T executor, std::span<const LaneTask> tasks) {
+    { executor.execute(tasks) };
+};
+
+/**
+ * @brief Runs the lanes one after another on the calling thread.
+ */
+struct SequentialExecutor
+{
+    void execute(std::span<const LaneTask> tasks) const
+    {
+        for (const auto& task: tasks)
+        {
+            task.run(task.context);
+        }
+    }
+};
+
+/**
+ * @brief Concept for bus layers that can merge the datagrams of several axes (e.g. DaisyChain).
+ */
+template<typename T>
+concept FrameBatcher = requires(T batcher) {
+    { batcher.begin_frame() };
+    { batcher.end_frame() } -> std::same_as<helpers::result_t<void>>;
+    { batcher.discard_lost_writes() };
+};
+
+/**
+ * @brief Placeholder batcher for lanes whose axes sit on independent chip selects.
+ */
+struct NoBatching
+{
+    void begin_frame() noexcept
+    {
+    }
+
+    [[nodiscard]] helpers::result_t<void> end_frame() noexcept
+    {
+        return {};
+    }
+
+    void discard_lost_writes() noexcept
+    {
+    }
+};
+
+/**
+ * @brief Axes that share one SPI bus.
+ *
+ * Axes of a lane are always commanded sequentially, inside one batcher frame when a batcher is given, so a
+ * daisy chain costs one frame per register for the whole lane. If the frame fails, writes the axes already counted
+ * as sent may never have reached the chips: the shadows of all axes of the lane are invalidated, so
+ * apply_profile() resends and restore_from_shadow() replays them.
+ *
+ * @tparam Axis Driver type (e.g. TMC5160<TSpi>).
+ * @tparam N Number of axes on this bus.
+ * @tparam Batcher FrameBatcher type (NoBatching or DaisyChain<...>).
+ */
+template<typename Axis, std::size_t N, FrameBatcher Batcher = NoBatching>
+requires(N > 0U)
+class AxisLane {
+  public:
+    using axis_t = Axis;
+    static constexpr std::size_t axis_count{N};
+
+    /**
+     * @brief Construct lane on independent chip selects.
+     *
+     * @param axes Drivers on this bus (must outlive this object).
+     */
+    explicit AxisLane(std::array<Axis*, N> axes) noexcept
+    requires std::same_as<Batcher, NoBatching>
+        : m_axes{axes}
+    {
+    }
+
+    /**
+     * @brief Construct lane whose commands are merged into shared frames.
+     *
+     * @param batcher Bus layer the axes are attached to (must outlive this object).
+     * @param axes Drivers on this bus (must outlive this object).
+     */
+    AxisLane(Batcher& batcher, std::array<Axis*, N> axes) noexcept
+        : m_axes{axes}
+        , m_batcher{&batcher}
+    {
+    }
+
+    /**
+     * @brief Apply a command to every axis of the lane.
+     *
+     * Every axis is commanded even if an earlier one failed; the first error is returned.
+     *
+     * @param command Callable (Axis&, std::size_t group_index) -> Result<void>.
+     * @param first_index Group index of the first axis in this lane.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    template<typename Command>
+    [[nodiscard]] helpers::result_t<void> apply(Command& command, std::size_t first_index)
+    {
+        helpers::result_t<void> result{};
+
+        if (nullptr != m_batcher)
+        {
+            m_batcher->begin_frame();
+        }
+
+        for (std::size_t idx{}; idx < N; ++idx)
+        {
+            if (auto res{command(*m_axes[idx], first_index + idx)}; !res && result) [[unlikely]]
+            {
+                result = std::move(res);
+            }
+        }
+
+        if (nullptr != m_batcher)
+        {
+            if (auto res{m_batcher->end_frame()}; !res) [[unlikely]]
+            {
+                for (Axis* axis: m_axes)
+                {
+                    axis->invalidate_shadow();
+                }
+                m_batcher->discard_lost_writes();
+
+                if (result)
+                {
+                    result = std::move(res);
+                }
+            }
+        }
+
+        return result;
+    }
+
+  private:
+    std::array<Axis*, N> m_axes{};
+    Batcher* m_batcher{};
+};
+
+/**
+ * @brief Commands several lanes (buses) of axes as one group.
+ *
+ * Each lane becomes one executor task, so with a parallel executor the group latency is that of the slowest bus
+ * rather than the sum over all axes. Axes are addressed by group index: lane order, then position in the lane.
+ *
+ * @code
+ * AxisLane<TMC5160<SpiA>, 2> bus_a{{&x_axis, &y_axis}};
+ * AxisLane<TMC5160<Chain::Channel>, 4, Chain> bus_b{chain, {&z0, &z1, &z2, &z3}};
+ * ThreadPoolExecutor<1> pool{};
+ * AxisGroup group{pool, bus_a, bus_b};
+ * group.move_to({1000_steps, 2000_steps, 0_steps, 0_steps, 0_steps, 0_steps}, 120_rpm);
+ * @endcode
+ *
+ * @tparam Executor LaneExecutor type.
+ * @tparam Lanes AxisLane types.
+ */
+template<LaneExecutor Executor, typename... Lanes>
+requires(sizeof...(Lanes) > 0U)
+class AxisGroup {
+  public:
+    static constexpr std::size_t lane_count{sizeof...(Lanes)};
+    static constexpr std::size_t axis_count{(Lanes::axis_count + ...)};
+
+    using targets_t = std::array<units::microsteps_t, axis_count>;
+
+    /**
+     * @brief Construct group.
+     *
+     * @param executor Executor running the lanes (must outlive this object).
+     * @param lanes Lanes of the group (must outlive this object).
+     */
+    explicit AxisGroup(Executor& executor, Lanes&... lanes) noexcept
+        : m_executor{executor}
+        , m_lanes{lanes...}
+    {
+    }
+
+    AxisGroup(const AxisGroup&) = delete;
+    AxisGroup& operator=(const AxisGroup&) = delete;
+
+    /**
+     * @brief Move every axis to its own target.
+     *
+     * @param targets Target position per group index.
+     * @param max_speed Maximum velocity for all axes.
+     * @return Result<void> (Success or first ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> move_to(const targets_t& targets, units::rpm_t max_speed)
+    {
+        return for_each_axis([&targets, max_speed](auto& axis, std::size_t index) {
+            return axis.move_to(targets[index], max_speed);
+        });
+    }
+
+    /**
+     * @brief Rotate every axis at the same velocity.
+     *
+     * @param velocity RPM (negative = reverse).
+     * @return Result<void> (Success or first ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> rotate(units::rpm_t velocity)
+    {
+        return for_each_axis([velocity](auto& axis, std::size_t) {
+            return axis.rotate(velocity);
+        });
+    }
+
+    /**
+     * @brief Stop every axis.
+     * @return Result<void> (Success or first ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> stop()
+    {
+        return for_each_axis([](auto& axis, std::size_t) {
+            return axis.stop();
+        });
+    }
+
+    /**
+     * @brief Run an arbitrary command on every axis, lanes in parallel.
+     *
+     * @param command Callable (Axis&, std::size_t group_index) -> Result<void>; invoked concurrently from
+     *                different lanes when the executor is parallel.
+     * @return Result<void> (Success or first ErrorCode in group order).
+     */
+    template<typename Command>
+    [[nodiscard]] helpers::result_t<void> for_each_axis(Command command)
+    {
+        return dispatch(command, std::index_sequence_for<Lanes...>{});
+    }
+
+  private:
+    template<typename Lane, typename Command>
+    struct LaneJob
+    {
+        Lane* lane{};
+        Command* command{};
+        std::size_t first_index{};
+        helpers::result_t<void> result{};
+
+        static void run(void* context)
+        {
+            auto* job{static_cast<LaneJob*>(context)};
+            job->result = job->lane->apply(*job->command, job->first_index);
+        }
+    };
+
+    Executor& m_executor;
+    std::tuple<Lanes&...> m_lanes;
+
+    /**
+     * @brief Group index of the first axis of every lane.
+     */
+    static constexpr std::array<std::size_t, lane_count> first_indices{[] {
+        std::array<std::size_t, lane_count> indices{};
+        std::size_t next{};
+        std::size_t lane{};
+        ((indices[lane++] = std::exchange(next, next + Lanes::axis_count)), ...);
+        return indices;
+    }()};
+
+    template<typename Command, std::size_t... Idx>
+    [[nodiscard]] helpers::result_t<void> dispatch(Command& command, std::index_sequence<Idx...>)
+    {
+        std::tuple<LaneJob<Lanes, Command>...> jobs{
+            LaneJob<Lanes, Command>{&std::get<Idx>(m_lanes), &command, first_indices[Idx], {}}...};
+
+        const std::array<LaneTask, lane_count> tasks{
+            LaneTask{&LaneJob<Lanes, Command>::run, &std::get<Idx>(jobs)}...};
+
+        m_executor.execute(tasks);
+
+        helpers::result_t<void> result{};
+        ((result = result ? std::get<Idx>(jobs).result : result), ...);
+
+        return result;
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_AXIS_GROUP_HPP
@@ -0,0 +1,230 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : command_mailbox
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_COMMAND_MAILBOX_HPP
+#define TMCXX_FEATURES_COMMAND_MAILBOX_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/motion_queue.hpp"
+#include "tmcxx/helpers/error.hpp"
+#include "tmcxx/helpers/units.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Wait-free command mailbox between interrupt handlers and the task that owns the SPI bus.
+ *
+ * post_*() never touch SPI: they store the command in atomic slots and return, so jog and e-stop inputs can post
+ * straight from an ISR. The bus task calls drain(), which sends what accumulated since the last drain:
+ *   - Stop lane: a pending stop goes out first, as its own datagram (VMAX = 0), before any motion command.
+ *   - Motion slot: latest value wins. Of all moves/velocities posted since the last drain only the newest is sent,
+ *     RAMPMODE, VMAX and XTARGET in one commit() (one transfer_frames() call on batch devices).
+ * A stop cancels the motion posted before it; motion posted after a stop is sent after the stop.
+ *
+ * A motion post that races a drain may be split between two drains (new target with the previous VMAX); the next
+ * drain then sends the complete newest command. A drain whose transfer fails re-arms the failed lanes, except motion
+ * cancelled by a stop posted during that drain.
+ *
+ * @code
+ * CommandMailbox<TMC5160<MySpi>> mailbox{axis};
+ * void estop_isr() { mailbox.post_stop(); }
+ * void jog_isr() { mailbox.post_velocity(jog_speed); }
+ * // bus task: (void)mailbox.drain();
+ * @endcode
+ *
+ * @tparam Axis Driver type (e.g. TMC5160<TSpi>).
+ */
+template<typename Axis>
+class CommandMailbox {
+  public:
+    /**
+     * @brief Wake-up hook run at the end of every post (e.g. giving the bus task's semaphore from the ISR).
+     */
+    using wake_hook_t = void (*)(void* context);
+
+    /**
+     * @brief Construct mailbox.
+     *
+     * @param axis Driver drained into (must outlive this object).
+     */
+    explicit CommandMailbox(Axis& axis) noexcept
+        : m_axis{axis}
+    {
+    }
+
+    CommandMailbox(const CommandMailbox&) = delete;
+    CommandMailbox& operator=(const CommandMailbox&) = delete;
+
+    /**
+     * @brief Request a stop (VMAX = 0). ISR-safe.
+     */
+    void post_stop() noexcept
+    {
+        m_pending.exchange(stop_bit, std::memory_order_release);
+        wake();
+    }
+
+    /**
+     * @brief Request continuous rotation, replacing any motion not yet drained. ISR-safe.
+     *
+     * @param velocity Target velocity (negative = reverse).
+     */
+    void post_velocity(units::rpm_t velocity) noexcept
+    {
+        constexpr float zero_val{0.f};
+        const bool reverse{velocity.raw() < zero_val};
+
+        post(MotionSegment{
+            .mode = reverse ? chip::tmc5160::RampModeType::VELOCITY_NEG : chip::tmc5160::RampModeType::VELOCITY_POS,
+            .vmax = m_axis.converter().rpm_to_vmax(reverse ? std::negate{}(velocity) : velocity)});
+    }
+
+    /**
+     * @brief Request an absolute move, replacing any motion not yet drained. ISR-safe.
+     *
+     * @param target Target position.
+     * @param max_speed VMAX of the move.
+     */
+    void post_move(units::microsteps_t target, units::rpm_t max_speed) noexcept
+    {
+        post(MotionSegment{.mode = chip::tmc5160::RampModeType::POSITIONING,
+            .vmax = m_axis.converter().rpm_to_vmax(max_speed),
+            .target = target.raw()});
+    }
+
+    /**
+     * @brief Request a motion command in register units, replacing any motion not yet drained. ISR-safe.
+     */
+    void post(const MotionSegment& segment) noexcept
+    {
+        m_mode.store(static_cast<uint8_t>(segment.mode), std::memory_order_relaxed);
+        m_vmax.store(segment.vmax, std::memory_order_relaxed);
+        m_target.store(segment.target, std::memory_order_relaxed);
+
+        m_pending.fetch_or(motion_bit, std::memory_order_release);
+        wake();
+    }
+
+    /**
+     * @brief Send the pending stop and the newest motion command. Call from the task that owns the bus.
+     *
+     * @return True if anything was sent, false if the mailbox was empty, or the SPI error.
+     */
+    [[nodiscard]] helpers::result_t<bool> drain()
+    {
+        const uint32_t pending{m_pending.exchange(0U, std::memory_order_acquire)};
+
+        if ((pending & stop_bit) != 0U)
+        {
+            if (const auto res{m_axis.stop()}; !res) [[unlikely]]
+            {
+                rearm(pending);
+                return tl::unexpected(res.error());
+            }
+        }
+
+        if ((pending & motion_bit) != 0U)
+        {
+            if (const auto res{send_motion()}; !res) [[unlikely]]
+            {
+                rearm(motion_bit);
+                return tl::unexpected(res.error());
+            }
+        }
+
+        return 0U != pending;
+    }
+
+    /**
+     * @brief True if a command is waiting for drain().
+     */
+    [[nodiscard]] bool has_pending() const noexcept
+    {
+        return 0U != m_pending.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Install the wake-up hook; set it before the posting interrupts are enabled.
+     *
+     * @param hook Callback, or nullptr to remove it.
+     * @param context Opaque pointer handed to the callback.
+     */
+    void set_wake_hook(wake_hook_t hook, void* context = nullptr) noexcept
+    {
+        m_wake_hook = hook;
+        m_wake_context = context;
+    }
+
+  private:
+    static constexpr uint32_t stop_bit{1U << 0U};
+    static constexpr uint32_t motion_bit{1U << 1U};
+
+    static_assert(std::atomic<uint32_t>::is_always_lock_free, "Mailbox slots must be lock-free to stay ISR-safe");
+
+    Axis& m_axis;
+
+    std::atomic<uint32_t> m_pending{};
+    std::atomic<uint8_t> m_mode{};
+    std::atomic<uint32_t> m_vmax{};
+    std::atomic<int32_t> m_target{};
+
+    wake_hook_t m_wake_hook{};
+    void* m_wake_context{};
+
+    void wake() const noexcept
+    {
+        if (nullptr != m_wake_hook)
+        {
+            m_wake_hook(m_wake_context);
+        }
+    }
+
+    /**
+     * @brief Put the lanes of a failed drain back.
+     *
+     * A stop posted while the drain was sending cancels the motion it had taken out, so motion_bit is only restored
+     * while no stop is pending.
+     *
+     * @param lanes Lanes taken by the failed drain.
+     */
+    void rearm(uint32_t lanes) noexcept
+    {
+        uint32_t current{m_pending.load(std::memory_order_relaxed)};
+        uint32_t rearmed{};
+
+        do
+        {
+            rearmed = current | (((current & stop_bit) != 0U) ? (lanes & ~motion_bit) : lanes);
+        } while (!m_pending.compare_exchange_weak(current, rearmed, std::memory_order_relaxed));
+    }
+
+    [[nodiscard]] helpers::result_t<void> send_motion()
+    {
+        const auto mode{static_cast<chip::tmc5160::RampModeType>(m_mode.load(std::memory_order_relaxed))};
+
+        m_axis.begin_transaction();
+
+        (void)m_axis.template write_register<chip::tmc5160::RAMPMODE>(static_cast<uint32_t>(mode));
+        (void)m_axis.template write_register<chip::tmc5160::VMAX>(m_vmax.load(std::memory_order_relaxed));
+
+        if (chip::tmc5160::RampModeType::POSITIONING == mode)
+        {
+            (void)m_axis.template write_register<chip::tmc5160::XTARGET>(
+                static_cast<uint32_t>(m_target.load(std::memory_order_relaxed)));
+        }
+
+        return m_axis.commit();
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_COMMAND_MAILBOX_HPP
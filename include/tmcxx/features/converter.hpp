@@ -94,6 +94,40 @@ class Converter {
         return units::rpm_t{rpm_val};
     }
 
+    /**
+     * @brief Convert a velocity register value (VSTART, V1, VMAX, VSTOP) to microsteps per second.
+     *
+     * @param vmax Velocity register value.
+     *
+     * @return Velocity in microsteps per second.
+     */
+    [[nodiscard]] constexpr units::pps_t vmax_to_pps(uint32_t vmax) const noexcept
+    {
+        constexpr auto scale_factor{static_cast<double>(1ULL << 24)};
+
+        const double clock{static_cast<double>(m_clock_frequency)};
+
+        return units::pps_t{static_cast<float>((static_cast<double>(vmax) * clock) / scale_factor)};
+    }
+
+    /**
+     * @brief Convert an acceleration register value (A1, AMAX, DMAX, D1) to steps per second squared.
+     *
+     * Inverse of accel_to_register().
+     *
+     * @param value Acceleration register value.
+     *
+     * @return Acceleration in microsteps per second squared.
+     */
+    [[nodiscard]] constexpr units::acceleration_t register_to_accel(uint32_t value) const noexcept
+    {
+        constexpr auto constant_factor{static_cast<double>(1ULL << 41)};
+        const double clock{m_clock_frequency};
+        const double accel{(static_cast<double>(value) * clock * clock) / constant_factor};
+
+        return units::acceleration_t{static_cast<float>(accel)};
+    }
+
     /**
      * @brief Convert acceleration to AMAX/DMAX register value.
      *
@@ -141,6 +175,52 @@ class Converter {
         return static_cast<uint32_t>(clamped_value);
     }
 
+    /**
+     * @brief Convert an encoder resolution to the ENC_CONST register value, so X_ENC counts in XACTUAL microsteps.
+     *
+     * ENC_CONST is the number of microsteps (256 per full step) per encoder count: integer part in bits 31..16,
+     * fraction in bits 15..0 as x / 65536 (binary) or x / 10000 (decimal, ENCMODE.enc_sel_decimal). Negative
+     * factors keep a positive fraction below a rounded-down integer part, like the chip adds them.
+     *
+     * @param counts_per_rev Encoder counts per motor revolution (quadrature edges); negative if the encoder counts
+     * against the motor direction.
+     * @param decimal Encode the fraction for decimal mode.
+     *
+     * @return ENC_CONST register value (0 for 0 counts; the integer part saturates to -32768 ... 32767).
+     */
+    [[nodiscard]] constexpr uint32_t encoder_to_enc_const(int32_t counts_per_rev, bool decimal = false) const noexcept
+    {
+        if (0 == counts_per_rev)
+        {
+            return 0U;
+        }
+
+        constexpr double microsteps{256.0};
+        constexpr double min_integer{-32'768.0};
+        constexpr double max_integer{32'767.0};
+
+        const double scale{decimal ? 10'000.0 : 65'536.0};
+        const double factor{
+            std::clamp((static_cast<double>(m_full_steps) * microsteps) / static_cast<double>(counts_per_rev),
+                min_integer,
+                max_integer)};
+
+        auto integer{static_cast<int32_t>(factor)};
+        if (static_cast<double>(integer) > factor)
+        {
+            --integer;
+        }
+
+        auto fraction{static_cast<uint32_t>(((factor - static_cast<double>(integer)) * scale) + 0.5)};
+        if (static_cast<double>(fraction) >= scale)
+        {
+            fraction = 0U;
+            integer = std::min(integer + 1, static_cast<int32_t>(max_integer));
+        }
+
+        return (static_cast<uint32_t>(integer) << 16U) | fraction;
+    }
+
   private:
     float m_clock_frequency{};
     float m_full_steps{};
@@ -10,11 +10,22 @@
 
 #include "tmcxx/base/concepts.hpp"
 #include "tmcxx/base/register_base.hpp"
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/transfer_instrument.hpp"
 #include "tmcxx/helpers/constants.hpp"
 #include "tmcxx/helpers/error.hpp"
 
+#include <algorithm>
 #include <array>
+#include <atomic>
+#include <bitset>
 #include <concepts>
+#include <coroutine>
+#include <cstddef>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
 
 namespace tmcxx::features {
 
@@ -23,12 +34,29 @@ namespace tmcxx::features {
  *
  * Implements the 40-bit datagram protocol per TMC5160 datasheet.
  * Maintains shadow register cache for read-modify-write operations.
+ * Writes issued between begin_transaction() and commit() are staged in the cache and sent once per register.
+ * The SPI status byte of every received datagram is recorded and available through last_status().
+ * When TSpi also satisfies AsyncSpiDevice, submit_*() and async_*() run single register accesses without
+ * blocking, completing through a callback or a C++20 co_await.
+ * Every TSpi call is reported to the TInstrument policy (see TransferInstrument); the default compiles to nothing.
  *
  * @tparam TSpi SPI driver type satisfying hal::SpiDevice concept.
+ * @tparam TInstrument Transfer instrumentation policy (e.g. TransferStats).
  */
-template<core::concepts::SpiDevice TSpi>
+template<core::concepts::SpiDevice TSpi, TransferInstrument TInstrument = NoInstrumentation>
 class CoreCommunicator {
   public:
+    /**
+     * @brief Completion callback of an asynchronous register access.
+     *
+     * Receives the register value for reads and 0 for writes.
+     */
+    using async_completion_t = void (*)(void* context, helpers::result_t<uint32_t> result);
+
+    /**
+     * @brief Hook invoked when a received SPI status byte differs from the previous one.
+     */
+    using status_hook_t = void (*)(void* context, chip::tmc5160::SpiStatus previous, chip::tmc5160::SpiStatus current);
     explicit CoreCommunicator(TSpi& spi)
         : m_spi_device{spi}
     {
@@ -44,9 +72,21 @@ class CoreCommunicator {
     requires core::concepts::WritableRegister<RegType>
     [[nodiscard]] helpers::result_t<void> write(std::unsigned_integral auto value)
     {
-        m_register_cache[RegType::address] = value;
+        constexpr std::size_t slot{shadow_layout_t::slot<RegType>()};
+
+        m_register_cache[slot] = value;
+        mark_configured<RegType>();
+
+        if (m_staging)
+        {
+            m_dirty[slot] = true;
+            return {};
+        }
 
-        return write_raw(RegType::address, value);
+        m_dirty[slot] = false;
+        m_verification.synced = false;
+
+        return write_slot(slot);
     }
 
     /**
@@ -59,7 +99,7 @@ class CoreCommunicator {
     requires core::concepts::WritableField<FieldType>
     [[nodiscard]] helpers::result_t<void> write_field(uint32_t field_val)
     {
-        uint32_t current{m_register_cache[FieldType::register_t::address]};
+        uint32_t current{m_register_cache[shadow_layout_t::template slot<typename FieldType::register_t>()]};
 
         current &= ~FieldType::mask;
         current |= (field_val << FieldType::shift) & FieldType::mask;
@@ -75,14 +115,249 @@ class CoreCommunicator {
     requires core::concepts::Register<RegType>
     [[nodiscard]] helpers::result_t<uint32_t> read()
     {
-        if constexpr (constexpr bool is_ro{(RegType::access == core::Access::RO)};
-            core::concepts::VolatileRegister<RegType> || is_ro)
+        if constexpr (is_hardware_read<RegType>())
         {
             return read_raw(RegType::address);
         }
         else
         {
-            return m_register_cache[RegType::address];
+            return m_register_cache[shadow_layout_t::slot<RegType>()];
+        }
+    }
+
+    /**
+     * @brief Read several registers with one pipelined burst.
+     *
+     * The TMC5160 answers each datagram with the data requested by the previous one, so the read requests are
+     * chained: frame k+1 carries the reply for frame k. N hardware reads cost N+1 transfers instead of 2N.
+     * Cached registers are served from the shadow copy, exactly like read().
+     *
+     * @code
+     * const auto values{comm.read_many<XACTUAL, VACTUAL, DRV_STATUS, GSTAT>()};
+     * if (values) { const auto [x_actual, v_actual, drv_status, gstat]{*values}; }
+     * @endcode
+     *
+     * @tparam Regs Register types to read.
+     * @return Register values in template argument order, or error.
+     */
+    template<core::concepts::Register... Regs>
+    requires(sizeof...(Regs) > 0U)
+    [[nodiscard]] helpers::result_t<std::array<uint32_t, sizeof...(Regs)>> read_many()
+    {
+        constexpr std::size_t reg_count{sizeof...(Regs)};
+        constexpr std::array<std::size_t, reg_count> slots{cached_slot<Regs>()...};
+        constexpr std::array<bool, reg_count> from_hardware{is_hardware_read<Regs>()...};
+        constexpr auto hardware_addresses{hardware_read_addresses<Regs...>()};
+
+        std::array<uint32_t, hardware_addresses.size()> hardware_values{};
+
+        if constexpr (!hardware_addresses.empty())
+        {
+            if (const auto res{read_burst(hardware_addresses, hardware_values)}; !res) [[unlikely]]
+            {
+                return tl::unexpected(res.error());
+            }
+        }
+
+        std::array<uint32_t, reg_count> values{};
+        std::size_t hardware_idx{};
+
+        for (std::size_t idx{}; idx < reg_count; ++idx)
+        {
+            values[idx] = from_hardware[idx] ? hardware_values[hardware_idx++] : m_register_cache[slots[idx]];
+        }
+
+        return values;
+    }
+
+    /**
+     * @brief Read registers by runtime address with one pipelined burst.
+     *
+     * Always reads from hardware. The last request is followed by one dummy read datagram, so the burst costs
+     * addresses.size() + 1 transfers.
+     *
+     * @param addresses Register addresses (0-127) to read, in order.
+     * @param values Output span receiving one value per address.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> read_burst(std::span<const uint8_t> addresses, std::span<uint32_t> values)
+    {
+        if (addresses.size() != values.size()) [[unlikely]]
+        {
+            return tl::make_unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        if (addresses.empty())
+        {
+            return {};
+        }
+
+        if constexpr (core::concepts::BatchSpiDevice<TSpi>)
+        {
+            return read_burst_batched(addresses, values);
+        }
+
+        rx_tx_buffer_t rx_buffer{};
+
+        for (std::size_t idx{}; idx <= addresses.size(); ++idx)
+        {
+            // The trailing datagram only clocks out the last reply, any readable address works (GCONF).
+            constexpr uint8_t dummy_address{0x00U};
+            const uint8_t addr{(idx < addresses.size()) ? addresses[idx] : dummy_address};
+
+            if (const auto res{transfer(read_request(addr), rx_buffer)}; !res) [[unlikely]]
+            {
+                return res;
+            }
+
+            if (idx > 0U)
+            {
+                values[idx - 1U] = decode_datagram(rx_buffer);
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Read registers by runtime address with one pipelined burst, continuing past failed transfers.
+     *
+     * A failed datagram loses the reply it was clocking out, so only the register waiting for that reply is
+     * marked failed; the request the datagram carried is sent again. A datagram that fails with no reply
+     * outstanding (the first one, or the one after a failure) is resent once, and a second failure in a row
+     * marks its own register failed. Every register costs at most three datagrams, so the burst never exceeds
+     * 3 * addresses.size() + 1 transfers, and a dead bus ends it after 2 * addresses.size().
+     *
+     * @param addresses Register addresses (0-127) to read, in order.
+     * @param values Output span receiving one value per address (untouched for failed registers).
+     * @param errors Output span receiving ErrorCode::SUCCESS or the failure of every address.
+     * @return Result<void>: success if every register was read, else the first error.
+     */
+    [[nodiscard]] helpers::result_t<void> read_burst(
+        std::span<const uint8_t> addresses, std::span<uint32_t> values, std::span<helpers::ErrorCode> errors)
+    {
+        if (addresses.size() != values.size() || addresses.size() != errors.size()) [[unlikely]]
+        {
+            return tl::make_unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        constexpr std::size_t no_reply{std::numeric_limits<std::size_t>::max()};
+        constexpr uint8_t dummy_address{0x00U};
+
+        rx_tx_buffer_t rx_buffer{};
+        helpers::result_t<void> result{};
+        std::size_t awaiting{no_reply};
+        std::size_t next{};
+        bool resent{false};
+
+        while (next < addresses.size() || awaiting != no_reply)
+        {
+            const bool has_request{next < addresses.size()};
+            const auto res{transfer(read_request(has_request ? addresses[next] : dummy_address), rx_buffer)};
+
+            if (res) [[likely]]
+            {
+                if (awaiting != no_reply)
+                {
+                    values[awaiting] = decode_datagram(rx_buffer);
+                    errors[awaiting] = helpers::ErrorCode::SUCCESS;
+                }
+
+                awaiting = has_request ? next++ : no_reply;
+                resent = false;
+                continue;
+            }
+
+            if (result)
+            {
+                result = res;
+            }
+
+            if (awaiting != no_reply)
+            {
+                errors[std::exchange(awaiting, no_reply)] = res.error();
+            }
+            else if (!std::exchange(resent, true))
+            {
+                continue;
+            }
+            else
+            {
+                errors[next++] = res.error();
+                resent = false;
+            }
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Write unshadowed registers by runtime address, e.g. the microstep table.
+     *
+     * The datagrams go out at once, also inside a transaction: batch devices get batch_datagrams per
+     * transfer_frames() call, a DaisyChain in a frame merges them with the other chips' writes.
+     *
+     * @param addresses Register addresses (0-127) without a shadow slot, in order.
+     * @param values One register word per address.
+     * @return Result<void>; INVALID_PARAMETER for mismatched spans or a shadowed address (use write<>() for those,
+     * the cache must stay authoritative).
+     */
+    [[nodiscard]] helpers::result_t<void> write_burst(
+        std::span<const uint8_t> addresses, std::span<const uint32_t> values)
+    {
+        const bool unshadowed{std::ranges::all_of(addresses, [](const uint8_t addr) {
+            return addr < helpers::constant::tmc_register_count &&
+                   shadow_layout_t::no_slot == shadow_layout_t::find(addr);
+        })};
+
+        if (addresses.size() != values.size() || !unshadowed) [[unlikely]]
+        {
+            return tl::make_unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        m_verification.synced = false;
+
+        if constexpr (core::concepts::BatchSpiDevice<TSpi>)
+        {
+            batch_buffer_t tx_frames{};
+            batch_buffer_t rx_frames{};
+
+            for (std::size_t first{}; first < addresses.size(); first += batch_datagrams)
+            {
+                const std::size_t count{std::min(batch_datagrams, addresses.size() - first)};
+
+                for (std::size_t idx{}; idx < count; ++idx)
+                {
+                    const auto address_byte{
+                        static_cast<uint8_t>(addresses[first + idx] | helpers::constant::tmc_write_bit)};
+                    std::ranges::copy(
+                        encode_datagram(address_byte, values[first + idx]), frame(tx_frames, idx).begin());
+                }
+
+                if (const auto res{transfer_batch(tx_frames, rx_frames, count)}; !res) [[unlikely]]
+                {
+                    return res;
+                }
+            }
+
+            return {};
+        }
+        else
+        {
+            rx_tx_buffer_t rx_buffer{};
+
+            for (std::size_t idx{}; idx < addresses.size(); ++idx)
+            {
+                const auto address_byte{static_cast<uint8_t>(addresses[idx] | helpers::constant::tmc_write_bit)};
+
+                if (const auto res{transfer(encode_datagram(address_byte, values[idx]), rx_buffer)}; !res)
+                    [[unlikely]]
+                {
+                    return res;
+                }
+            }
+
+            return {};
         }
     }
 
@@ -105,134 +380,1100 @@ class CoreCommunicator {
     }
 
     /**
-     * @brief Get shadow register value.
+     * @brief SPI status byte of the most recent datagram (reads and writes alike).
      *
-     * @param addr Register the address (0-127).
-     * @return Cached value, or 0 if address invalid.
+     * Costs no SPI traffic; every access refreshes it. Writes deferred by a DaisyChain frame return the chip's
+     * reply from the previous frame, so after them the status is one frame old.
      */
-    [[nodiscard]] helpers::result_t<uint32_t> get_shadow(uint8_t addr) const
+    [[nodiscard]] chip::tmc5160::SpiStatus last_status() const noexcept
+    {
+        return m_last_status;
+    }
+
+    /**
+     * @brief Refresh the SPI status byte with a single datagram.
+     *
+     * Sends one read request (GCONF, side-effect free) and returns the status of its reply: one transfer instead
+     * of the two a full register read needs.
+     *
+     * @return Current SPI status, or error.
+     */
+    [[nodiscard]] helpers::result_t<chip::tmc5160::SpiStatus> poll_status()
     {
-        if (addr >= m_register_cache.size()) [[unlikely]]
+        rx_tx_buffer_t rx_buffer{};
+
+        if (const auto res{transfer(encode_datagram(0U, 0U), rx_buffer)}; !res) [[unlikely]]
         {
-            return tl::make_unexpected(helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+            return tl::unexpected(res.error());
         }
 
-        return m_register_cache[addr];
+        return m_last_status;
     }
 
-  private:
     /**
-     * @brief SPI Device member.
+     * @brief Install a hook called whenever the status byte changes.
+     *
+     * Runs in the context of the transfer that received the new status (may be an interrupt for async devices).
+     *
+     * @param hook Callback, or nullptr to remove it.
+     * @param context Opaque pointer handed to the callback.
      */
-    TSpi& m_spi_device;
+    void set_status_hook(status_hook_t hook, void* context = nullptr) noexcept
+    {
+        m_status_hook = hook;
+        m_status_hook_context = context;
+    }
 
     /**
-     * @brief Register list.
+     * @brief Transfer instrumentation policy.
      */
-    std::array<uint32_t, helpers::constant::tmc_register_count> m_register_cache{};
-
-    // LOW LEVEL SPI IMPLEMENTATION (Datasheet 4.1)
-
-    static constexpr std::size_t rx_tx_buffer_size{5ULL};
-    using rx_tx_buffer_t = std::array<uint8_t, rx_tx_buffer_size>;
-
-    helpers::result_t<void> write_raw(uint8_t addr, uint32_t val)
+    [[nodiscard]] TInstrument& instrument() noexcept
     {
-        rx_tx_buffer_t tx_buffer{};
-        rx_tx_buffer_t rx_buffer{};
+        return m_instrument;
+    }
 
-        const std::byte dummy{std::byte{addr} | std::byte{0x80U}};
+    [[nodiscard]] const TInstrument& instrument() const noexcept
+    {
+        return m_instrument;
+    }
 
-        tx_buffer[0] = std::to_integer<uint8_t>(dummy);
+    /**
+     * @brief Start staging writes.
+     *
+     * Until commit(), write() and write_field() only update the shadow cache and mark the register dirty, so
+     * several field writes to the same register collapse into one datagram.
+     */
+    void begin_transaction() noexcept
+    {
+        m_staging = true;
+    }
 
-        static constexpr std::size_t data_bytes_count{4ULL};
-        static constexpr std::size_t bits_per_byte{8ULL};
-        static constexpr uint32_t byte_mask{0xFFU};
+    /**
+     * @brief Send every dirty register exactly once and stop staging.
+     *
+     * Registers are flushed in ascending address order. On failure the unsent registers stay dirty, so calling
+     * commit() again retries only those.
+     *
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> commit()
+    {
+        m_staging = false;
 
-        for (std::size_t idx{}; idx < data_bytes_count; idx++)
+        if (core::concepts::BatchSpiDevice<TSpi> || m_verification.enabled)
         {
-            tx_buffer[1 + idx] = (val >> (bits_per_byte * (3 - idx))) & byte_mask;
+            return commit_batched();
         }
 
-        if (const auto res{transfer(tx_buffer, rx_buffer)}; !res)
+        for (std::size_t slot{}; slot < m_dirty.size(); ++slot)
         {
-            return res;
+            if (!m_dirty[slot])
+            {
+                continue;
+            }
+
+            if (const auto res{write_slot(slot)}; !res) [[unlikely]]
+            {
+                return res;
+            }
+
+            m_dirty[slot] = false;
         }
 
         return {};
     }
 
-    [[nodiscard]] helpers::result_t<uint32_t> read_raw(uint8_t addr)
+    /**
+     * @brief Check whether writes are currently being staged.
+     */
+    [[nodiscard]] bool in_transaction() const noexcept
     {
-        rx_tx_buffer_t tx_buffer{};
-        rx_tx_buffer_t rx_buffer{};
+        return m_staging;
+    }
+
+    /**
+     * @brief Number of registers waiting for commit().
+     */
+    [[nodiscard]] std::size_t pending_writes() const noexcept
+    {
+        return m_dirty.count();
+    }
+
+    /**
+     * @brief Forget that the shadow matches the chip (e.g. after GSTAT.reset was seen).
+     *
+     * Values and the configured set are kept, so restore_from_shadow() can replay them.
+     */
+    void invalidate_shadow() noexcept
+    {
+        m_valid.reset();
+    }
+
+    /**
+     * @brief Check whether the shadow entry is known to match the chip.
+     *
+     * True once the value has been written successfully and until invalidate_shadow().
+     *
+     * @param addr Register address (0-127).
+     */
+    [[nodiscard]] bool is_shadow_valid(uint8_t addr) const noexcept
+    {
+        const uint8_t slot{shadow_layout_t::find(addr)};
+        return shadow_layout_t::no_slot != slot && m_valid[slot];
+    }
+
+    /**
+     * @brief Check whether restore_from_shadow() would rewrite the register.
+     *
+     * @param addr Register address (0-127).
+     */
+    [[nodiscard]] bool is_configured(uint8_t addr) const noexcept
+    {
+        const uint8_t slot{shadow_layout_t::find(addr)};
+        return shadow_layout_t::no_slot != slot && m_configured[slot];
+    }
 
-        const std::byte dummy{std::byte{addr} & std::byte{0x7F}};
+    /**
+     * @brief Number of registers restore_from_shadow() would rewrite.
+     */
+    [[nodiscard]] std::size_t configured_registers() const noexcept
+    {
+        return m_configured.count();
+    }
+
+    /**
+     * @brief Rewrite every configured register from the shadow copy.
+     *
+     * Only writable, non-volatile, non-trigger registers that were written at least once are replayed, in one
+     * ascending-address commit(). Recovery after a brown-out therefore costs one datagram per configured register
+     * instead of a full apply_settings(); XTARGET and XACTUAL are left for the application to re-home.
+     *
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> restore_from_shadow()
+    {
+        m_dirty |= m_configured;
+        return commit();
+    }
 
-        tx_buffer[0] = std::to_integer<uint8_t>(dummy);
+    /**
+     * @brief Verify every commit() batch through the IFCNT write counter.
+     *
+     * IFCNT is read after each batch of up to batch_datagrams registers (and once before the first one); if it did
+     * not advance by the number of datagrams sent, only that batch is sent again, up to @p max_resends times. Writes
+     * outside commit() are not verified, they make the next batch read a fresh baseline.
+     *
+     * IFCNT only counts write accesses of the single wire (UART) interface; over SPI it does not move. Enabling
+     * therefore probes the link first: IFCNT is read, GSTAT is written with 0 (clears no flag) and IFCNT is read
+     * again. If the counter did not advance, verification stays off and NOT_IMPLEMENTED is returned.
+     *
+     * @param enabled Turn verification on or off.
+     * @param max_resends Resends of a batch before commit() fails with SPI_TRANSFER_FAILED.
+     * @return Result<void>: NOT_IMPLEMENTED if the link does not advance IFCNT, or the SPI error of the probe.
+     */
+    [[nodiscard]] helpers::result_t<void> set_write_verification(bool enabled, uint8_t max_resends = 2U)
+    {
+        m_verification = WriteVerification{.max_resends = max_resends};
 
-        if (const auto res{transfer(tx_buffer, rx_buffer)}; !res) [[unlikely]]
+        if (!enabled)
         {
-            return tl::unexpected(res.error());
+            return {};
         }
 
-        tx_buffer[0] = 0;
-
-        if (const auto res{transfer(tx_buffer, rx_buffer)}; !res) [[unlikely]]
+        if (const auto res{probe_write_count()}; !res) [[unlikely]]
         {
-            return tl::unexpected(res.error());
+            m_verification.synced = false;
+            return res;
         }
 
-        // rx[0] -> SPI Status Byte
-        // rx[1..4] -> 32-bit data (Big Endian)
+        m_verification.enabled = true;
+        return {};
+    }
+
+    [[nodiscard]] bool write_verification_enabled() const noexcept
+    {
+        return m_verification.enabled;
+    }
 
-        uint32_t result{};
+    /**
+     * @brief Batches sent again because IFCNT showed lost datagrams, since verification was enabled.
+     */
+    [[nodiscard]] std::size_t resent_batches() const noexcept
+    {
+        return m_verification.resent_batches;
+    }
 
-        constexpr std::size_t iter_count{4ULL}; // buffer size is 5
-        for (std::size_t idx{}; idx < iter_count; ++idx)
+    /**
+     * @brief Submit a register write without blocking.
+     *
+     * The shadow cache is updated immediately; @p on_complete runs once the datagram is on the wire.
+     * Only one asynchronous access can be in flight per communicator.
+     *
+     * @return Result<void>: CHIP_BUSY if an access is in flight, SPI_TRANSFER_FAILED if submission was refused.
+     */
+    template<typename RegType>
+    requires core::concepts::WritableRegister<RegType> && core::concepts::AsyncSpiDevice<TSpi>
+    [[nodiscard]] helpers::result_t<void> submit_write(
+        uint32_t value, async_completion_t on_complete, void* context = nullptr)
+    {
+        if (m_async.busy) [[unlikely]]
         {
-            const std::size_t shift_count{(8 * (3 - idx))};
-            const std::size_t value{(rx_buffer[1 + idx])};
-            result |= (value << shift_count);
+            return tl::make_unexpected(helpers::ErrorCode::CHIP_BUSY);
         }
-        return result;
+
+        constexpr std::size_t slot{shadow_layout_t::slot<RegType>()};
+
+        m_register_cache[slot] = value;
+        m_dirty[slot] = false;
+        m_valid[slot] = false;
+        m_verification.synced = false;
+        mark_configured<RegType>();
+
+        const std::byte address_byte{std::byte{RegType::address} | std::byte{helpers::constant::tmc_write_bit}};
+
+        return start_async(encode_datagram(std::to_integer<uint8_t>(address_byte), value), 0U, on_complete, context);
     }
 
     /**
-     * @brief RAII for transfer data on SPI.
+     * @brief Submit a register read without blocking.
+     *
+     * Cached registers complete synchronously from the shadow copy. Hardware reads chain the request and the
+     * reply datagram from the completion interrupt.
+     *
+     * @return Result<void>: CHIP_BUSY if an access is in flight, SPI_TRANSFER_FAILED if submission was refused.
      */
-    struct SPISelectGuard
+    template<typename RegType>
+    requires core::concepts::Register<RegType> && core::concepts::AsyncSpiDevice<TSpi>
+    [[nodiscard]] helpers::result_t<void> submit_read(async_completion_t on_complete, void* context = nullptr)
     {
-        TSpi& spi_device;
-
-        explicit SPISelectGuard(TSpi& device)
-            : spi_device{device}
+        if (m_async.busy) [[unlikely]]
         {
-            spi_device.select();
+            return tl::make_unexpected(helpers::ErrorCode::CHIP_BUSY);
         }
 
-        ~SPISelectGuard()
+        if constexpr (is_hardware_read<RegType>())
         {
-            spi_device.deselect();
+            constexpr uint8_t reply_datagrams{1U};
+            return start_async(encode_datagram(static_cast<uint8_t>(RegType::address & address_mask), 0U),
+                reply_datagrams,
+                on_complete,
+                context);
         }
+        else
+        {
+            on_complete(context, m_register_cache[shadow_layout_t::slot<RegType>()]);
+            return {};
+        }
+    }
 
-        /**
-         * @brief Not declared move ctor & assign operator.
-         */
-        SPISelectGuard(const SPISelectGuard&) = delete;
-        SPISelectGuard& operator=(const SPISelectGuard&) = delete;
-    };
+    /**
+     * @brief Awaitable returned by async_write() / async_read().
+     *
+     * Suspends the awaiting coroutine until the access completes and resumes it from the completion callback.
+     * Completion and suspension race on one atomic flag: whichever side arrives second continues the coroutine.
+     */
+    template<typename RegType, bool IsWrite>
+    class [[nodiscard]] AsyncAccess {
+      public:
+        AsyncAccess(CoreCommunicator& comm, uint32_t value) noexcept
+            : m_comm{comm}
+            , m_value{value}
+        {
+        }
 
-    [[nodiscard]] helpers::result_t<void> transfer(const rx_tx_buffer_t& tx_buffer, rx_tx_buffer_t& rx_buffer) noexcept(
-        noexcept(m_spi_device.transfer(tx_buffer, rx_buffer, rx_tx_buffer_size)))
-    {
-        SPISelectGuard guard{m_spi_device};
+        AsyncAccess(const AsyncAccess&) = delete;
+        AsyncAccess& operator=(const AsyncAccess&) = delete;
 
-        if (!m_spi_device.transfer(tx_buffer, rx_buffer, rx_tx_buffer_size))
+        [[nodiscard]] constexpr bool await_ready() const noexcept
         {
-            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+            return false;
+        }
+
+        bool await_suspend(std::coroutine_handle<> handle) noexcept
+        {
+            m_handle = handle;
+
+            helpers::result_t<void> submitted{};
+
+            if constexpr (IsWrite)
+            {
+                submitted = m_comm.template submit_write<RegType>(m_value, &AsyncAccess::on_complete, this);
+            }
+            else
+            {
+                submitted = m_comm.template submit_read<RegType>(&AsyncAccess::on_complete, this);
+            }
+
+            if (!submitted) [[unlikely]]
+            {
+                m_result = tl::unexpected(submitted.error());
+                return false;
+            }
+
+            return !m_arrived.exchange(true);
+        }
+
+        [[nodiscard]] auto await_resume() const noexcept
+        {
+            if constexpr (IsWrite)
+            {
+                return m_result.and_then([](uint32_t) {
+                    return helpers::result_t<void>{};
+                });
+            }
+            else
+            {
+                return m_result;
+            }
+        }
+
+      private:
+        static void on_complete(void* context, helpers::result_t<uint32_t> result) noexcept
+        {
+            auto* self{static_cast<AsyncAccess*>(context)};
+            self->m_result = result;
+
+            if (self->m_arrived.exchange(true))
+            {
+                self->m_handle.resume();
+            }
+        }
+
+        CoreCommunicator& m_comm;
+        uint32_t m_value{};
+        std::coroutine_handle<> m_handle{};
+        helpers::result_t<uint32_t> m_result{};
+        std::atomic<bool> m_arrived{};
+    };
+
+    /**
+     * @brief co_await-able register write.
+     *
+     * @code
+     * const auto res{co_await comm.async_write<XTARGET>(1000U)};
+     * @endcode
+     * @return Awaitable yielding Result<void>.
+     */
+    template<typename RegType>
+    requires core::concepts::WritableRegister<RegType> && core::concepts::AsyncSpiDevice<TSpi>
+    [[nodiscard]] AsyncAccess<RegType, true> async_write(uint32_t value) noexcept
+    {
+        return AsyncAccess<RegType, true>{*this, value};
+    }
+
+    /**
+     * @brief co_await-able register read.
+     *
+     * @return Awaitable yielding Result<uint32_t>.
+     */
+    template<typename RegType>
+    requires core::concepts::Register<RegType> && core::concepts::AsyncSpiDevice<TSpi>
+    [[nodiscard]] AsyncAccess<RegType, false> async_read() noexcept
+    {
+        return AsyncAccess<RegType, false>{*this, 0U};
+    }
+
+    /**
+     * @brief Check whether an asynchronous access is in flight.
+     */
+    [[nodiscard]] bool async_busy() const noexcept
+    {
+        return m_async.busy;
+    }
+
+    /**
+     * @brief Get shadow register value.
+     *
+     * @param addr Register the address (0-127).
+     * @return Cached value, or REGISTER_ACCESS_FAILED if the address has no shadow slot.
+     */
+    [[nodiscard]] helpers::result_t<uint32_t> get_shadow(uint8_t addr) const
+    {
+        const uint8_t slot{shadow_layout_t::find(addr)};
+
+        if (shadow_layout_t::no_slot == slot) [[unlikely]]
+        {
+            return tl::make_unexpected(helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+        }
+
+        return m_register_cache[slot];
+    }
+
+  private:
+    using shadow_layout_t = chip::tmc5160::ShadowLayout;
+
+    /**
+     * @brief SPI Device member.
+     */
+    TSpi& m_spi_device;
+
+    /**
+     * @brief Shadow copy of the writable registers, one slot each (see ShadowLayout).
+     */
+    std::array<uint32_t, shadow_layout_t::slot_count> m_register_cache{};
+
+    /**
+     * @brief Slots staged in the cache but not yet sent.
+     */
+    std::bitset<shadow_layout_t::slot_count> m_dirty{};
+
+    /**
+     * @brief Slots known to match the chip.
+     */
+    std::bitset<shadow_layout_t::slot_count> m_valid{};
+
+    /**
+     * @brief Restorable slots written at least once.
+     */
+    std::bitset<shadow_layout_t::slot_count> m_configured{};
+
+    /**
+     * @brief True between begin_transaction() and commit().
+     */
+    bool m_staging{};
+
+    /**
+     * @brief IFCNT write verification state (see set_write_verification()).
+     */
+    struct WriteVerification
+    {
+        std::size_t resent_batches{};
+        uint8_t max_resends{};
+        uint8_t write_count{};
+        bool enabled{};
+        bool synced{};
+    };
+
+    WriteVerification m_verification{};
+
+    chip::tmc5160::SpiStatus m_last_status{};
+    status_hook_t m_status_hook{};
+    void* m_status_hook_context{};
+
+    [[no_unique_address]] TInstrument m_instrument{};
+
+    // LOW LEVEL SPI IMPLEMENTATION (Datasheet 4.1)
+
+    static constexpr std::size_t rx_tx_buffer_size{5ULL};
+    using rx_tx_buffer_t = std::array<uint8_t, rx_tx_buffer_size>;
+
+    /**
+     * @brief Buffers and continuation of the asynchronous access in flight.
+     */
+    struct AsyncState
+    {
+        rx_tx_buffer_t tx_buffer{};
+        rx_tx_buffer_t rx_buffer{};
+        async_completion_t on_complete{};
+        void* context{};
+        uint32_t started{};
+        uint8_t remaining_datagrams{};
+        bool busy{};
+    };
+
+    struct NoAsyncState
+    {
+        static constexpr bool busy{false};
+    };
+
+    [[no_unique_address]] std::conditional_t<core::concepts::AsyncSpiDevice<TSpi>, AsyncState, NoAsyncState>
+        m_async{};
+
+    static constexpr uint8_t address_mask{0x7FU};
+
+    /**
+     * @brief Datagrams per transfer_frames() call of a BatchSpiDevice.
+     */
+    static constexpr std::size_t batch_datagrams{16U};
+    using batch_buffer_t = std::array<uint8_t, batch_datagrams * rx_tx_buffer_size>;
+
+    /**
+     * @brief Datagram @p idx of a batch buffer.
+     */
+    template<typename Buffer>
+    [[nodiscard]] static constexpr auto frame(Buffer& buffer, std::size_t idx) noexcept
+    {
+        return std::span{buffer}.subspan(idx * rx_tx_buffer_size).template first<rx_tx_buffer_size>();
+    }
+
+    static constexpr std::size_t data_bytes_count{4ULL};
+    static constexpr std::size_t bits_per_byte{8ULL};
+    static constexpr uint32_t byte_mask{0xFFU};
+
+    /**
+     * @brief Registers that must be fetched from the chip (volatile or RO) instead of the shadow copy.
+     */
+    template<typename RegType>
+    [[nodiscard]] static consteval bool is_hardware_read() noexcept
+    {
+        return core::concepts::HardwareReadRegister<RegType>;
+    }
+
+    /**
+     * @brief Shadow slot of a cached register, unused for hardware backed ones.
+     */
+    template<typename RegType>
+    [[nodiscard]] static consteval std::size_t cached_slot() noexcept
+    {
+        if constexpr (is_hardware_read<RegType>())
+        {
+            return shadow_layout_t::no_slot;
+        }
+        else
+        {
+            return shadow_layout_t::slot<RegType>();
+        }
+    }
+
+    /**
+     * @brief Addresses of the hardware backed registers in a pack, in pack order.
+     */
+    template<typename... Regs>
+    [[nodiscard]] static consteval auto hardware_read_addresses() noexcept
+    {
+        std::array<uint8_t, (std::size_t{is_hardware_read<Regs>()} + ...)> result{};
+        std::size_t out{};
+
+        ((is_hardware_read<Regs>() ? (result[out++] = Regs::address, 0) : 0), ...);
+
+        return result;
+    }
+
+    /**
+     * @brief Build a 40-bit datagram: address byte followed by 32-bit data (Big Endian).
+     */
+    [[nodiscard]] static constexpr rx_tx_buffer_t encode_datagram(uint8_t address_byte, uint32_t val) noexcept
+    {
+        rx_tx_buffer_t buffer{};
+        buffer[0] = address_byte;
+
+        for (std::size_t idx{}; idx < data_bytes_count; idx++)
+        {
+            buffer[1 + idx] = (val >> (bits_per_byte * (3 - idx))) & byte_mask;
+        }
+
+        return buffer;
+    }
+
+    /**
+     * @brief Build the read request datagram of a register.
+     */
+    [[nodiscard]] static constexpr rx_tx_buffer_t read_request(uint8_t addr) noexcept
+    {
+        return encode_datagram(static_cast<uint8_t>(addr & address_mask), 0U);
+    }
+
+    /**
+     * @brief Extract the 32-bit data of a received datagram.
+     *
+     * rx[0] -> SPI Status Byte
+     * rx[1..4] -> 32-bit data (Big Endian)
+     */
+    [[nodiscard]] static constexpr uint32_t decode_datagram(std::span<const uint8_t, rx_tx_buffer_size> buffer) noexcept
+    {
+        uint32_t result{};
+
+        for (std::size_t idx{}; idx < data_bytes_count; ++idx)
+        {
+            const std::size_t shift_count{(bits_per_byte * (3 - idx))};
+            const std::size_t value{(buffer[1 + idx])};
+            result |= (value << shift_count);
+        }
+
+        return result;
+    }
+
+    /**
+     * @brief Send the shadow value of a slot to its register.
+     */
+    helpers::result_t<void> write_slot(std::size_t slot)
+    {
+        rx_tx_buffer_t rx_buffer{};
+
+        const uint8_t addr{shadow_layout_t::address_of_slot[slot]};
+        const std::byte address_byte{std::byte{addr} | std::byte{helpers::constant::tmc_write_bit}};
+        const auto tx_buffer{encode_datagram(std::to_integer<uint8_t>(address_byte), m_register_cache[slot])};
+
+        if (const auto res{transfer(tx_buffer, rx_buffer)}; !res)
+        {
+            m_valid[slot] = false;
+            return res;
+        }
+
+        m_valid[slot] = true;
+        return {};
+    }
+
+    /**
+     * @brief Pipelined read burst sent as transfer_frames() batches of up to batch_datagrams datagrams.
+     *
+     * The reply of every datagram belongs to the request before it, also across batch boundaries.
+     */
+    [[nodiscard]] helpers::result_t<void> read_burst_batched(
+        std::span<const uint8_t> addresses, std::span<uint32_t> values)
+    requires core::concepts::BatchSpiDevice<TSpi>
+    {
+        constexpr uint8_t dummy_address{0x00U};
+
+        batch_buffer_t tx_frames{};
+        batch_buffer_t rx_frames{};
+        const std::size_t datagrams{addresses.size() + 1U};
+
+        for (std::size_t first{}; first < datagrams; first += batch_datagrams)
+        {
+            const std::size_t count{std::min(batch_datagrams, datagrams - first)};
+
+            for (std::size_t idx{}; idx < count; ++idx)
+            {
+                const std::size_t datagram{first + idx};
+                const uint8_t addr{(datagram < addresses.size()) ? addresses[datagram] : dummy_address};
+                std::ranges::copy(read_request(addr), frame(tx_frames, idx).begin());
+            }
+
+            if (const auto res{transfer_batch(tx_frames, rx_frames, count)}; !res) [[unlikely]]
+            {
+                return res;
+            }
+
+            for (std::size_t idx{(0U == first) ? 1U : 0U}; idx < count; ++idx)
+            {
+                values[first + idx - 1U] = decode_datagram(frame(rx_frames, idx));
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief commit() for batch devices and verified writes: dirty registers go out batch_datagrams at a time.
+     *
+     * A failed batch leaves its registers and all later ones dirty.
+     */
+    [[nodiscard]] helpers::result_t<void> commit_batched()
+    {
+        std::array<std::size_t, batch_datagrams> slots{};
+        std::size_t count{};
+
+        for (std::size_t slot{}; slot < m_dirty.size(); ++slot)
+        {
+            if (!m_dirty[slot])
+            {
+                continue;
+            }
+
+            slots[count++] = slot;
+
+            if (batch_datagrams == count)
+            {
+                if (const auto res{write_batch(slots)}; !res) [[unlikely]]
+                {
+                    return res;
+                }
+                count = 0U;
+            }
+        }
+
+        return write_batch(std::span{slots}.first(count));
+    }
+
+    /**
+     * @brief Send one commit() batch and, with verification enabled, check it against IFCNT.
+     *
+     * A batch that still comes up short after max_resends resends stays dirty.
+     */
+    [[nodiscard]] helpers::result_t<void> write_batch(std::span<const std::size_t> slots)
+    {
+        if (!m_verification.enabled || slots.empty())
+        {
+            return send_batch(slots);
+        }
+
+        if (!m_verification.synced)
+        {
+            if (const auto res{sync_write_count()}; !res) [[unlikely]]
+            {
+                return res;
+            }
+        }
+
+        for (uint8_t resends{};; ++resends)
+        {
+            const auto expected{static_cast<uint8_t>(m_verification.write_count + slots.size())};
+
+            if (const auto res{send_batch(slots)}; !res) [[unlikely]]
+            {
+                m_verification.synced = false;
+                return res;
+            }
+
+            if (const auto res{sync_write_count()}; !res) [[unlikely]]
+            {
+                mark_unconfirmed(slots);
+                return res;
+            }
+
+            if (expected == m_verification.write_count)
+            {
+                return {};
+            }
+
+            if (resends == m_verification.max_resends) [[unlikely]]
+            {
+                mark_unconfirmed(slots);
+                return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+            }
+
+            ++m_verification.resent_batches;
+        }
+    }
+
+    /**
+     * @brief Keep a batch whose delivery could not be confirmed dirty for the next commit().
+     */
+    void mark_unconfirmed(std::span<const std::size_t> slots) noexcept
+    {
+        for (const auto slot: slots)
+        {
+            m_dirty[slot] = true;
+            m_valid[slot] = false;
+        }
+    }
+
+    /**
+     * @brief Send the shadow values of a batch: one transfer_frames() call, or one datagram per register.
+     */
+    [[nodiscard]] helpers::result_t<void> send_batch(std::span<const std::size_t> slots)
+    {
+        if constexpr (core::concepts::BatchSpiDevice<TSpi>)
+        {
+            return write_slots(slots);
+        }
+        else
+        {
+            for (const auto slot: slots)
+            {
+                if (const auto res{write_slot(slot)}; !res) [[unlikely]]
+                {
+                    return res;
+                }
+                m_dirty[slot] = false;
+            }
+
+            return {};
+        }
+    }
+
+    /**
+     * @brief Check that a write advances IFCNT; leaves the new count as the baseline of the first batch.
+     */
+    [[nodiscard]] helpers::result_t<void> probe_write_count()
+    {
+        if (const auto res{sync_write_count()}; !res) [[unlikely]]
+        {
+            return res;
+        }
+
+        const uint8_t before{m_verification.write_count};
+
+        rx_tx_buffer_t rx_buffer{};
+        constexpr auto gstat_write{
+            static_cast<uint8_t>(chip::tmc5160::GSTAT::address | helpers::constant::tmc_write_bit)};
+
+        if (const auto res{transfer(encode_datagram(gstat_write, 0U), rx_buffer)}; !res) [[unlikely]]
+        {
+            return res;
+        }
+
+        if (const auto res{sync_write_count()}; !res) [[unlikely]]
+        {
+            return res;
+        }
+
+        if (static_cast<uint8_t>(before + 1U) != m_verification.write_count) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::NOT_IMPLEMENTED);
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Read IFCNT as the baseline of the next verified batch.
+     */
+    [[nodiscard]] helpers::result_t<void> sync_write_count()
+    {
+        const auto count{read_raw(chip::tmc5160::IFCNT::address)};
+
+        m_verification.synced = count.has_value();
+        if (!count) [[unlikely]]
+        {
+            return tl::unexpected(count.error());
+        }
+
+        m_verification.write_count = static_cast<uint8_t>(chip::tmc5160::IFCNT::count_t::extract(*count));
+        return {};
+    }
+
+    /**
+     * @brief Send the shadow values of several slots with one transfer_frames() call.
+     */
+    helpers::result_t<void> write_slots(std::span<const std::size_t> slots)
+    requires core::concepts::BatchSpiDevice<TSpi>
+    {
+        if (slots.empty())
+        {
+            return {};
+        }
+
+        batch_buffer_t tx_frames{};
+        batch_buffer_t rx_frames{};
+
+        for (std::size_t idx{}; idx < slots.size(); ++idx)
+        {
+            const uint8_t addr{shadow_layout_t::address_of_slot[slots[idx]]};
+            const auto address_byte{static_cast<uint8_t>(addr | helpers::constant::tmc_write_bit)};
+            std::ranges::copy(
+                encode_datagram(address_byte, m_register_cache[slots[idx]]), frame(tx_frames, idx).begin());
+        }
+
+        const auto res{transfer_batch(tx_frames, rx_frames, slots.size())};
+
+        for (const auto slot: slots)
+        {
+            m_valid[slot] = res.has_value();
+            m_dirty[slot] = !res.has_value();
+        }
+
+        return res;
+    }
+
+    [[nodiscard]] helpers::result_t<uint32_t> read_raw(uint8_t addr)
+    {
+        uint32_t result{};
+
+        if (const auto res{read_burst(std::span{&addr, 1U}, std::span{&result, 1U})}; !res) [[unlikely]]
+        {
+            return tl::unexpected(res.error());
+        }
+
+        return result;
+    }
+
+    template<typename RegType>
+    void mark_configured() noexcept
+    {
+        if constexpr (core::concepts::RestorableRegister<RegType>)
+        {
+            m_configured[shadow_layout_t::slot<RegType>()] = true;
+        }
+    }
+
+    void record_status(uint8_t status_byte) noexcept
+    {
+        const chip::tmc5160::SpiStatus current{status_byte};
+
+        if (current == m_last_status)
+        {
+            return;
+        }
+
+        const auto previous{m_last_status};
+        m_last_status = current;
+
+        if (nullptr != m_status_hook)
+        {
+            m_status_hook(m_status_hook_context, previous, current);
+        }
+    }
+
+    /**
+     * @brief Start the first datagram of an asynchronous access.
+     *
+     * @param remaining Datagrams to chain after this one (1 for reads: the reply frame).
+     */
+    [[nodiscard]] helpers::result_t<void> start_async(
+        const rx_tx_buffer_t& tx_buffer, uint8_t remaining, async_completion_t on_complete, void* context)
+    {
+        m_async.tx_buffer = tx_buffer;
+        m_async.on_complete = on_complete;
+        m_async.context = context;
+        m_async.remaining_datagrams = remaining;
+        m_async.busy = true;
+
+        if (!submit_async_datagram()) [[unlikely]]
+        {
+            m_async.busy = false;
+            return tl::make_unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+        }
+
+        return {};
+    }
+
+    [[nodiscard]] bool submit_async_datagram()
+    {
+        if constexpr (TInstrument::enabled)
+        {
+            m_async.started = m_instrument.now();
+        }
+
+        m_spi_device.select();
+
+        if (!m_spi_device.transfer_async(
+                m_async.tx_buffer, m_async.rx_buffer, &CoreCommunicator::on_async_datagram_complete, this))
+        {
+            m_spi_device.deselect();
+            instrument_transfer(m_async.tx_buffer, m_async.rx_buffer, m_async.started, false);
+            return false;
+        }
+
+        return true;
+    }
+
+    static void on_async_datagram_complete(void* context, bool success)
+    {
+        auto* self{static_cast<CoreCommunicator*>(context)};
+        auto& state{self->m_async};
+
+        self->m_spi_device.deselect();
+        self->instrument_transfer(state.tx_buffer, state.rx_buffer, state.started, success);
+
+        if (success)
+        {
+            self->record_status(state.rx_buffer[0]);
+        }
+
+        if (success && state.remaining_datagrams > 0U)
+        {
+            --state.remaining_datagrams;
+            state.tx_buffer = encode_datagram(0U, 0U);
+
+            if (self->submit_async_datagram()) [[likely]]
+            {
+                return;
+            }
+
+            success = false;
+        }
+
+        helpers::result_t<uint32_t> result{decode_datagram(state.rx_buffer)};
+        if (!success) [[unlikely]]
+        {
+            result = tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+        }
+        else if ((state.tx_buffer[0] & helpers::constant::tmc_write_bit) != 0U)
+        {
+            // The reply of a write carries the previous datagram's read data, not this register.
+            self->m_valid[shadow_layout_t::find(state.tx_buffer[0] & address_mask)] = true;
+            result = 0U;
+        }
+
+        // Release before notifying so the callback can chain the next access.
+        state.busy = false;
+        state.on_complete(state.context, result);
+    }
+
+    /**
+     * @brief RAII for transfer data on SPI.
+     */
+    struct SPISelectGuard
+    {
+        TSpi& spi_device;
+
+        explicit SPISelectGuard(TSpi& device)
+            : spi_device{device}
+        {
+            spi_device.select();
+        }
+
+        ~SPISelectGuard()
+        {
+            spi_device.deselect();
+        }
+
+        /**
+         * @brief Not declared move ctor & assign operator.
+         */
+        SPISelectGuard(const SPISelectGuard&) = delete;
+        SPISelectGuard& operator=(const SPISelectGuard&) = delete;
+    };
+
+    [[nodiscard]] helpers::result_t<void> transfer(const rx_tx_buffer_t& tx_buffer, rx_tx_buffer_t& rx_buffer) noexcept(
+        noexcept(m_spi_device.transfer(tx_buffer, rx_buffer, rx_tx_buffer_size)))
+    {
+        if (m_async.busy) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::CHIP_BUSY);
+        }
+
+        SPISelectGuard guard{m_spi_device};
+
+        const uint32_t started{start_instrumented()};
+        const bool success{m_spi_device.transfer(tx_buffer, rx_buffer, rx_tx_buffer_size)};
+        instrument_transfer(tx_buffer, rx_buffer, started, success);
+
+        if (!success)
+        {
+            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+        }
+
+        record_status(rx_buffer[0]);
+        return {};
+    }
+
+    /**
+     * @brief Send the first @p count datagrams of a batch buffer with one transfer_frames() call.
+     */
+    [[nodiscard]] helpers::result_t<void> transfer_batch(
+        const batch_buffer_t& tx_frames, batch_buffer_t& rx_frames, std::size_t count)
+    requires core::concepts::BatchSpiDevice<TSpi>
+    {
+        if (m_async.busy) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::CHIP_BUSY);
+        }
+
+        const std::size_t bytes{count * rx_tx_buffer_size};
+        const auto tx{std::span{tx_frames}.first(bytes)};
+        const auto rx{std::span{rx_frames}.first(bytes)};
+
+        const uint32_t started{start_instrumented()};
+        const bool success{m_spi_device.transfer_frames(tx, rx, rx_tx_buffer_size, rx_tx_buffer_size)};
+        instrument_transfer(tx, rx, started, success);
+
+        if (!success)
+        {
+            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+        }
+
+        for (std::size_t idx{}; idx < count; ++idx)
+        {
+            record_status(frame(rx_frames, idx)[0]);
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Timestamp taken before a TSpi call (0 when instrumentation is disabled).
+     */
+    [[nodiscard]] uint32_t start_instrumented() const noexcept
+    {
+        if constexpr (TInstrument::enabled)
+        {
+            return m_instrument.now();
+        }
+
+        return 0U;
+    }
+
+    void instrument_transfer(
+        std::span<const uint8_t> tx, std::span<const uint8_t> rx, uint32_t started, bool success) noexcept
+    {
+        if constexpr (TInstrument::enabled)
+        {
+            m_instrument.record(TransferEvent{
+                .tx = tx, .rx = rx, .ticks = m_instrument.now() - started, .success = success});
         }
-        return {};
     }
 };
 
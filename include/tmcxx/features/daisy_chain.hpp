@@ -0,0 +1,305 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : daisy_chain
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_DAISY_CHAIN_HPP
+#define TMCXX_FEATURES_DAISY_CHAIN_HPP
+
+#include "tmcxx/base/concepts.hpp"
+#include "tmcxx/helpers/constants.hpp"
+#include "tmcxx/helpers/error.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Several TMC5160s daisy-chained on one chip select.
+ *
+ * Every frame shifts ChipCount x 40-bit datagrams through the chain (Datasheet 4.3). The first datagram of a frame
+ * ends up in the chip farthest from the MCU, so the slot of chip at @p position is ChipCount - 1 - position for
+ * both directions.
+ *
+ * Each chip is reached through a Channel that satisfies SpiDevice, so a regular TMC5160Bus<Channel> or
+ * TMC5160<Channel> drives it with its own shadow cache. Outside a frame every datagram is sent at once, padded with
+ * NOP reads for the other chips. Between begin_frame() and end_frame() write datagrams are queued per chip and
+ * shifted out column by column: frame k carries the k-th queued datagram of every chip. Issuing the same call on
+ * every axis (e.g. move_to) therefore costs one frame per register instead of one per axis and register, and the
+ * final XTARGET lands on all axes in the same frame.
+ *
+ * A deferred write is acknowledged before it is sent, so the driver's shadow already counts it as written. If a
+ * frame then fails, end_frame() reports the error and every channel whose queued datagrams were dropped is marked
+ * (lost_writes()); its next transfer fails once so the loss also reaches that channel's driver. Invalidate the
+ * shadows of the affected drivers and call discard_lost_writes() (AxisLane does both). The reply of a deferred
+ * write is the previous frame's datagram of that chip, so its SPI status is one frame old.
+ *
+ * @code
+ * DaisyChain<MySpi, 4> chain{spi};
+ * TMC5160<DaisyChain<MySpi, 4>::Channel> x_axis{chain.channel(0), settings};
+ * ...
+ * chain.begin_frame();
+ * x_axis.move_to(1000_steps, 100_rpm);
+ * y_axis.move_to(2000_steps, 100_rpm);
+ * chain.end_frame(); // 3 frames instead of 6
+ * @endcode
+ *
+ * @tparam TSpi SPI device type satisfying SpiDevice concept.
+ * @tparam ChipCount Number of chips in the chain.
+ * @tparam QueueDepth Datagrams queued per chip before the frames are shifted out early.
+ */
+template<core::concepts::SpiDevice TSpi, std::size_t ChipCount, std::size_t QueueDepth = 8U>
+requires(ChipCount > 0U && QueueDepth > 0U)
+class DaisyChain {
+  public:
+    static constexpr std::size_t datagram_size{5ULL};
+    static constexpr std::size_t frame_size{datagram_size * ChipCount};
+
+    /**
+     * @brief Per-chip SPI view.
+     *
+     * select()/deselect() are no-ops; the chain frames the chip select itself.
+     */
+    class Channel {
+      public:
+        Channel(const Channel&) = delete;
+        Channel& operator=(const Channel&) = delete;
+
+        bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, uint32_t timeout_ms)
+        {
+            return m_chain->transfer_slot(m_position, tx_data, rx_data, timeout_ms);
+        }
+
+        void select() noexcept
+        {
+        }
+
+        void deselect() noexcept
+        {
+        }
+
+        /**
+         * @brief Chip position in the chain (0 = first chip after the MCU).
+         */
+        [[nodiscard]] std::size_t position() const noexcept
+        {
+            return m_position;
+        }
+
+      private:
+        friend class DaisyChain;
+
+        Channel() = default;
+
+        DaisyChain* m_chain{};
+        std::size_t m_position{};
+    };
+
+    /**
+     * @brief Construct chain on a physical SPI device.
+     *
+     * @param spi Reference to SPI device (must outlive this object).
+     */
+    explicit DaisyChain(TSpi& spi)
+        : m_spi_device{spi}
+    {
+        for (std::size_t idx{}; idx < ChipCount; ++idx)
+        {
+            m_channels[idx].m_chain = this;
+            m_channels[idx].m_position = idx;
+        }
+    }
+
+    DaisyChain(const DaisyChain&) = delete;
+    DaisyChain& operator=(const DaisyChain&) = delete;
+
+    /**
+     * @brief Get the SPI view of one chip.
+     *
+     * @param position Chip position (0 = first chip after the MCU).
+     */
+    [[nodiscard]] Channel& channel(std::size_t position) noexcept
+    {
+        return m_channels[position];
+    }
+
+    /**
+     * @brief Start queueing write datagrams into shared frames.
+     *
+     * The queues are shifted out early when a chip exceeds QueueDepth or a read is issued, so register order per
+     * chip is always kept.
+     */
+    void begin_frame() noexcept
+    {
+        m_deferring = true;
+        m_frame_failed = false;
+    }
+
+    /**
+     * @brief Shift out the queued datagrams and return to immediate mode.
+     *
+     * @return Result<void>: SPI_TRANSFER_FAILED if this or any early flush since begin_frame() failed.
+     */
+    [[nodiscard]] helpers::result_t<void> end_frame()
+    {
+        m_deferring = false;
+
+        const bool flushed{flush()};
+
+        if (!flushed || std::exchange(m_frame_failed, false)) [[unlikely]]
+        {
+            return tl::make_unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Check whether a failed frame dropped datagrams queued on a chip.
+     *
+     * Set until the chip's next transfer reports it or discard_lost_writes() is called.
+     *
+     * @param position Chip position (0 = first chip after the MCU).
+     */
+    [[nodiscard]] bool lost_writes(std::size_t position) const noexcept
+    {
+        return m_lost[position];
+    }
+
+    /**
+     * @brief Drop the pending loss reports, once the shadows of the affected drivers were invalidated.
+     */
+    void discard_lost_writes() noexcept
+    {
+        m_lost.fill(false);
+    }
+
+    /**
+     * @brief Number of select/deselect frames sent so far.
+     */
+    [[nodiscard]] std::size_t frame_count() const noexcept
+    {
+        return m_frame_count;
+    }
+
+  private:
+    TSpi& m_spi_device;
+    std::array<Channel, ChipCount> m_channels{};
+
+    using datagram_t = std::array<uint8_t, datagram_size>;
+
+    std::array<std::array<datagram_t, QueueDepth>, ChipCount> m_queues{};
+    std::array<std::size_t, ChipCount> m_queue_depth{};
+    std::array<bool, ChipCount> m_lost{};
+
+    std::array<uint8_t, frame_size> m_tx_frame{};
+    std::array<uint8_t, frame_size> m_rx_frame{};
+
+    uint32_t m_timeout_ms{};
+    std::size_t m_frame_count{};
+    bool m_deferring{};
+    bool m_frame_failed{};
+
+    [[nodiscard]] static constexpr std::size_t slot_offset(std::size_t position) noexcept
+    {
+        return (ChipCount - 1U - position) * datagram_size;
+    }
+
+    bool transfer_slot(
+        std::size_t position, std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, uint32_t timeout_ms)
+    {
+        if (tx_data.size() != datagram_size || rx_data.size() != datagram_size) [[unlikely]]
+        {
+            return false;
+        }
+
+        if (m_lost[position]) [[unlikely]]
+        {
+            m_lost[position] = false;
+            return false;
+        }
+
+        m_timeout_ms = timeout_ms;
+
+        const bool is_write{(tx_data[0] & helpers::constant::tmc_write_bit) != 0U};
+        const bool defer{m_deferring && is_write};
+
+        // Reads need their reply now, and a full queue must drain before it can take more.
+        if ((!defer || m_queue_depth[position] == QueueDepth) && !flush()) [[unlikely]]
+        {
+            m_lost[position] = false;
+            return false;
+        }
+
+        std::ranges::copy(tx_data, m_queues[position][m_queue_depth[position]++].begin());
+
+        if (!defer && !flush()) [[unlikely]]
+        {
+            m_lost[position] = false;
+            return false;
+        }
+
+        // Deferred writes get the latest known reply of the chip (status byte of the previous frame).
+        std::ranges::copy(std::span{m_rx_frame}.subspan(slot_offset(position), datagram_size), rx_data.begin());
+        return true;
+    }
+
+    /**
+     * @brief Shift out every queued datagram, column by column; idle slots get a NOP read (GCONF).
+     *
+     * On failure the remaining datagrams are dropped and their chips marked in m_lost.
+     */
+    [[nodiscard]] bool flush()
+    {
+        const std::size_t frames{std::ranges::max(m_queue_depth)};
+        bool success{true};
+
+        for (std::size_t frame{}; frame < frames; ++frame)
+        {
+            for (std::size_t position{}; position < ChipCount; ++position)
+            {
+                const auto slot{std::span{m_tx_frame}.subspan(slot_offset(position), datagram_size)};
+
+                if (frame < m_queue_depth[position])
+                {
+                    std::ranges::copy(m_queues[position][frame], slot.begin());
+                }
+                else
+                {
+                    std::ranges::fill(slot, uint8_t{0U});
+                }
+            }
+
+            m_spi_device.select();
+            success = m_spi_device.transfer(m_tx_frame, m_rx_frame, m_timeout_ms);
+            m_spi_device.deselect();
+
+            ++m_frame_count;
+
+            if (!success) [[unlikely]]
+            {
+                m_frame_failed = true;
+                for (std::size_t position{}; position < ChipCount; ++position)
+                {
+                    m_lost[position] = m_lost[position] || (frame < m_queue_depth[position]);
+                }
+                break;
+            }
+        }
+
+        m_queue_depth.fill(0U);
+
+        return success;
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_DAISY_CHAIN_HPP
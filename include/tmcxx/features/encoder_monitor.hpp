@@ -0,0 +1,175 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : encoder_monitor
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_ENCODER_MONITOR_HPP
+#define TMCXX_FEATURES_ENCODER_MONITOR_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/helpers/error.hpp"
+#include "tmcxx/vendor/expected.hpp"
+
+#include <algorithm>
+#include <cstdint>
+
+namespace tmcxx::features {
+
+/**
+ * @brief One encoder check: commanded and measured position.
+ */
+struct EncoderSample
+{
+    int32_t x_actual{};
+    int32_t x_enc{};
+
+    /**
+     * @brief X_ENC - XACTUAL in microsteps, wrap-around safe; negative when the rotor lags.
+     */
+    int32_t deviation{};
+
+    /**
+     * @brief |deviation| exceeded the threshold.
+     */
+    bool deviated{};
+};
+
+/**
+ * @brief Magnitude of X_ENC - XACTUAL in microsteps, in integer math.
+ *
+ * Both counters wrap at 32 bits, so the difference is taken modulo 2^32; the magnitude is unsigned to stay defined
+ * for INT32_MIN.
+ *
+ * @param x_actual XACTUAL register word.
+ * @param x_enc X_ENC register word.
+ * @return Absolute deviation.
+ */
+[[nodiscard]] constexpr uint32_t encoder_deviation(uint32_t x_actual, uint32_t x_enc) noexcept
+{
+    const uint32_t difference{x_enc - x_actual};
+
+    return ((difference & 0x8000'0000U) != 0U) ? (0U - difference) : difference;
+}
+
+/**
+ * @brief Closed-loop step-loss detection at control-loop rate.
+ *
+ * Each check reads XACTUAL and X_ENC with one pipelined burst (3 datagrams, one transfer_frames() call on batch
+ * devices) and compares them with integer math only. X_ENC must count in XACTUAL units, see
+ * TMC5160::configure_encoder(). A deviation beyond the threshold latches tripped() until clear().
+ *
+ * @code
+ * (void)axis.configure_encoder(4000);
+ * (void)axis.set_encoder_position(0);
+ * EncoderMonitor monitor{axis, 128U}; // half a full step
+ * // control loop:
+ * if (const auto check{monitor.sample()}; check && check->deviated) { (void)axis.stop(); }
+ * @endcode
+ *
+ * @tparam Axis Driver type (e.g. TMC5160<TSpi>).
+ */
+template<typename Axis>
+class EncoderMonitor {
+  public:
+    /**
+     * @brief Construct monitor.
+     *
+     * @param axis Driver to check (must outlive this object).
+     * @param threshold Largest tolerated |X_ENC - XACTUAL| in microsteps.
+     */
+    EncoderMonitor(Axis& axis, uint32_t threshold) noexcept
+        : m_axis{axis}
+        , m_threshold{threshold}
+    {
+    }
+
+    EncoderMonitor(const EncoderMonitor&) = delete;
+    EncoderMonitor& operator=(const EncoderMonitor&) = delete;
+
+    /**
+     * @brief Read both positions and compare them.
+     *
+     * @return Sample, or the read error.
+     */
+    [[nodiscard]] helpers::result_t<EncoderSample> sample()
+    {
+        const auto values{m_axis.template read_registers<chip::tmc5160::XACTUAL, chip::tmc5160::X_ENC>()};
+        if (!values) [[unlikely]]
+        {
+            return tl::unexpected(values.error());
+        }
+
+        const auto [x_actual, x_enc]{*values};
+        const uint32_t magnitude{encoder_deviation(x_actual, x_enc)};
+        const bool deviated{magnitude > m_threshold};
+
+        m_peak = std::max(m_peak, magnitude);
+        if (deviated)
+        {
+            m_tripped = true;
+            ++m_deviations;
+        }
+
+        return EncoderSample{.x_actual = static_cast<int32_t>(x_actual),
+            .x_enc = static_cast<int32_t>(x_enc),
+            .deviation = static_cast<int32_t>(x_enc - x_actual),
+            .deviated = deviated};
+    }
+
+    /**
+     * @brief A check exceeded the threshold since construction or clear().
+     */
+    [[nodiscard]] bool tripped() const noexcept
+    {
+        return m_tripped;
+    }
+
+    /**
+     * @brief Checks that exceeded the threshold since construction or clear().
+     */
+    [[nodiscard]] uint32_t deviation_count() const noexcept
+    {
+        return m_deviations;
+    }
+
+    /**
+     * @brief Largest |deviation| seen since construction or clear().
+     */
+    [[nodiscard]] uint32_t peak_deviation() const noexcept
+    {
+        return m_peak;
+    }
+
+    /**
+     * @brief Reset the latch, the counter and the peak (e.g. after re-homing).
+     */
+    void clear() noexcept
+    {
+        m_tripped = false;
+        m_deviations = 0U;
+        m_peak = 0U;
+    }
+
+    [[nodiscard]] uint32_t threshold() const noexcept
+    {
+        return m_threshold;
+    }
+
+    void set_threshold(uint32_t threshold) noexcept
+    {
+        m_threshold = threshold;
+    }
+
+  private:
+    Axis& m_axis;
+    uint32_t m_threshold{};
+    uint32_t m_peak{};
+    uint32_t m_deviations{};
+    bool m_tripped{};
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_ENCODER_MONITOR_HPP
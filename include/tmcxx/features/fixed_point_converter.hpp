@@ -0,0 +1,238 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : fixed_point_converter
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_FIXED_POINT_CONVERTER_HPP
+#define TMCXX_FEATURES_FIXED_POINT_CONVERTER_HPP
+
+#include "tmcxx/helpers/units.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Integer-only drop-in replacement for Converter.
+ *
+ * Every conversion is a single input x scale product: the scale factors are computed once in the constructor
+ * (make the instance constexpr to fold them at compile time) and stored as 32-bit mantissa + shift, so the
+ * per-call work is one 32x32->64 multiply and a shift. The physical input is turned into a Q-format integer with
+ * one float multiply; the rpm_q16_to_vmax() entry point skips even that.
+ *
+ * Results match Converter to within one register LSB (truncation of a differently rounded product).
+ *
+ * Input formats (saturating, negative inputs clamp to zero):
+ * - velocity Q16.16 rpm, current Q16.16 A, acceleration Q24.8 pps^2, duration Q8.24 s.
+ */
+class FixedPointConverter {
+  public:
+    static constexpr uint8_t rpm_frac_bits{16U};
+    static constexpr uint8_t current_frac_bits{16U};
+    static constexpr uint8_t accel_frac_bits{8U};
+    static constexpr uint8_t duration_frac_bits{24U};
+
+    /**
+     * @brief Construct converter with motor parameters.
+     *
+     * @param f_clk Clock frequency (typically 12 MHz).
+     * @param full_steps Full steps per revolution (typically 200).
+     * @param r_sense_ohm Sense resistor value.
+     */
+    constexpr FixedPointConverter(
+        units::frequency_t f_clk, units::microsteps_t full_steps, units::resistance_t r_sense_ohm)
+    {
+        constexpr double microsteps_per_step{256.0};
+        constexpr double seconds_per_minute{60.0};
+        constexpr double velocity_scale{static_cast<double>(1ULL << 24)};
+        constexpr double accel_scale{static_cast<double>(1ULL << 41)};
+        constexpr double tzerowait_clocks{512.0};
+        constexpr double v_fs{0.325};
+        constexpr double cs_steps{32.0};
+
+        const double clock{f_clk.raw()};
+        const double usteps_per_rev{static_cast<double>(full_steps.raw()) * microsteps_per_step};
+        const double rpm_to_vmax_factor{(usteps_per_rev * velocity_scale) / (seconds_per_minute * clock)};
+        const double i_max_rms{(v_fs / static_cast<double>(r_sense_ohm.raw())) / std::numbers::sqrt2};
+
+        m_rpm_to_vmax = make_scale(rpm_to_vmax_factor);
+        m_vmax_to_rpm = make_scale(1.0 / rpm_to_vmax_factor);
+        m_current_to_cs = make_scale(cs_steps / i_max_rms);
+        m_accel_to_register = make_scale(accel_scale / (clock * clock));
+        m_duration_to_tzerowait = make_scale(clock / tzerowait_clocks);
+    }
+
+    /**
+     * @brief Convert RPM to VMAX register value.
+     *
+     * @param rpm Velocity in revolutions per minute.
+     *
+     * @return VMAX register value.
+     */
+    [[nodiscard]] constexpr uint32_t rpm_to_vmax(units::rpm_t rpm) const noexcept
+    {
+        return rpm_q16_to_vmax(to_fixed<rpm_frac_bits>(rpm.raw()));
+    }
+
+    /**
+     * @brief Convert a Q16.16 RPM value to VMAX without any floating point operation.
+     *
+     * @param rpm_q16 Velocity in 1/65536 rpm.
+     *
+     * @return VMAX register value.
+     */
+    [[nodiscard]] constexpr uint32_t rpm_q16_to_vmax(uint32_t rpm_q16) const noexcept
+    {
+        return saturate(apply<rpm_frac_bits>(m_rpm_to_vmax, rpm_q16));
+    }
+
+    /**
+     * @brief Convert current to CS (current scale) register value.
+     *
+     * @param current Motor current in Amperes.
+     *
+     * @return CS value (0-31).
+     */
+    [[nodiscard]] constexpr uint8_t current_to_cs(units::current_t current) const noexcept
+    {
+        constexpr int64_t low{0};
+        constexpr int64_t high{31};
+
+        const uint32_t current_q16{to_fixed<current_frac_bits>(current.raw())};
+        const auto steps{static_cast<int64_t>(apply<current_frac_bits>(m_current_to_cs, current_q16))};
+
+        return static_cast<uint8_t>(std::clamp(steps - 1, low, high));
+    }
+
+    /**
+     * @brief Convert VMAX register value to RPM.
+     *
+     * @param vmax VMAX register value.
+     *
+     * @return Velocity in RPM.
+     */
+    [[nodiscard]] constexpr units::rpm_t vmax_to_rpm(uint32_t vmax) const noexcept
+    {
+        constexpr auto one{static_cast<float>(1ULL << rpm_frac_bits)};
+
+        return units::rpm_t{static_cast<float>(apply<0U, rpm_frac_bits>(m_vmax_to_rpm, vmax)) / one};
+    }
+
+    /**
+     * @brief Convert acceleration to AMAX/DMAX register value.
+     *
+     * @param accel Acceleration in steps per second squared.
+     *
+     * @return Register value (clamped to 1-65535).
+     */
+    [[nodiscard]] constexpr uint32_t accel_to_register(units::acceleration_t accel) const noexcept
+    {
+        constexpr uint64_t min_val{1U};
+        constexpr uint64_t max_val{65'535U};
+
+        const uint64_t result{apply<accel_frac_bits>(m_accel_to_register, to_fixed<accel_frac_bits>(accel.raw()))};
+
+        return static_cast<uint32_t>(std::clamp(result, min_val, max_val));
+    }
+
+    /**
+     * @brief Convert time duration to TZEROWAIT register value.
+     *
+     * @param duration Wait time in seconds.
+     *
+     * @return TZEROWAIT register value.
+     */
+    [[nodiscard]] constexpr uint32_t duration_to_tzerowait(units::time_duration_t duration) const noexcept
+    {
+        constexpr uint64_t max_val{65'535U};
+
+        const uint64_t result{
+            apply<duration_frac_bits>(m_duration_to_tzerowait, to_fixed<duration_frac_bits>(duration.raw()))};
+
+        return static_cast<uint32_t>(std::min(result, max_val));
+    }
+
+  private:
+    /**
+     * @brief Unsigned scale factor: value = mantissa / 2^shift.
+     */
+    struct Scale
+    {
+        uint32_t mantissa{};
+        uint8_t shift{};
+    };
+
+    Scale m_rpm_to_vmax{};
+    Scale m_vmax_to_rpm{};
+    Scale m_current_to_cs{};
+    Scale m_accel_to_register{};
+    Scale m_duration_to_tzerowait{};
+
+    /**
+     * @brief Normalise a factor to the largest mantissa that fits 32 bits.
+     */
+    [[nodiscard]] static constexpr Scale make_scale(double factor) noexcept
+    {
+        constexpr double mantissa_limit{static_cast<double>(1ULL << 32)};
+        constexpr uint8_t max_shift{48U};
+        constexpr double half{0.5};
+
+        Scale scale{};
+        double scaled{factor};
+
+        while (scale.shift < max_shift && (scaled * 2.0) < mantissa_limit)
+        {
+            scaled *= 2.0;
+            ++scale.shift;
+        }
+
+        scale.mantissa = static_cast<uint32_t>(std::min(scaled + half, mantissa_limit - 1.0));
+        return scale;
+    }
+
+    /**
+     * @brief Multiply a Q(InFrac) input by a scale, returning Q(OutFrac).
+     */
+    template<uint8_t InFrac, uint8_t OutFrac = 0U>
+    [[nodiscard]] static constexpr uint64_t apply(Scale scale, uint32_t input) noexcept
+    {
+        return (uint64_t{input} * scale.mantissa) >> (scale.shift + InFrac - OutFrac);
+    }
+
+    /**
+     * @brief Saturating float to unsigned Q(FracBits) conversion.
+     */
+    template<uint8_t FracBits>
+    [[nodiscard]] static constexpr uint32_t to_fixed(float value) noexcept
+    {
+        constexpr auto one{static_cast<float>(1ULL << FracBits)};
+        constexpr float max_input{static_cast<float>(0xFFFF'FF00U) / one};
+
+        if (!(value > 0.0f))
+        {
+            return 0U;
+        }
+
+        if (value >= max_input)
+        {
+            return std::numeric_limits<uint32_t>::max();
+        }
+
+        return static_cast<uint32_t>(value * one);
+    }
+
+    [[nodiscard]] static constexpr uint32_t saturate(uint64_t value) noexcept
+    {
+        constexpr uint64_t max_val{std::numeric_limits<uint32_t>::max()};
+        return static_cast<uint32_t>(std::min(value, max_val));
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_FIXED_POINT_CONVERTER_HPP
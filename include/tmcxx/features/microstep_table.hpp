@@ -0,0 +1,300 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : microstep_table
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_MICROSTEP_TABLE_HPP
+#define TMCXX_FEATURES_MICROSTEP_TABLE_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/helpers/error.hpp"
+#include "tmcxx/vendor/expected.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <numbers>
+
+namespace tmcxx::detail {
+
+/**
+ * @brief Taylor sine on [0, pi/2], usable in constant evaluation.
+ */
+[[nodiscard]] constexpr double constexpr_sin(double angle) noexcept
+{
+    const double square{angle * angle};
+    double term{angle};
+    double sum{angle};
+
+    for (int power{3}; power < 40; power += 2)
+    {
+        term *= -square / static_cast<double>(power * (power - 1));
+        sum += term;
+    }
+
+    return sum;
+}
+
+} // namespace tmcxx::detail
+
+namespace tmcxx::features {
+
+/**
+ * @brief Differential entries of the microstep table (the first quarter of the wave).
+ */
+inline constexpr std::size_t microstep_table_entries{256U};
+
+/**
+ * @brief Absolute currents of the quarter wave at microsteps 0 ... 256.
+ *
+ * Sample 0 is MSLUTSTART.start_sin, sample 256 MSLUTSTART.start_sin90; table bit i encodes sample i+1 - sample i.
+ */
+using quarter_wave_t = std::array<uint8_t, microstep_table_entries + 1U>;
+
+/**
+ * @brief Register words of a microstep table: MSLUT_0..7, MSLUTSEL, MSLUTSTART.
+ */
+struct MicrostepTable
+{
+    static constexpr std::size_t lut_words{8U};
+    static constexpr std::size_t register_count{lut_words + 2U};
+
+    std::array<uint32_t, lut_words> lut{};
+    uint32_t sel{};
+    uint32_t start{};
+
+    constexpr bool operator==(const MicrostepTable&) const noexcept = default;
+
+    /**
+     * @brief Register addresses in upload order (ascending, 0x60 ... 0x69).
+     */
+    static constexpr std::array<uint8_t, register_count> addresses{[] {
+        std::array<uint8_t, register_count> table{};
+        for (std::size_t idx{}; idx < table.size(); ++idx)
+        {
+            table[idx] = static_cast<uint8_t>(chip::tmc5160::MSLUT_0::address + idx);
+        }
+        return table;
+    }()};
+
+    /**
+     * @brief Register words in the order of addresses.
+     */
+    [[nodiscard]] constexpr std::array<uint32_t, register_count> values() const noexcept
+    {
+        std::array<uint32_t, register_count> words{};
+        std::ranges::copy(lut, words.begin());
+        words[lut_words] = sel;
+        words[lut_words + 1U] = start;
+        return words;
+    }
+
+    /**
+     * @brief Difference to the previous sample that table bit @p entry stands for (-1 ... +3).
+     */
+    [[nodiscard]] constexpr int32_t step(std::size_t entry) const noexcept
+    {
+        namespace regs = chip::tmc5160;
+
+        uint32_t width{regs::MSLUTSEL::w3_t::extract(sel)};
+        if (entry < regs::MSLUTSEL::x1_t::extract(sel))
+        {
+            width = regs::MSLUTSEL::w0_t::extract(sel);
+        }
+        else if (entry < regs::MSLUTSEL::x2_t::extract(sel))
+        {
+            width = regs::MSLUTSEL::w1_t::extract(sel);
+        }
+        else if (entry < regs::MSLUTSEL::x3_t::extract(sel))
+        {
+            width = regs::MSLUTSEL::w2_t::extract(sel);
+        }
+
+        const uint32_t bit{(lut[entry / 32U] >> (entry % 32U)) & 1U};
+        return static_cast<int32_t>(width + bit) - 1;
+    }
+
+    /**
+     * @brief Reconstruct the quarter wave the chip plays, as the inverse of encode_microstep_table().
+     *
+     * @return Samples, the last one accumulated from the table (MSLUTSTART.start_sin90 is separate).
+     */
+    [[nodiscard]] constexpr quarter_wave_t decode() const noexcept
+    {
+        quarter_wave_t wave{};
+        int32_t current{static_cast<int32_t>(chip::tmc5160::MSLUTSTART::start_sin_t::extract(start))};
+
+        wave[0] = static_cast<uint8_t>(current);
+        for (std::size_t entry{}; entry < microstep_table_entries; ++entry)
+        {
+            current += step(entry);
+            wave[entry + 1U] = static_cast<uint8_t>(current);
+        }
+
+        return wave;
+    }
+};
+
+/**
+ * @brief Power-on default table of the chip: a sine wave with amplitude 248.
+ */
+inline constexpr MicrostepTable default_microstep_table{
+    .lut = {0xAAAAB554U, 0x4A9554AAU, 0x24492929U, 0x10104222U, 0xFBFFFFFFU, 0xB5BB777DU, 0x49295556U, 0x00404222U},
+    .sel = 0xFFFF8056U,
+    .start = 0x00F70000U,
+};
+
+/**
+ * @brief Encode a quarter wave as MSLUT words and segment widths.
+ *
+ * Consecutive samples may differ by -1 ... +3; the steps are split greedily into at most four segments whose steps
+ * span two neighbouring values each (MSLUTSEL W0..W3 at X1/X2/X3).
+ *
+ * @param wave Quarter wave samples.
+ * @return Table words; INVALID_PARAMETER if a step is out of range or the wave needs more than four segments.
+ */
+[[nodiscard]] constexpr helpers::result_t<MicrostepTable> encode_microstep_table(const quarter_wave_t& wave) noexcept
+{
+    namespace regs = chip::tmc5160;
+
+    constexpr std::size_t max_segments{4U};
+    constexpr int32_t max_width{3};
+
+    std::array<int32_t, microstep_table_entries> steps{};
+    for (std::size_t entry{}; entry < steps.size(); ++entry)
+    {
+        steps[entry] = static_cast<int32_t>(wave[entry + 1U]) - static_cast<int32_t>(wave[entry]);
+
+        if (steps[entry] < -1 || steps[entry] > max_width) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+    }
+
+    // A segment of width W accepts the steps W - 1 and W; take the width that runs longest from each start.
+    const auto segment_end{[&steps](std::size_t first, int32_t width) {
+        std::size_t entry{first};
+        while (entry < steps.size() && steps[entry] >= width - 1 && steps[entry] <= width)
+        {
+            ++entry;
+        }
+        return entry;
+    }};
+
+    std::array<uint32_t, max_segments> widths{};
+    std::array<uint32_t, max_segments - 1U> firsts{};
+    std::size_t segments{};
+
+    for (std::size_t first{}; first < steps.size(); ++segments)
+    {
+        if (max_segments == segments) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        const int32_t lower{std::max(steps[first], 0)};
+        const int32_t upper{std::min(steps[first] + 1, max_width)};
+        const int32_t width{(segment_end(first, upper) > segment_end(first, lower)) ? upper : lower};
+
+        if (segments > 0U)
+        {
+            firsts[segments - 1U] = static_cast<uint32_t>(first);
+        }
+        widths[segments] = static_cast<uint32_t>(width);
+        first = segment_end(first, width);
+    }
+
+    // Unused segments start at the last entry and keep the width of the segment that covers it.
+    for (std::size_t segment{segments}; segment < max_segments; ++segment)
+    {
+        firsts[segment - 1U] = microstep_table_entries - 1U;
+        widths[segment] = widths[segments - 1U];
+    }
+
+    MicrostepTable table{};
+    for (std::size_t entry{}; entry < steps.size(); ++entry)
+    {
+        std::size_t segment{};
+        while (segment < firsts.size() && entry >= firsts[segment])
+        {
+            ++segment;
+        }
+
+        const auto bit{static_cast<uint32_t>(steps[entry] - (static_cast<int32_t>(widths[segment]) - 1))};
+        table.lut[entry / 32U] |= bit << (entry % 32U);
+    }
+
+    table.sel = regs::MSLUTSEL::w0_t{widths[0]}.value | regs::MSLUTSEL::w1_t{widths[1]}.value |
+                regs::MSLUTSEL::w2_t{widths[2]}.value | regs::MSLUTSEL::w3_t{widths[3]}.value |
+                regs::MSLUTSEL::x1_t{firsts[0]}.value | regs::MSLUTSEL::x2_t{firsts[1]}.value |
+                regs::MSLUTSEL::x3_t{firsts[2]}.value;
+    table.start = regs::MSLUTSTART::start_sin_t{wave.front()}.value |
+                  regs::MSLUTSTART::start_sin90_t{wave.back()}.value;
+
+    return table;
+}
+
+/**
+ * @brief Sample a custom wave shape over the quarter period.
+ *
+ * @code
+ * // Triangular current: constant torque ripple instead of constant current magnitude
+ * constexpr auto triangle{features::sample_quarter_wave([](double phase) { return phase; }, 240U)};
+ * @endcode
+ *
+ * @param shape Callable mapping the phase 0 ... 1 (a quarter period) to 0 ... 1.
+ * @param amplitude Peak table value (the chip's default sine uses 248).
+ * @return Rounded samples, clamped to 0 ... 255.
+ */
+template<typename Shape>
+[[nodiscard]] constexpr quarter_wave_t sample_quarter_wave(Shape shape, uint8_t amplitude) noexcept
+{
+    quarter_wave_t wave{};
+
+    for (std::size_t idx{}; idx < wave.size(); ++idx)
+    {
+        const double phase{static_cast<double>(idx) / static_cast<double>(microstep_table_entries)};
+        const double sample{(static_cast<double>(amplitude) * shape(phase)) + 0.5};
+        wave[idx] = static_cast<uint8_t>(std::clamp(sample, 0.0, 255.0));
+    }
+
+    return wave;
+}
+
+/**
+ * @brief Pure sine quarter wave.
+ *
+ * @param amplitude Peak table value at microstep 256.
+ */
+[[nodiscard]] constexpr quarter_wave_t sine_quarter_wave(uint8_t amplitude = 248U) noexcept
+{
+    return sample_quarter_wave(
+        [](double phase) { return detail::constexpr_sin(phase * std::numbers::pi / 2.0); }, amplitude);
+}
+
+/**
+ * @brief Microstep table of a constant waveform, computed entirely at compile time.
+ *
+ * @code
+ * constexpr auto table{features::make_microstep_table<features::sine_quarter_wave(240U)>()};
+ * (void)motor.load_microstep_table(table);
+ * @endcode
+ *
+ * @tparam Wave Quarter wave samples.
+ * @return Register words; a wave that does not fit the four segments fails to compile.
+ */
+template<quarter_wave_t Wave>
+[[nodiscard]] consteval MicrostepTable make_microstep_table() noexcept
+{
+    constexpr auto table{encode_microstep_table(Wave)};
+    static_assert(table.has_value(), "Waveform steps must stay within -1 ... +3 and fit four MSLUTSEL segments");
+
+    return table.value();
+}
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_MICROSTEP_TABLE_HPP
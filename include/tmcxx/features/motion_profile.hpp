@@ -0,0 +1,73 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : motion_profile
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_MOTION_PROFILE_HPP
+#define TMCXX_FEATURES_MOTION_PROFILE_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/chips/tmc5160_settings.hpp"
+#include "tmcxx/features/register_image.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Registers a Profile sets: currents, ramp velocities and accelerations, in ascending address order.
+ */
+inline constexpr std::array<uint8_t, 9U> profile_registers{chip::tmc5160::IHOLD_IRUN::address,
+    chip::tmc5160::VSTART::address,
+    chip::tmc5160::A1::address,
+    chip::tmc5160::V1::address,
+    chip::tmc5160::AMAX::address,
+    chip::tmc5160::VMAX::address,
+    chip::tmc5160::DMAX::address,
+    chip::tmc5160::D1::address,
+    chip::tmc5160::VSTOP::address};
+
+/**
+ * @brief Precomputed motion/current profile ("fast traverse", "precision", "hold", ...).
+ *
+ * Holds the final register words of the motion and current fields of a Settings struct, so switching profiles
+ * with TMC5160::apply_profile() runs no unit conversion and sends only the registers whose shadow differs.
+ */
+struct Profile
+{
+    std::array<RegisterWrite, profile_registers.size()> writes{};
+
+    constexpr bool operator==(const Profile&) const noexcept = default;
+};
+
+/**
+ * @brief Fold the motion and current fields of Settings into a Profile.
+ *
+ * Uses the same math as compute_register_image(), so a profile built from the Settings a driver was configured
+ * with matches its shadow cache exactly.
+ *
+ * @param settings Driver configuration; clock, steps and sense resistor must match the target driver.
+ * @return Profile.
+ */
+[[nodiscard]] constexpr Profile compute_profile(const chip::tmc5160::Settings& settings) noexcept
+{
+    const register_image_t image{compute_register_image(settings)};
+    Profile profile{};
+
+    for (std::size_t idx{}; idx < profile_registers.size(); ++idx)
+    {
+        const auto entry{std::ranges::find(image, profile_registers[idx], &RegisterWrite::address)};
+        profile.writes[idx] = *entry;
+    }
+
+    return profile;
+}
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_MOTION_PROFILE_HPP
@@ -0,0 +1,295 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : motion_queue
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_MOTION_QUEUE_HPP
+#define TMCXX_FEATURES_MOTION_QUEUE_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/spsc_ring.hpp"
+#include "tmcxx/helpers/error.hpp"
+#include "tmcxx/helpers/units.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+
+namespace tmcxx::features {
+
+/**
+ * @brief One queued motion command, in register units.
+ */
+struct MotionSegment
+{
+    /**
+     * @brief POSITIONING moves to target; VELOCITY_POS / VELOCITY_NEG run at vmax.
+     */
+    chip::tmc5160::RampModeType mode{chip::tmc5160::RampModeType::POSITIONING};
+
+    /**
+     * @brief VMAX register value.
+     */
+    uint32_t vmax{};
+
+    /**
+     * @brief XTARGET in microsteps (POSITIONING only).
+     */
+    int32_t target{};
+
+    [[nodiscard]] constexpr bool is_position() const noexcept
+    {
+        return chip::tmc5160::RampModeType::POSITIONING == mode;
+    }
+};
+
+/**
+ * @brief Per-axis queue of move and velocity segments, refilled from the chip's reached flags.
+ *
+ * poll() runs on the control loop. While a segment is active it costs one status datagram and checks
+ * position_reached (moves) or velocity_reached (velocity segments). Once the flag is set, the next segment's
+ * RAMPMODE (when it changes), VMAX and XTARGET go out in a single commit(), so the axis turns around without the
+ * application round trip of polling XACTUAL and re-issuing move_to().
+ *
+ * With a blend window, a move is retargeted on the fly: when a next segment is already queued and the axis is
+ * within blend_window microsteps of its target, the next segment is sent before arrival. That read costs one
+ * XACTUAL burst (2 transfers) instead of the status datagram. Size the window to about the braking distance so the
+ * axis does not decelerate into the intermediate waypoint.
+ *
+ * push_*() may run on another thread than poll() (the pending segments live in an SpscRing).
+ *
+ * @code
+ * MotionQueue<TMC5160<MySpi>> queue{axis, 200U};
+ * queue.push_move(1000_steps, 120_rpm);
+ * queue.push_move(4000_steps, 200_rpm);
+ * // control loop: (void)queue.poll();
+ * @endcode
+ *
+ * @tparam Axis Driver type (e.g. TMC5160<TSpi>).
+ * @tparam Depth Pending segment capacity (power of two).
+ */
+template<typename Axis, std::size_t Depth = 8U>
+class MotionQueue {
+  public:
+    /**
+     * @brief Construct queue.
+     *
+     * @param axis Driver to command (must outlive this object).
+     * @param blend_window Remaining distance in microsteps at which a queued move is sent early (0 = on arrival).
+     */
+    explicit MotionQueue(Axis& axis, uint32_t blend_window = 0U) noexcept
+        : m_axis{axis}
+        , m_blend_window{blend_window}
+    {
+    }
+
+    MotionQueue(const MotionQueue&) = delete;
+    MotionQueue& operator=(const MotionQueue&) = delete;
+
+    /**
+     * @brief Queue an absolute move.
+     *
+     * @param target Target position.
+     * @param max_speed VMAX of the move.
+     * @return False if the queue is full.
+     */
+    [[nodiscard]] bool push_move(units::microsteps_t target, units::rpm_t max_speed) noexcept
+    {
+        return push(MotionSegment{.mode = chip::tmc5160::RampModeType::POSITIONING,
+            .vmax = m_axis.converter().rpm_to_vmax(max_speed),
+            .target = target.raw()});
+    }
+
+    /**
+     * @brief Queue a velocity segment; it completes once the axis runs at the requested speed.
+     *
+     * @param velocity Target velocity (negative = reverse).
+     * @return False if the queue is full.
+     */
+    [[nodiscard]] bool push_velocity(units::rpm_t velocity) noexcept
+    {
+        constexpr float zero_val{0.f};
+        const bool reverse{velocity.raw() < zero_val};
+
+        return push(MotionSegment{
+            .mode = reverse ? chip::tmc5160::RampModeType::VELOCITY_NEG : chip::tmc5160::RampModeType::VELOCITY_POS,
+            .vmax = m_axis.converter().rpm_to_vmax(reverse ? std::negate{}(velocity) : velocity)});
+    }
+
+    /**
+     * @brief Queue a segment in register units.
+     *
+     * @return False if the queue is full.
+     */
+    [[nodiscard]] bool push(const MotionSegment& segment) noexcept
+    {
+        return m_pending.try_push(segment);
+    }
+
+    /**
+     * @brief Service the queue: check the active segment and send the next one when it is done.
+     *
+     * A failed dispatch keeps the segment queued, so the next poll() retries it.
+     *
+     * @return True if a segment was sent, false if nothing changed, or the SPI error.
+     */
+    [[nodiscard]] helpers::result_t<bool> poll()
+    {
+        if (m_active_valid)
+        {
+            const auto done{active_done()};
+            if (!done || !*done)
+            {
+                return done;
+            }
+
+            m_active_valid = false;
+            ++m_completed;
+        }
+
+        return dispatch_next();
+    }
+
+    /**
+     * @brief Drop every pending segment and stop the axis (VMAX = 0). Consumer side, like poll().
+     *
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> stop()
+    {
+        MotionSegment dropped{};
+        while (m_pending.try_pop(dropped))
+        {
+        }
+
+        m_next_valid = false;
+        m_active_valid = false;
+
+        return m_axis.stop();
+    }
+
+    /**
+     * @brief Segment currently executed by the chip, nullptr when idle.
+     */
+    [[nodiscard]] const MotionSegment* active() const noexcept
+    {
+        return m_active_valid ? &m_active : nullptr;
+    }
+
+    /**
+     * @brief Number of segments waiting behind the active one.
+     */
+    [[nodiscard]] std::size_t pending() const noexcept
+    {
+        return m_pending.size() + (m_next_valid ? 1U : 0U);
+    }
+
+    /**
+     * @brief Number of segments finished since construction.
+     */
+    [[nodiscard]] std::size_t completed() const noexcept
+    {
+        return m_completed;
+    }
+
+  private:
+    Axis& m_axis;
+    uint32_t m_blend_window{};
+
+    SpscRing<MotionSegment, Depth> m_pending{};
+
+    /**
+     * @brief Lookahead slot: the oldest pending segment, popped early so the blend check can see it.
+     */
+    MotionSegment m_next{};
+    bool m_next_valid{};
+
+    MotionSegment m_active{};
+    bool m_active_valid{};
+
+    chip::tmc5160::RampModeType m_written_mode{};
+    bool m_mode_known{};
+
+    std::size_t m_completed{};
+
+    bool fetch_next() noexcept
+    {
+        if (!m_next_valid)
+        {
+            m_next_valid = m_pending.try_pop(m_next);
+        }
+
+        return m_next_valid;
+    }
+
+    [[nodiscard]] helpers::result_t<bool> active_done()
+    {
+        if (m_active.is_position() && 0U != m_blend_window && fetch_next())
+        {
+            const auto position{m_axis.template read_registers<chip::tmc5160::XACTUAL>()};
+            if (!position) [[unlikely]]
+            {
+                return tl::unexpected(position.error());
+            }
+
+            const auto actual{static_cast<int32_t>((*position)[0])};
+            const auto remaining{std::abs(static_cast<int64_t>(m_active.target) - actual)};
+
+            return remaining <= static_cast<int64_t>(m_blend_window) || m_axis.last_status().position_reached();
+        }
+
+        const auto status{m_axis.poll_status()};
+        if (!status) [[unlikely]]
+        {
+            return tl::unexpected(status.error());
+        }
+
+        return m_active.is_position() ? status->position_reached() : status->velocity_reached();
+    }
+
+    [[nodiscard]] helpers::result_t<bool> dispatch_next()
+    {
+        if (!fetch_next())
+        {
+            return false;
+        }
+
+        const bool mode_changes{!m_mode_known || m_written_mode != m_next.mode};
+
+        m_axis.begin_transaction();
+
+        if (mode_changes)
+        {
+            (void)m_axis.template write_register<chip::tmc5160::RAMPMODE>(static_cast<uint32_t>(m_next.mode));
+        }
+
+        (void)m_axis.template write_register<chip::tmc5160::VMAX>(m_next.vmax);
+
+        if (m_next.is_position())
+        {
+            (void)m_axis.template write_register<chip::tmc5160::XTARGET>(static_cast<uint32_t>(m_next.target));
+        }
+
+        if (const auto res{m_axis.commit()}; !res) [[unlikely]]
+        {
+            m_mode_known = false;
+            return tl::unexpected(res.error());
+        }
+
+        m_written_mode = m_next.mode;
+        m_mode_known = true;
+
+        m_active = m_next;
+        m_active_valid = true;
+        m_next_valid = false;
+
+        return true;
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_MOTION_QUEUE_HPP
@@ -0,0 +1,115 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : motion_snapshot
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_MOTION_SNAPSHOT_HPP
+#define TMCXX_FEATURES_MOTION_SNAPSHOT_HPP
+
+#include "tmcxx/base/concepts.hpp"
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/helpers/units.hpp"
+
+#include <concepts>
+#include <cstdint>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Sign-extend the 24-bit VACTUAL register value.
+ *
+ * @param raw VACTUAL register value.
+ * @return Signed velocity in VMAX register units.
+ */
+[[nodiscard]] constexpr int32_t sign_extend_vactual(uint32_t raw) noexcept
+{
+    constexpr uint32_t vactual_sign_bit{0x80'0000U};
+    constexpr uint32_t vactual_sign_extension{0xFF00'0000U};
+
+    return static_cast<int32_t>(((raw & vactual_sign_bit) != 0U) ? (raw | vactual_sign_extension) : raw);
+}
+
+/**
+ * @brief Position, velocity and status of one axis, captured with a single pipelined burst.
+ *
+ * Values are kept in register units; unit conversion only happens when asked for.
+ */
+struct MotionSnapshot
+{
+    /**
+     * @brief XACTUAL in microsteps.
+     */
+    int32_t position{};
+
+    /**
+     * @brief Signed VACTUAL, in VMAX register units (negative = reverse).
+     */
+    int32_t velocity{};
+
+    /**
+     * @brief RAMP_STAT register value (decode with RAMP_STAT::*_t::extract()).
+     */
+    uint32_t ramp_status{};
+
+    /**
+     * @brief SPI status byte of the last datagram of the burst.
+     */
+    chip::tmc5160::SpiStatus spi_status{};
+
+    /**
+     * @brief Build a snapshot from raw register values.
+     *
+     * @param xactual XACTUAL register value.
+     * @param vactual VACTUAL register value (24-bit two's complement).
+     * @param ramp_stat RAMP_STAT register value.
+     * @param status SPI status byte received with the values.
+     */
+    [[nodiscard]] static constexpr MotionSnapshot from_registers(
+        uint32_t xactual, uint32_t vactual, uint32_t ramp_stat, chip::tmc5160::SpiStatus status) noexcept
+    {
+        return MotionSnapshot{.position = static_cast<int32_t>(xactual),
+            .velocity = sign_extend_vactual(vactual),
+            .ramp_status = ramp_stat,
+            .spi_status = status};
+    }
+
+    /**
+     * @brief Position as a strong type.
+     */
+    [[nodiscard]] constexpr units::microsteps_t position_steps() const noexcept
+    {
+        return units::microsteps_t{position};
+    }
+
+    /**
+     * @brief Signed velocity in RPM.
+     *
+     * @param converter Unit converter of the axis.
+     */
+    template<core::concepts::UnitConverter TConverter>
+    [[nodiscard]] constexpr units::rpm_t velocity_rpm(const TConverter& converter) const noexcept
+    {
+        const auto magnitude{static_cast<uint32_t>((velocity < 0) ? -static_cast<int64_t>(velocity) : velocity)};
+        const auto rpm{converter.vmax_to_rpm(magnitude)};
+
+        return (velocity < 0) ? units::rpm_t{-rpm.raw()} : rpm;
+    }
+
+    /**
+     * @brief Check a RAMP_STAT flag.
+     *
+     * @tparam FieldType RAMP_STAT field (e.g. RAMP_STAT::position_reached_t).
+     */
+    template<typename FieldType>
+    requires std::same_as<typename FieldType::register_t, chip::tmc5160::RAMP_STAT>
+    [[nodiscard]] constexpr bool ramp_flag() const noexcept
+    {
+        return FieldType::extract(ramp_status) != 0U;
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_MOTION_SNAPSHOT_HPP
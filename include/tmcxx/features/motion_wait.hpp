@@ -0,0 +1,252 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : motion_wait
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_MOTION_WAIT_HPP
+#define TMCXX_FEATURES_MOTION_WAIT_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/helpers/error.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <concepts>
+#include <coroutine>
+#include <cstdint>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Axis state a wait can block on; each maps to one SPI status flag.
+ */
+enum class WaitCondition : uint8_t {
+    POSITION_REACHED, // RAMP_STAT.position_reached
+    VELOCITY_REACHED, // RAMP_STAT.velocity_reached
+    STANDSTILL,       // DRV_STATUS.stst
+    STALL             // DRV_STATUS.stallGuard
+};
+
+/**
+ * @brief Check a wait condition against an SPI status byte.
+ */
+[[nodiscard]] constexpr bool is_satisfied(WaitCondition condition, chip::tmc5160::SpiStatus status) noexcept
+{
+    switch (condition)
+    {
+        case WaitCondition::POSITION_REACHED:
+            return status.position_reached();
+        case WaitCondition::VELOCITY_REACHED:
+            return status.velocity_reached();
+        case WaitCondition::STANDSTILL:
+            return status.standstill();
+        case WaitCondition::STALL:
+            return status.stallguard();
+    }
+    return false;
+}
+
+/**
+ * @brief Clock and sleep of blocking waits.
+ *
+ * now() returns a free-running tick count (wrap-around allowed, e.g. microseconds). wait() sleeps for up to the
+ * given ticks and returns early when an event is signalled (e.g. from the DIAG pin interrupt), so a wait wakes
+ * without polling through its back-off.
+ */
+template<typename T>
+concept WaitPolicy = requires(T policy, uint32_t ticks) {
+    { policy.now() } -> std::same_as<uint32_t>;
+    { policy.wait(ticks) } -> std::same_as<void>;
+};
+
+/**
+ * @brief Timer callback of an asynchronous wait.
+ */
+using wait_callback_t = void (*)(void* context);
+
+/**
+ * @brief Clock and one-shot timer of coroutine waits (event loop, RTOS timer service, ...).
+ *
+ * schedule() runs @p callback once after up to the given ticks, earlier when an event is signalled. Only one
+ * timer per awaiting coroutine is pending at a time.
+ */
+template<typename T>
+concept AsyncWaitPolicy = requires(T policy, uint32_t ticks, wait_callback_t callback, void* context) {
+    { policy.now() } -> std::same_as<uint32_t>;
+    { policy.schedule(ticks, callback, context) } -> std::same_as<void>;
+};
+
+/**
+ * @brief Poll interval of a wait: starts at initial and doubles after every miss, up to max (ticks).
+ */
+struct Backoff
+{
+    uint32_t initial{100U};
+    uint32_t max{10'000U};
+
+    [[nodiscard]] constexpr uint32_t next(uint32_t current) const noexcept
+    {
+        return (current >= max / 2U) ? max : current * 2U;
+    }
+};
+
+/**
+ * @brief Block until a status condition holds or the timeout elapses.
+ *
+ * Every poll is one status datagram (poll_status()); between polls the policy sleeps for the back-off interval,
+ * clipped to the time left.
+ *
+ * @param axis Driver providing poll_status().
+ * @param condition Condition to wait for.
+ * @param timeout Timeout in policy ticks (0 = check once).
+ * @param policy Clock and sleep.
+ * @param backoff Poll interval.
+ * @return Success, ErrorCode::TIMEOUT, or the SPI error.
+ */
+template<typename Axis, WaitPolicy Policy>
+[[nodiscard]] helpers::result_t<void> wait_until(
+    Axis& axis, WaitCondition condition, uint32_t timeout, Policy& policy, Backoff backoff = {})
+{
+    const uint32_t start{policy.now()};
+    uint32_t delay{backoff.initial};
+
+    while (true)
+    {
+        const auto status{axis.poll_status()};
+        if (!status) [[unlikely]]
+        {
+            return tl::unexpected(status.error());
+        }
+
+        if (is_satisfied(condition, *status))
+        {
+            return {};
+        }
+
+        const uint32_t elapsed{policy.now() - start};
+        if (elapsed >= timeout)
+        {
+            return tl::unexpected(helpers::ErrorCode::TIMEOUT);
+        }
+
+        policy.wait(std::min(delay, timeout - elapsed));
+        delay = backoff.next(delay);
+    }
+}
+
+/**
+ * @brief Awaitable equivalent of wait_until().
+ *
+ * await_ready() polls once, so a condition that already holds never suspends. Otherwise every retry runs from
+ * the policy's timer callback and the coroutine is resumed from the callback that finishes the wait. Resumption
+ * and suspension race on one atomic flag, like the communicator's AsyncAccess.
+ *
+ * @code
+ * const auto reached{co_await motor.async_wait_until(WaitCondition::POSITION_REACHED, 2'000'000U, timers)};
+ * @endcode
+ */
+template<typename Axis, AsyncWaitPolicy Policy>
+class [[nodiscard]] WaitAwaiter {
+  public:
+    WaitAwaiter(Axis& axis, WaitCondition condition, uint32_t timeout, Policy& policy, Backoff backoff) noexcept
+        : m_axis{axis}
+        , m_policy{policy}
+        , m_backoff{backoff}
+        , m_timeout{timeout}
+        , m_delay{backoff.initial}
+        , m_condition{condition}
+    {
+    }
+
+    WaitAwaiter(const WaitAwaiter&) = delete;
+    WaitAwaiter& operator=(const WaitAwaiter&) = delete;
+
+    [[nodiscard]] bool await_ready()
+    {
+        m_start = m_policy.now();
+        return check();
+    }
+
+    bool await_suspend(std::coroutine_handle<> handle)
+    {
+        m_handle = handle;
+        schedule();
+
+        return !m_arrived.exchange(true);
+    }
+
+    [[nodiscard]] helpers::result_t<void> await_resume() const noexcept
+    {
+        return m_result;
+    }
+
+  private:
+    Axis& m_axis;
+    Policy& m_policy;
+    Backoff m_backoff{};
+    uint32_t m_timeout{};
+    uint32_t m_start{};
+    uint32_t m_delay{};
+    WaitCondition m_condition{};
+
+    std::coroutine_handle<> m_handle{};
+    helpers::result_t<void> m_result{};
+    std::atomic<bool> m_arrived{};
+
+    /**
+     * @brief Poll once; true when the wait is over (condition met, timed out or failed) and m_result is final.
+     */
+    [[nodiscard]] bool check()
+    {
+        const auto status{m_axis.poll_status()};
+        if (!status) [[unlikely]]
+        {
+            m_result = tl::unexpected(status.error());
+            return true;
+        }
+
+        if (is_satisfied(m_condition, *status))
+        {
+            return true;
+        }
+
+        if ((m_policy.now() - m_start) >= m_timeout)
+        {
+            m_result = tl::unexpected(helpers::ErrorCode::TIMEOUT);
+            return true;
+        }
+
+        return false;
+    }
+
+    void schedule()
+    {
+        const uint32_t elapsed{m_policy.now() - m_start};
+        const uint32_t remaining{(elapsed < m_timeout) ? m_timeout - elapsed : 0U};
+
+        m_policy.schedule(std::min(m_delay, remaining), &WaitAwaiter::on_timer, this);
+        m_delay = m_backoff.next(m_delay);
+    }
+
+    static void on_timer(void* context)
+    {
+        auto* self{static_cast<WaitAwaiter*>(context)};
+
+        if (!self->check())
+        {
+            self->schedule();
+            return;
+        }
+
+        if (self->m_arrived.exchange(true))
+        {
+            self->m_handle.resume();
+        }
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_MOTION_WAIT_HPP
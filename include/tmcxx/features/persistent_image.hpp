@@ -0,0 +1,359 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : persistent_image
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_PERSISTENT_IMAGE_HPP
+#define TMCXX_FEATURES_PERSISTENT_IMAGE_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/register_image.hpp"
+#include "tmcxx/helpers/error.hpp"
+#include "tmcxx/vendor/expected.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <span>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Binary register image for flash or a file, version 1.
+ *
+ * Layout, multi-byte fields big endian like the SPI datagrams:
+ *
+ * | Offset | Size | Field                                               |
+ * |--------|------|-----------------------------------------------------|
+ * | 0      | 4    | Magic "TMCI"                                        |
+ * | 4      | 1    | Format version                                      |
+ * | 5      | 1    | Reserved, 0                                         |
+ * | 6      | 2    | Entry count                                         |
+ * | 8      | 4    | CRC-32 (IEEE) of every byte except this field       |
+ * | 12     | 5 n  | Entries: register address, 32-bit register word     |
+ *
+ * Entries are kept in ascending address order, the order commit() flushes in.
+ */
+namespace image_format {
+
+inline constexpr std::array<uint8_t, 4> magic{'T', 'M', 'C', 'I'};
+inline constexpr uint8_t version{1U};
+inline constexpr std::size_t header_size{12U};
+inline constexpr std::size_t entry_size{5U};
+inline constexpr std::size_t max_entries{chip::tmc5160::ShadowLayout::slot_count};
+
+inline constexpr std::size_t version_offset{4U};
+inline constexpr std::size_t count_offset{6U};
+inline constexpr std::size_t crc_offset{8U};
+
+/**
+ * @brief Bytes of an image with @p entries registers.
+ */
+[[nodiscard]] constexpr std::size_t image_size(std::size_t entries) noexcept
+{
+    return header_size + (entries * entry_size);
+}
+
+/**
+ * @brief CRC-32 (IEEE 802.3, reflected 0xEDB88320), chainable over several spans.
+ *
+ * @param data Bytes to checksum.
+ * @param crc Result of the previous span, 0 for the first one.
+ * @return CRC-32.
+ */
+[[nodiscard]] constexpr uint32_t crc32(std::span<const uint8_t> data, uint32_t crc = 0U) noexcept
+{
+    constexpr std::array<uint32_t, 256> table{[] {
+        std::array<uint32_t, 256> entries{};
+        for (uint32_t idx{}; idx < entries.size(); ++idx)
+        {
+            uint32_t value{idx};
+            for (int bit{}; bit < 8; ++bit)
+            {
+                value = ((value & 1U) != 0U) ? (0xEDB88320U ^ (value >> 1U)) : (value >> 1U);
+            }
+            entries[idx] = value;
+        }
+        return entries;
+    }()};
+
+    crc = ~crc;
+    for (const uint8_t byte: data)
+    {
+        crc = table[(crc ^ byte) & 0xFFU] ^ (crc >> 8U);
+    }
+    return ~crc;
+}
+
+[[nodiscard]] constexpr uint32_t load_be32(std::span<const uint8_t> bytes) noexcept
+{
+    return (static_cast<uint32_t>(bytes[0]) << 24U) | (static_cast<uint32_t>(bytes[1]) << 16U) |
+           (static_cast<uint32_t>(bytes[2]) << 8U) | static_cast<uint32_t>(bytes[3]);
+}
+
+constexpr void store_be32(std::span<uint8_t> bytes, uint32_t value) noexcept
+{
+    for (std::size_t idx{}; idx < 4U; ++idx)
+    {
+        bytes[idx] = static_cast<uint8_t>(value >> (8U * (3U - idx)));
+    }
+}
+
+/**
+ * @brief CRC of an image: header up to the CRC field, then the entries.
+ */
+[[nodiscard]] constexpr uint32_t image_crc(std::span<const uint8_t> image) noexcept
+{
+    return crc32(image.subspan(header_size), crc32(image.first(crc_offset)));
+}
+
+} // namespace image_format
+
+/**
+ * @brief Serialize register writes into @p out.
+ *
+ * @param writes Register words in ascending address order, restorable registers only (what dump_image() emits).
+ * @param out Destination, at least image_format::image_size(writes.size()) bytes.
+ * @return Bytes written; INVALID_PARAMETER if @p out is too small or the order is wrong, REGISTER_ACCESS_FAILED for
+ * an address that is not restorable (read-only, volatile like XACTUAL or RAMP_STAT, or a trigger like XTARGET).
+ */
+[[nodiscard]] constexpr helpers::result_t<std::size_t> write_register_image(
+    std::span<const RegisterWrite> writes, std::span<uint8_t> out) noexcept
+{
+    namespace fmt = image_format;
+
+    const std::size_t size{fmt::image_size(writes.size())};
+
+    if (writes.size() > fmt::max_entries || out.size() < size) [[unlikely]]
+    {
+        return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+    }
+
+    for (std::size_t idx{}; idx < writes.size(); ++idx)
+    {
+        if (!chip::tmc5160::ShadowLayout::is_restorable(writes[idx].address)) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+        }
+
+        if (idx > 0U && writes[idx].address <= writes[idx - 1U].address) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+    }
+
+    const auto image{out.first(size)};
+    std::ranges::copy(fmt::magic, image.begin());
+    image[fmt::version_offset] = fmt::version;
+    image[fmt::version_offset + 1U] = 0U;
+    image[fmt::count_offset] = static_cast<uint8_t>(writes.size() >> 8U);
+    image[fmt::count_offset + 1U] = static_cast<uint8_t>(writes.size());
+
+    for (std::size_t idx{}; idx < writes.size(); ++idx)
+    {
+        const auto entry{image.subspan(fmt::header_size + (idx * fmt::entry_size), fmt::entry_size)};
+        entry[0] = writes[idx].address;
+        fmt::store_be32(entry.subspan(1U), writes[idx].value);
+    }
+
+    fmt::store_be32(image.subspan(fmt::crc_offset), fmt::image_crc(image));
+
+    return size;
+}
+
+/**
+ * @brief Binary image of a register image, computed at compile time for a constant.
+ *
+ * @code
+ * constexpr auto blob{features::encode_register_image(features::make_register_image<config>())};
+ * @endcode
+ *
+ * Entries that are not restorable, like the XACTUAL and XTARGET of a settings image, are left out: the image holds
+ * configuration only, and the bytes they would have taken stay zero padding after the last entry.
+ *
+ * @param writes Register words in ascending address order.
+ * @return Image bytes; all zero (rejected by RegisterImageView::parse) if @p writes is not a valid image.
+ */
+template<std::size_t N>
+[[nodiscard]] constexpr std::array<uint8_t, image_format::image_size(N)> encode_register_image(
+    const std::array<RegisterWrite, N>& writes) noexcept
+{
+    std::array<uint8_t, image_format::image_size(N)> image{};
+    std::array<RegisterWrite, N> restorable{};
+    std::size_t count{};
+
+    for (const auto& write: writes)
+    {
+        if (chip::tmc5160::ShadowLayout::is_restorable(write.address))
+        {
+            restorable[count++] = write;
+        }
+    }
+
+    if (!write_register_image(std::span{restorable}.first(count), image)) [[unlikely]]
+    {
+        image.fill(0U);
+    }
+
+    return image;
+}
+
+/**
+ * @brief Validated, non-owning view of a binary register image in flash, RAM or a memory-mapped file.
+ *
+ * Entries are decoded on access straight from the underlying bytes; nothing is copied.
+ */
+class RegisterImageView {
+  public:
+    /**
+     * @brief Forward iterator yielding RegisterWrite values.
+     */
+    class Iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = RegisterWrite;
+        using difference_type = std::ptrdiff_t;
+
+        constexpr Iterator() = default;
+
+        constexpr Iterator(const RegisterImageView* view, std::size_t index) noexcept
+            : m_view{view}
+            , m_index{index}
+        {
+        }
+
+        [[nodiscard]] constexpr RegisterWrite operator*() const noexcept
+        {
+            return (*m_view)[m_index];
+        }
+
+        constexpr Iterator& operator++() noexcept
+        {
+            ++m_index;
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) noexcept
+        {
+            Iterator previous{*this};
+            ++m_index;
+            return previous;
+        }
+
+        constexpr bool operator==(const Iterator& other) const noexcept
+        {
+            return m_index == other.m_index;
+        }
+
+      private:
+        const RegisterImageView* m_view{};
+        std::size_t m_index{};
+    };
+
+    constexpr RegisterImageView() = default;
+
+    /**
+     * @brief Validate @p bytes as a register image.
+     *
+     * Checks magic, version, size, CRC, ascending order and that every address is restorable, so an image can never
+     * start a move (XTARGET) or overwrite the position (XACTUAL); trailing bytes after the last entry (flash page
+     * padding) are ignored.
+     *
+     * @param bytes Image bytes; must outlive the view.
+     * @return View; INVALID_PARAMETER for a corrupt or foreign image, NOT_IMPLEMENTED for an unknown version,
+     * REGISTER_ACCESS_FAILED for an entry that is not restorable.
+     */
+    [[nodiscard]] static constexpr helpers::result_t<RegisterImageView> parse(std::span<const uint8_t> bytes) noexcept
+    {
+        namespace fmt = image_format;
+
+        if (bytes.size() < fmt::header_size || !std::ranges::equal(bytes.first(fmt::magic.size()), fmt::magic))
+            [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        if (fmt::version != bytes[fmt::version_offset]) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::NOT_IMPLEMENTED);
+        }
+
+        const std::size_t count{(static_cast<std::size_t>(bytes[fmt::count_offset]) << 8U) |
+                                bytes[fmt::count_offset + 1U]};
+
+        if (count > fmt::max_entries || bytes.size() < fmt::image_size(count)) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        const auto image{bytes.first(fmt::image_size(count))};
+
+        if (fmt::load_be32(image.subspan(fmt::crc_offset)) != fmt::image_crc(image)) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        const RegisterImageView view{image.subspan(fmt::header_size), count};
+
+        for (std::size_t idx{}; idx < count; ++idx)
+        {
+            const uint8_t address{view[idx].address};
+
+            if (!chip::tmc5160::ShadowLayout::is_restorable(address)) [[unlikely]]
+            {
+                return tl::unexpected(helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+            }
+
+            if (idx > 0U && address <= view[idx - 1U].address) [[unlikely]]
+            {
+                return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+            }
+        }
+
+        return view;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return m_count;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return 0U == m_count;
+    }
+
+    [[nodiscard]] constexpr RegisterWrite operator[](std::size_t index) const noexcept
+    {
+        const auto entry{m_entries.subspan(index * image_format::entry_size, image_format::entry_size)};
+        return RegisterWrite{entry[0], image_format::load_be32(entry.subspan(1U))};
+    }
+
+    [[nodiscard]] constexpr Iterator begin() const noexcept
+    {
+        return Iterator{this, 0U};
+    }
+
+    [[nodiscard]] constexpr Iterator end() const noexcept
+    {
+        return Iterator{this, m_count};
+    }
+
+  private:
+    constexpr RegisterImageView(std::span<const uint8_t> entries, std::size_t count) noexcept
+        : m_entries{entries}
+        , m_count{count}
+    {
+    }
+
+    std::span<const uint8_t> m_entries{};
+    std::size_t m_count{};
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_PERSISTENT_IMAGE_HPP
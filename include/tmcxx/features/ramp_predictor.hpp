@@ -0,0 +1,413 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : ramp_predictor
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_RAMP_PREDICTOR_HPP
+#define TMCXX_FEATURES_RAMP_PREDICTOR_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/converter.hpp"
+#include "tmcxx/features/motion_profile.hpp"
+#include "tmcxx/helpers/units.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace tmcxx::detail {
+
+/**
+ * @brief Newton square root usable in constant evaluation.
+ */
+[[nodiscard]] constexpr double constexpr_sqrt(double value) noexcept
+{
+    if (value <= 0.0)
+    {
+        return 0.0;
+    }
+
+    double root{(value >= 1.0) ? value : 1.0};
+    for (int iteration{}; iteration < 128; ++iteration)
+    {
+        const double next{0.5 * (root + (value / root))};
+        if (next >= root)
+        {
+            break;
+        }
+        root = next;
+    }
+
+    return root;
+}
+
+} // namespace tmcxx::detail
+
+namespace tmcxx::features {
+
+/**
+ * @brief Ramp generator registers of a positioning move (the six-point ramp).
+ */
+struct RampRegisters
+{
+    uint32_t v_start{};
+    uint32_t a_1{};
+    uint32_t v_1{};
+    uint32_t a_max{};
+    uint32_t v_max{};
+    uint32_t d_max{};
+    uint32_t d_1{};
+    uint32_t v_stop{};
+
+    constexpr bool operator==(const RampRegisters&) const noexcept = default;
+
+    /**
+     * @brief Collect the ramp registers of a precomputed profile.
+     *
+     * @param profile Profile as returned by compute_profile().
+     * @return Ramp registers.
+     */
+    [[nodiscard]] static constexpr RampRegisters from_profile(const Profile& profile) noexcept
+    {
+        namespace regs = chip::tmc5160;
+
+        RampRegisters ramp{};
+        for (const auto& entry: profile.writes)
+        {
+            switch (entry.address)
+            {
+                case regs::VSTART::address:
+                    ramp.v_start = entry.value;
+                    break;
+                case regs::A1::address:
+                    ramp.a_1 = entry.value;
+                    break;
+                case regs::V1::address:
+                    ramp.v_1 = entry.value;
+                    break;
+                case regs::AMAX::address:
+                    ramp.a_max = entry.value;
+                    break;
+                case regs::VMAX::address:
+                    ramp.v_max = entry.value;
+                    break;
+                case regs::DMAX::address:
+                    ramp.d_max = entry.value;
+                    break;
+                case regs::D1::address:
+                    ramp.d_1 = entry.value;
+                    break;
+                case regs::VSTOP::address:
+                    ramp.v_stop = entry.value;
+                    break;
+                default:
+                    break;
+            }
+        }
+
+        return ramp;
+    }
+};
+
+/**
+ * @brief One constant-acceleration phase of a predicted move; speeds in microsteps/s, magnitudes only.
+ */
+struct RampPhase
+{
+    double duration{};
+    double start_velocity{};
+    double acceleration{};
+
+    [[nodiscard]] constexpr double end_velocity() const noexcept
+    {
+        return start_velocity + (acceleration * duration);
+    }
+
+    [[nodiscard]] constexpr double distance() const noexcept
+    {
+        return (start_velocity * duration) + (0.5 * acceleration * duration * duration);
+    }
+
+    /**
+     * @brief Time into the phase at which @p travelled microsteps are covered.
+     */
+    [[nodiscard]] constexpr double time_at(double travelled) const noexcept
+    {
+        if (0.0 == acceleration)
+        {
+            return (start_velocity > 0.0) ? std::min(duration, travelled / start_velocity) : duration;
+        }
+
+        const double discriminant{(start_velocity * start_velocity) + (2.0 * acceleration * travelled)};
+        return std::clamp((detail::constexpr_sqrt(discriminant) - start_velocity) / acceleration, 0.0, duration);
+    }
+};
+
+/**
+ * @brief Predicted course of a positioning move: phases from VSTART to VSTOP on the target.
+ *
+ * Times are relative to the XTARGET write, positions relative to the start position; both carry the sign of the
+ * move. Everything is constexpr, so a schedule can be planned at compile time.
+ *
+ * @code
+ * constexpr auto move{predict_move(RampRegisters::from_profile(fast), converter, 51'200_steps)};
+ * sleep_for(move.duration() - 5_ms); // then poll for position_reached
+ * @endcode
+ */
+class RampPrediction {
+  public:
+    static constexpr std::size_t max_phases{5U};
+
+    constexpr RampPrediction() = default;
+
+    /**
+     * @brief Time from the XTARGET write to standstill on the target.
+     */
+    [[nodiscard]] constexpr units::time_duration_t duration() const noexcept
+    {
+        double total{};
+        for (const auto& phase: phases())
+        {
+            total += phase.duration;
+        }
+        return units::time_duration_t{static_cast<float>(total)};
+    }
+
+    /**
+     * @brief Highest speed reached (magnitude).
+     */
+    [[nodiscard]] constexpr units::pps_t peak_velocity() const noexcept
+    {
+        return units::pps_t{static_cast<float>(m_peak)};
+    }
+
+    /**
+     * @brief True if the move cruises at VMAX, false for a move too short to get there.
+     */
+    [[nodiscard]] constexpr bool reaches_vmax() const noexcept
+    {
+        return m_reaches_vmax;
+    }
+
+    [[nodiscard]] constexpr units::microsteps_t distance() const noexcept
+    {
+        return units::microsteps_t{static_cast<int32_t>(m_direction * m_distance)};
+    }
+
+    /**
+     * @brief Position relative to the start, @p time after the XTARGET write (clamped to the move).
+     */
+    [[nodiscard]] constexpr units::microsteps_t position_at(units::time_duration_t time) const noexcept
+    {
+        double remaining{std::max(0.0, static_cast<double>(time.raw()))};
+        double travelled{};
+
+        for (const auto& phase: phases())
+        {
+            const double step{std::min(remaining, phase.duration)};
+            travelled += (phase.start_velocity * step) + (0.5 * phase.acceleration * step * step);
+            remaining -= step;
+        }
+
+        return units::microsteps_t{static_cast<int32_t>(m_direction * (std::min(travelled, m_distance) + 0.5))};
+    }
+
+    /**
+     * @brief Signed velocity @p time after the XTARGET write; zero before and after the move.
+     */
+    [[nodiscard]] constexpr units::pps_t velocity_at(units::time_duration_t time) const noexcept
+    {
+        double remaining{static_cast<double>(time.raw())};
+
+        if (remaining < 0.0)
+        {
+            return units::pps_t{};
+        }
+
+        for (const auto& phase: phases())
+        {
+            if (remaining < phase.duration)
+            {
+                return units::pps_t{static_cast<float>(m_direction * (phase.start_velocity +
+                                                                      (phase.acceleration * remaining)))};
+            }
+            remaining -= phase.duration;
+        }
+
+        return units::pps_t{};
+    }
+
+    /**
+     * @brief Time at which |@p travelled| microsteps from the start are covered (clamped to the move).
+     */
+    [[nodiscard]] constexpr units::time_duration_t time_at(units::microsteps_t travelled) const noexcept
+    {
+        double left{std::min(static_cast<double>(travelled.raw()) * m_direction, m_distance)};
+        double elapsed{};
+
+        for (const auto& phase: phases())
+        {
+            const double covered{phase.distance()};
+            if (left <= covered)
+            {
+                elapsed += phase.time_at(std::max(0.0, left));
+                return units::time_duration_t{static_cast<float>(elapsed)};
+            }
+            left -= covered;
+            elapsed += phase.duration;
+        }
+
+        return units::time_duration_t{static_cast<float>(elapsed)};
+    }
+
+    [[nodiscard]] constexpr std::span<const RampPhase> phases() const noexcept
+    {
+        return std::span<const RampPhase>{m_phases}.first(m_phase_count);
+    }
+
+  private:
+    friend constexpr RampPrediction predict_move(
+        const RampRegisters& ramp, const Converter& converter, units::microsteps_t distance) noexcept;
+
+    std::array<RampPhase, max_phases> m_phases{};
+    std::size_t m_phase_count{};
+    double m_distance{};
+    double m_direction{1.0};
+    double m_peak{};
+    bool m_reaches_vmax{false};
+
+    constexpr void add_phase(double start, double end, double acceleration) noexcept
+    {
+        const double duration{(end - start) / acceleration};
+        if (duration > 0.0)
+        {
+            m_phases[m_phase_count++] = RampPhase{duration, start, acceleration};
+        }
+    }
+
+    /**
+     * @brief Cut the phases off once @p limit microsteps are covered (target closer than the braking distance).
+     */
+    constexpr void truncate(double limit) noexcept
+    {
+        double left{limit};
+        for (std::size_t idx{}; idx < m_phase_count; ++idx)
+        {
+            auto& phase{m_phases[idx]};
+            const double covered{phase.distance()};
+            if (left <= covered)
+            {
+                phase.duration = phase.time_at(left);
+                m_phase_count = idx + 1U;
+                return;
+            }
+            left -= covered;
+        }
+    }
+};
+
+/**
+ * @brief Predict a positioning move of @p distance microsteps with the ramp registers @p ramp.
+ *
+ * Models the ramp generator from standstill: start at min(VSTART, VMAX), accelerate with A1 below V1 and AMAX
+ * above (V1 = 0 uses AMAX/DMAX only), cruise at VMAX, brake with DMAX down to V1 and D1 down to VSTOP, then step
+ * to standstill on the target. Moves too short for VMAX peak where the acceleration and braking ramps meet.
+ * Acceleration registers of 0 are treated as 1, the slowest ramp the chip can run.
+ *
+ * @param ramp Ramp registers, e.g. RampRegisters::from_profile() or the shadow of a configured driver.
+ * @param converter Converter built with the driver's clock frequency.
+ * @param distance Signed distance from the current position to XTARGET.
+ * @return Prediction; an empty one (zero duration) for distance 0 or VMAX 0.
+ */
+[[nodiscard]] constexpr RampPrediction predict_move(
+    const RampRegisters& ramp, const Converter& converter, units::microsteps_t distance) noexcept
+{
+    RampPrediction prediction{};
+    const int64_t signed_distance{distance.raw()};
+
+    if (0 == signed_distance || 0U == ramp.v_max)
+    {
+        return prediction;
+    }
+
+    const auto velocity{[&converter](uint32_t value) -> double {
+        return static_cast<double>(converter.vmax_to_pps(value).raw());
+    }};
+    const auto acceleration{[&converter](uint32_t value) -> double {
+        return static_cast<double>(converter.register_to_accel(std::max(value, 1U)).raw());
+    }};
+
+    const double v_max{velocity(ramp.v_max)};
+    const double v_start{std::min(velocity(ramp.v_start), v_max)};
+    const double v_stop{velocity(ramp.v_stop)};
+    const double v_1{(0U == ramp.v_1) ? 0.0 : velocity(ramp.v_1)};
+    const double a_1{acceleration(ramp.a_1)};
+    const double a_max{acceleration(ramp.a_max)};
+    const double d_1{acceleration(ramp.d_1)};
+    const double d_max{acceleration(ramp.d_max)};
+    const double span{static_cast<double>((signed_distance < 0) ? -signed_distance : signed_distance)};
+
+    // Distance of a ramp between two speeds, split at V1 into its low (A1/D1) and high (AMAX/DMAX) part.
+    const auto ramp_distance{[v_1](double low, double high, double low_rate, double high_rate) -> double {
+        if (high <= low)
+        {
+            return 0.0;
+        }
+        const double split{std::clamp(v_1, low, high)};
+        return (((split * split) - (low * low)) / (2.0 * low_rate)) +
+               (((high * high) - (split * split)) / (2.0 * high_rate));
+    }};
+    const auto travel{[&](double peak) -> double {
+        return ramp_distance(v_start, peak, a_1, a_max) + ramp_distance(v_stop, peak, d_1, d_max);
+    }};
+
+    double peak{v_max};
+    if (travel(v_max) > span)
+    {
+        double low{v_start};
+        double high{v_max};
+        for (int iteration{}; iteration < 64; ++iteration)
+        {
+            const double middle{0.5 * (low + high)};
+            if (travel(middle) > span)
+            {
+                high = middle;
+            }
+            else
+            {
+                low = middle;
+            }
+        }
+        peak = low;
+    }
+
+    prediction.m_distance = span;
+    prediction.m_direction = (signed_distance < 0) ? -1.0 : 1.0;
+    prediction.m_peak = peak;
+    prediction.m_reaches_vmax = peak >= v_max;
+
+    const double split_up{std::clamp(v_1, v_start, peak)};
+    prediction.add_phase(v_start, split_up, a_1);
+    prediction.add_phase(split_up, peak, a_max);
+
+    const double cruise{span - travel(peak)};
+    if (prediction.m_reaches_vmax && cruise > 0.0)
+    {
+        prediction.m_phases[prediction.m_phase_count++] = RampPhase{cruise / peak, peak, 0.0};
+    }
+
+    const double split_down{std::clamp(v_1, v_stop, peak)};
+    prediction.add_phase(peak, split_down, -d_max);
+    prediction.add_phase(split_down, std::min(v_stop, peak), -d_1);
+    prediction.truncate(span);
+
+    return prediction;
+}
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_RAMP_PREDICTOR_HPP
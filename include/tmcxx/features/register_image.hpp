@@ -0,0 +1,120 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : register_image
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_REGISTER_IMAGE_HPP
+#define TMCXX_FEATURES_REGISTER_IMAGE_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/chips/tmc5160_settings.hpp"
+#include "tmcxx/features/converter.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace tmcxx::features {
+
+/**
+ * @brief One register write of a precomputed configuration.
+ */
+struct RegisterWrite
+{
+    uint8_t address{};
+    uint32_t value{};
+
+    constexpr bool operator==(const RegisterWrite&) const noexcept = default;
+};
+
+/**
+ * @brief Number of registers written by TMC5160::apply_settings().
+ */
+inline constexpr std::size_t settings_register_count{14U};
+
+/**
+ * @brief Final register values of a Settings struct, in the order apply_settings() sends them.
+ */
+using register_image_t = std::array<RegisterWrite, settings_register_count>;
+
+/**
+ * @brief Fold Settings into the register values apply_settings() sends to a freshly constructed driver.
+ *
+ * Applies the same Converter math and clamps as TMC5160Motion, field by field on a zeroed register. The result
+ * is ordered like apply_settings() sends it: the configuration registers in ascending address order (the order
+ * commit() flushes in), then XTARGET = 0 and XACTUAL = 0 back to back.
+ *
+ * @param settings Driver configuration.
+ * @return Register image.
+ */
+[[nodiscard]] constexpr register_image_t compute_register_image(const chip::tmc5160::Settings& settings) noexcept
+{
+    namespace regs = chip::tmc5160;
+
+    const Converter converter{settings.f_clk_hz, settings.full_steps, settings.r_sense};
+
+    constexpr uint32_t min_vstop{1U};
+    constexpr uint32_t min_d1{1U};
+    constexpr uint32_t max_d1{65'535U};
+
+    const uint32_t ihold_irun{regs::IHOLD_IRUN::i_hold_t{converter.current_to_cs(settings.hold_current)}.value |
+                              regs::IHOLD_IRUN::i_run_t{converter.current_to_cs(settings.run_current)}.value |
+                              regs::IHOLD_IRUN::i_hold_delay_t{settings.hold_delay}.value};
+
+    const uint32_t chopconf{regs::CHOPCONF::toff_t{settings.toff}.value |
+                            regs::CHOPCONF::hstrt_t{settings.hstrt}.value |
+                            regs::CHOPCONF::hend_t{static_cast<uint32_t>(settings.hend)}.value |
+                            regs::CHOPCONF::tbl_t{settings.tbl}.value |
+                            regs::CHOPCONF::chm_t{settings.stealth_chop_enabled ? 1U : 0U}.value};
+
+    return register_image_t{{
+        {regs::IHOLD_IRUN::address, ihold_irun},
+        {regs::TWPOWER_DOWN::address, settings.power_down_delay},
+        {regs::RAMPMODE::address, static_cast<uint32_t>(regs::RampModeType::POSITIONING)},
+        {regs::VSTART::address, converter.rpm_to_vmax(settings.v_start)},
+        {regs::A1::address, converter.accel_to_register(settings.a_1)},
+        {regs::V1::address, converter.rpm_to_vmax(settings.v_1)},
+        {regs::AMAX::address, converter.accel_to_register(settings.a_max)},
+        {regs::VMAX::address, converter.rpm_to_vmax(settings.v_max)},
+        {regs::DMAX::address, converter.accel_to_register(settings.d_max)},
+        {regs::D1::address, std::clamp(converter.accel_to_register(settings.d_1), min_d1, max_d1)},
+        {regs::VSTOP::address, std::max(min_vstop, converter.rpm_to_vmax(settings.v_stop))},
+        {regs::CHOPCONF::address, chopconf},
+        {regs::XTARGET::address, 0U},
+        {regs::XACTUAL::address, 0U},
+    }};
+}
+
+/**
+ * @brief Register image of a constant Settings value, computed entirely at compile time.
+ *
+ * No floating point math is left for the target; the init path only streams the table.
+ *
+ * @code
+ * constexpr auto image{features::make_register_image<chip::tmc5160::Settings{.run_current = 1.2_A}>()};
+ * motor.apply_register_image(image);
+ * @endcode
+ *
+ * @tparam Config Driver configuration.
+ * @return Register image.
+ */
+template<chip::tmc5160::Settings Config>
+[[nodiscard]] consteval register_image_t make_register_image() noexcept
+{
+    constexpr register_image_t image{compute_register_image(Config)};
+
+    static_assert(std::ranges::is_sorted(image.begin(), image.end() - 2, std::ranges::less{}, &RegisterWrite::address),
+        "Configuration registers must follow commit() order");
+    static_assert(chip::tmc5160::XTARGET::address == image[image.size() - 2U].address &&
+                      chip::tmc5160::XACTUAL::address == image.back().address,
+        "XTARGET and XACTUAL must come last, in this order");
+
+    return image;
+}
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_REGISTER_IMAGE_HPP
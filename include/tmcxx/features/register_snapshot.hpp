@@ -0,0 +1,182 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : register_snapshot
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_REGISTER_SNAPSHOT_HPP
+#define TMCXX_FEATURES_REGISTER_SNAPSHOT_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/helpers/constants.hpp"
+#include "tmcxx/helpers/error.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Set of register addresses (0-127).
+ *
+ * Structural type, so a constant mask can be passed as template argument:
+ * @code
+ * const auto snap{driver.snapshot<RegisterMask{RegAddress::XACTUAL, RegAddress::DRV_STATUS}>()};
+ * @endcode
+ */
+struct RegisterMask
+{
+    static constexpr std::size_t word_bits{32U};
+    static constexpr std::size_t word_count{helpers::constant::tmc_register_count / word_bits};
+
+    std::array<uint32_t, word_count> words{};
+
+    constexpr RegisterMask() noexcept = default;
+
+    constexpr RegisterMask(std::initializer_list<chip::tmc5160::RegAddress> addresses) noexcept
+    {
+        for (const auto address: addresses)
+        {
+            set(static_cast<uint8_t>(address));
+        }
+    }
+
+    constexpr RegisterMask& set(uint8_t address) noexcept
+    {
+        if (address < helpers::constant::tmc_register_count)
+        {
+            words[address / word_bits] |= uint32_t{1U} << (address % word_bits);
+        }
+        return *this;
+    }
+
+    constexpr RegisterMask& reset(uint8_t address) noexcept
+    {
+        if (address < helpers::constant::tmc_register_count)
+        {
+            words[address / word_bits] &= ~(uint32_t{1U} << (address % word_bits));
+        }
+        return *this;
+    }
+
+    [[nodiscard]] constexpr bool test(uint8_t address) const noexcept
+    {
+        return address < helpers::constant::tmc_register_count &&
+               ((words[address / word_bits] >> (address % word_bits)) & 1U) != 0U;
+    }
+
+    [[nodiscard]] constexpr std::size_t count() const noexcept
+    {
+        std::size_t total{};
+        for (const auto word: words)
+        {
+            total += static_cast<std::size_t>(std::popcount(word));
+        }
+        return total;
+    }
+
+    /**
+     * @brief Invoke @p visit(uint8_t address) for every set address, ascending.
+     */
+    template<typename Visitor>
+    constexpr void for_each(Visitor&& visit) const
+    {
+        for (std::size_t idx{}; idx < word_count; ++idx)
+        {
+            for (uint32_t word{words[idx]}; word != 0U; word &= word - 1U)
+            {
+                visit(static_cast<uint8_t>((idx * word_bits) + static_cast<std::size_t>(std::countr_zero(word))));
+            }
+        }
+    }
+
+    [[nodiscard]] constexpr RegisterMask operator|(const RegisterMask& other) const noexcept
+    {
+        RegisterMask result{};
+        for (std::size_t idx{}; idx < word_count; ++idx)
+        {
+            result.words[idx] = words[idx] | other.words[idx];
+        }
+        return result;
+    }
+
+    constexpr bool operator==(const RegisterMask&) const noexcept = default;
+};
+
+/**
+ * @brief Register values and per-register outcome of one snapshot, indexed by address.
+ */
+struct RegisterSnapshot
+{
+    std::array<uint32_t, helpers::constant::tmc_register_count> values{};
+    std::array<helpers::ErrorCode, helpers::constant::tmc_register_count> errors{};
+    RegisterMask requested{};
+
+    /**
+     * @brief Value of one register.
+     *
+     * @param address Register address enum.
+     * @return Register value, INVALID_PARAMETER if it was not requested, or the error of its read.
+     */
+    [[nodiscard]] helpers::result_t<uint32_t> get(chip::tmc5160::RegAddress address) const noexcept
+    {
+        const auto index{static_cast<uint8_t>(address)};
+
+        if (!requested.test(index)) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        if (helpers::ErrorCode::SUCCESS != errors[index]) [[unlikely]]
+        {
+            return tl::unexpected(errors[index]);
+        }
+
+        return values[index];
+    }
+
+    /**
+     * @brief Number of requested registers that could not be captured.
+     */
+    [[nodiscard]] std::size_t failed_count() const noexcept
+    {
+        std::size_t failed{};
+        requested.for_each([this, &failed](uint8_t addr) {
+            failed += (helpers::ErrorCode::SUCCESS != errors[addr]);
+        });
+        return failed;
+    }
+
+    /**
+     * @brief Check whether every requested register was captured.
+     */
+    [[nodiscard]] bool complete() const noexcept
+    {
+        return 0U == failed_count();
+    }
+
+    /**
+     * @brief Outcome of the whole snapshot.
+     *
+     * @return Success, or the error of the lowest failed address.
+     */
+    [[nodiscard]] helpers::result_t<void> status() const noexcept
+    {
+        for (std::size_t addr{}; addr < errors.size(); ++addr)
+        {
+            if (requested.test(static_cast<uint8_t>(addr)) && helpers::ErrorCode::SUCCESS != errors[addr])
+            {
+                return tl::unexpected(errors[addr]);
+            }
+        }
+        return {};
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_REGISTER_SNAPSHOT_HPP
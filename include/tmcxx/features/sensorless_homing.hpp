@@ -0,0 +1,369 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : sensorless_homing
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_SENSORLESS_HOMING_HPP
+#define TMCXX_FEATURES_SENSORLESS_HOMING_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/helpers/error.hpp"
+#include "tmcxx/helpers/units.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Parameters of a StallGuard2 homing run.
+ */
+struct HomingConfig
+{
+    /**
+     * @brief Homing speed; the sign selects the direction.
+     */
+    units::rpm_t velocity{};
+
+    /**
+     * @brief StallGuard2 threshold COOLCONF.sgt (-64 ... 63); tune so SG_RESULT reaches 0 only at the end stop.
+     */
+    int8_t sgt{};
+
+    /**
+     * @brief COOLCONF.sfilt: filter SG_RESULT over four full steps.
+     */
+    bool filter{};
+
+    /**
+     * @brief TCOOLTHRS (TSTEP units); 0 arms StallGuard above 80 % of the homing speed.
+     */
+    uint32_t tcoolthrs{};
+
+    /**
+     * @brief XACTUAL assigned to the stall position.
+     */
+    int32_t home_position{};
+
+    /**
+     * @brief Samples before giving up with ErrorCode::TIMEOUT (0 = no limit).
+     */
+    uint32_t max_samples{};
+};
+
+/**
+ * @brief Sensorless homing of one axis on the chip's StallGuard2 stop (SW_MODE.sg_stop).
+ *
+ * start() writes TCOOLTHRS, COOLCONF.sgt/sfilt and SW_MODE.sg_stop, clears a stale RAMP_STAT.event_stop_sg, then
+ * starts the velocity move. Every poll() reads DRV_STATUS, RAMP_STAT and XACTUAL in one pipelined burst (4
+ * datagrams, or one transfer_frames() call on batch devices), so SG_RESULT is sampled at the bus rate and the
+ * position is latched by the same burst that sees the stop event. The chip stops the motor by itself on the stall;
+ * the engine then sets XACTUAL = XTARGET = home_position, VMAX = 0, RAMPMODE = POSITIONING and disables sg_stop in
+ * one commit, and clears the event with one more datagram (RAMP_STAT is not shadowed). commit() sends ascending
+ * addresses, so sg_stop (SW_MODE, 0x34) is released only after VMAX = 0 and XTARGET = XACTUAL are in place:
+ * releasing the stop cannot move the motor.
+ *
+ * A run that fails after arming (SPI error, timeout) stops the axis, disables sg_stop and clears the event, so the
+ * next motion command is not stopped by a leftover stall. TCOOLTHRS and COOLCONF stay as programmed, as after a
+ * successful run.
+ *
+ * @code
+ * SensorlessHoming x_home{x_axis, {.velocity = -60_rpm, .sgt = 4}};
+ * SensorlessHoming y_home{y_axis, {.velocity = -60_rpm, .sgt = 6}};
+ * const auto res{home_all(std::array{&x_home, &y_home})};
+ * @endcode
+ *
+ * @tparam Axis Driver type (e.g. TMC5160<TSpi>).
+ */
+template<typename Axis>
+class SensorlessHoming {
+  public:
+    enum class State : uint8_t {
+        IDLE,
+        SEEKING,
+        HOMED,
+        FAILED
+    };
+
+    /**
+     * @brief Hook receiving every SG_RESULT sample with the position it was taken at.
+     */
+    using sample_hook_t = void (*)(void* context, uint16_t sg_result, int32_t position);
+
+    /**
+     * @brief Construct engine.
+     *
+     * @param axis Driver to home (must outlive this object).
+     * @param config Homing parameters.
+     */
+    SensorlessHoming(Axis& axis, const HomingConfig& config) noexcept
+        : m_axis{axis}
+        , m_config{config}
+    {
+    }
+
+    SensorlessHoming(const SensorlessHoming&) = delete;
+    SensorlessHoming& operator=(const SensorlessHoming&) = delete;
+
+    /**
+     * @brief Arm StallGuard2 and start moving towards the end stop.
+     *
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> start()
+    {
+        namespace regs = chip::tmc5160;
+
+        constexpr float zero_val{0.f};
+        const bool reverse{m_config.velocity.raw() < zero_val};
+        const uint32_t vmax{m_axis.converter().rpm_to_vmax(reverse ? std::negate{}(m_config.velocity)
+                                                                    : m_config.velocity)};
+
+        if (0U == vmax) [[unlikely]]
+        {
+            return fail(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        m_samples = 0U;
+        m_state = State::SEEKING;
+
+        // Armed before the move starts, so the first stall above TCOOLTHRS already stops the motor.
+        m_axis.begin_transaction();
+        (void)m_axis.template write_register<regs::TCOOLTHRS>(
+            (0U != m_config.tcoolthrs) ? m_config.tcoolthrs : default_tcoolthrs(vmax));
+        (void)m_axis.template write_field<regs::SW_MODE::sg_stop_t>(1U);
+        (void)m_axis.template write_field<regs::COOLCONF::sgt_t>(static_cast<uint8_t>(m_config.sgt));
+        (void)m_axis.template write_field<regs::COOLCONF::sfilt_t>(m_config.filter ? 1U : 0U);
+
+        if (const auto res{m_axis.commit()}; !res) [[unlikely]]
+        {
+            return abort(res.error());
+        }
+
+        if (const auto res{m_axis.clear_ramp_events(event_stop_sg)}; !res) [[unlikely]]
+        {
+            return abort(res.error());
+        }
+
+        m_axis.begin_transaction();
+        (void)m_axis.template write_register<regs::RAMPMODE>(
+            static_cast<uint32_t>(reverse ? regs::RampModeType::VELOCITY_NEG : regs::RampModeType::VELOCITY_POS));
+        (void)m_axis.template write_register<regs::VMAX>(vmax);
+
+        if (const auto res{m_axis.commit()}; !res) [[unlikely]]
+        {
+            return abort(res.error());
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Take one SG_RESULT sample; zero the axis once the StallGuard2 stop event is seen.
+     *
+     * @return True once homed, false while seeking (or not started), or the error that ended the run.
+     */
+    [[nodiscard]] helpers::result_t<bool> poll()
+    {
+        namespace regs = chip::tmc5160;
+
+        if (State::SEEKING != m_state)
+        {
+            return State::HOMED == m_state;
+        }
+
+        const auto values{m_axis.template read_registers<regs::DRV_STATUS, regs::RAMP_STAT, regs::XACTUAL>()};
+        if (!values) [[unlikely]]
+        {
+            return abort(values.error());
+        }
+
+        const auto [drv_status, ramp_stat, x_actual]{*values};
+        const auto position{static_cast<int32_t>(x_actual)};
+
+        m_last_sg_result = static_cast<uint16_t>(regs::DRV_STATUS::sg_result_t::extract(drv_status));
+        ++m_samples;
+
+        if (nullptr != m_sample_hook)
+        {
+            m_sample_hook(m_sample_context, m_last_sg_result, position);
+        }
+
+        if (0U == regs::RAMP_STAT::event_stop_sg_t::extract(ramp_stat))
+        {
+            if (0U != m_config.max_samples && m_samples >= m_config.max_samples)
+            {
+                return abort(helpers::ErrorCode::TIMEOUT);
+            }
+
+            return false;
+        }
+
+        m_latched_position = position;
+
+        if (const auto res{zero_axis()}; !res) [[unlikely]]
+        {
+            return abort(res.error());
+        }
+
+        m_state = State::HOMED;
+        return true;
+    }
+
+    [[nodiscard]] State state() const noexcept
+    {
+        return m_state;
+    }
+
+    /**
+     * @brief XACTUAL at the stall, before it was replaced by home_position.
+     */
+    [[nodiscard]] int32_t latched_position() const noexcept
+    {
+        return m_latched_position;
+    }
+
+    [[nodiscard]] uint16_t last_sg_result() const noexcept
+    {
+        return m_last_sg_result;
+    }
+
+    [[nodiscard]] uint32_t samples() const noexcept
+    {
+        return m_samples;
+    }
+
+    /**
+     * @brief Install a hook called with every SG_RESULT sample (e.g. to tune sgt), nullptr to remove it.
+     */
+    void set_sample_hook(sample_hook_t hook, void* context = nullptr) noexcept
+    {
+        m_sample_hook = hook;
+        m_sample_context = context;
+    }
+
+  private:
+    static constexpr uint32_t event_stop_sg{chip::tmc5160::RAMP_STAT::event_stop_sg_t{1U}.value};
+
+    Axis& m_axis;
+    HomingConfig m_config{};
+
+    State m_state{State::IDLE};
+    uint32_t m_samples{};
+    int32_t m_latched_position{};
+    uint16_t m_last_sg_result{};
+
+    sample_hook_t m_sample_hook{};
+    void* m_sample_context{};
+
+    /**
+     * @brief TSTEP at 80 % of the homing VMAX (TSTEP ~= 2^24 / VMAX).
+     */
+    [[nodiscard]] static constexpr uint32_t default_tcoolthrs(uint32_t vmax) noexcept
+    {
+        constexpr uint64_t tstep_scale{uint64_t{1U} << 24U};
+        constexpr uint64_t max_tcoolthrs{(uint64_t{1U} << 20U) - 1U};
+
+        return static_cast<uint32_t>(std::min(tstep_scale * 5U / (uint64_t{vmax} * 4U), max_tcoolthrs));
+    }
+
+    [[nodiscard]] helpers::result_t<void> zero_axis()
+    {
+        namespace regs = chip::tmc5160;
+
+        const auto home{static_cast<uint32_t>(m_config.home_position)};
+
+        m_axis.begin_transaction();
+        (void)m_axis.template write_register<regs::RAMPMODE>(static_cast<uint32_t>(regs::RampModeType::POSITIONING));
+        (void)m_axis.template write_register<regs::XACTUAL>(home);
+        (void)m_axis.template write_register<regs::VMAX>(0U);
+        (void)m_axis.template write_register<regs::XTARGET>(home);
+        (void)m_axis.template write_field<regs::SW_MODE::sg_stop_t>(0U);
+
+        if (const auto res{m_axis.commit()}; !res) [[unlikely]]
+        {
+            return res;
+        }
+
+        return m_axis.clear_ramp_events(event_stop_sg);
+    }
+
+    [[nodiscard]] tl::unexpected<helpers::ErrorCode> fail(helpers::ErrorCode error) noexcept
+    {
+        m_state = State::FAILED;
+        return tl::unexpected(error);
+    }
+
+    /**
+     * @brief Fail a run after arming: stop, then release sg_stop and the stop event (best effort).
+     */
+    [[nodiscard]] tl::unexpected<helpers::ErrorCode> abort(helpers::ErrorCode error)
+    {
+        namespace regs = chip::tmc5160;
+
+        (void)m_axis.stop();
+
+        (void)m_axis.template write_field<regs::SW_MODE::sg_stop_t>(0U);
+        (void)m_axis.clear_ramp_events(event_stop_sg);
+
+        return fail(error);
+    }
+};
+
+/**
+ * @brief Home several axes at once, interleaving their samples.
+ *
+ * Every engine is started, then polled round-robin until each one is homed or failed, so all axes drive
+ * towards their end stops simultaneously. Axes on different buses can equally be homed from their own threads.
+ *
+ * @param engines Homing engines (their axes must not share a CoreCommunicator).
+ * @return Result<void>: success if every axis homed, else the first error.
+ */
+template<typename Axis, std::size_t N>
+[[nodiscard]] helpers::result_t<void> home_all(const std::array<SensorlessHoming<Axis>*, N>& engines)
+{
+    helpers::result_t<void> result{};
+
+    for (auto* engine: engines)
+    {
+        if (auto res{engine->start()}; !res && result) [[unlikely]]
+        {
+            result = std::move(res);
+        }
+    }
+
+    using state_t = typename SensorlessHoming<Axis>::State;
+    bool seeking{true};
+
+    while (seeking)
+    {
+        seeking = false;
+
+        for (auto* engine: engines)
+        {
+            if (state_t::SEEKING != engine->state())
+            {
+                continue;
+            }
+
+            if (const auto res{engine->poll()}; !res && result) [[unlikely]]
+            {
+                result = tl::unexpected(res.error());
+            }
+
+            seeking = seeking || (state_t::SEEKING == engine->state());
+        }
+    }
+
+    return result;
+}
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_SENSORLESS_HOMING_HPP
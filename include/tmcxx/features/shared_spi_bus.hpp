@@ -0,0 +1,238 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : shared_spi_bus
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_SHARED_SPI_BUS_HPP
+#define TMCXX_FEATURES_SHARED_SPI_BUS_HPP
+
+#include "tmcxx/base/concepts.hpp"
+
+#include <atomic>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Chip select line of one device on a shared bus (e.g. a GPIO wrapper).
+ */
+template<typename T>
+concept ChipSelectLine = requires(T line) {
+    { line.select() } -> std::same_as<void>;
+    { line.deselect() } -> std::same_as<void>;
+};
+
+/**
+ * @brief Lock guarding a shared bus (std::mutex, an RTOS mutex wrapper, ...).
+ */
+template<typename T>
+concept BusLock = requires(T lock) {
+    { lock.lock() } -> std::same_as<void>;
+    { lock.unlock() } -> std::same_as<void>;
+};
+
+/**
+ * @brief One SPI peripheral shared by several drivers on their own chip selects, from several threads or tasks.
+ *
+ * Each chip is reached through a Device that satisfies SpiDevice, so a regular TMC5160<Device> drives it. A
+ * datagram is first posted on its Device, then the caller takes the bus lock. Whoever holds the lock sends every
+ * posted datagram back to back, one chip select pulse each, before releasing it (flat combining): callers that
+ * were waiting for the lock usually find their datagram already sent, and the bus never idles for a lock hand-over
+ * between queued datagrams. Pipelined read bursts stay valid when interleaved with other chips because every chip
+ * keeps its reply until its own next datagram.
+ *
+ * TSpi::select()/deselect() bracket every batch (claim and release of the peripheral); the chip select of each
+ * datagram is its Device's line. Lock waits are not bounded by the transfer timeout.
+ *
+ * @code
+ * SharedSpiBus<MySpi, MyPin, std::mutex> bus{spi};
+ * SharedSpiBus<MySpi, MyPin, std::mutex>::Device x_spi{bus, x_cs_pin};
+ * TMC5160<SharedSpiBus<MySpi, MyPin, std::mutex>::Device> x_axis{x_spi, settings}; // used by thread 1
+ * TMC5160<SharedSpiBus<MySpi, MyPin, std::mutex>::Device> y_axis{y_spi, settings}; // used by thread 2
+ * @endcode
+ *
+ * @tparam TSpi SPI device type satisfying SpiDevice concept.
+ * @tparam TChipSelect Chip select line type.
+ * @tparam TLock Lock type, default constructible.
+ */
+template<core::concepts::SpiDevice TSpi, ChipSelectLine TChipSelect, BusLock TLock>
+class SharedSpiBus {
+  public:
+    /**
+     * @brief Per-chip SPI view.
+     *
+     * select()/deselect() are no-ops; the bus drives the chip select around each datagram. A Device belongs to
+     * one driver and must not be used by two threads at the same time.
+     */
+    class Device {
+      public:
+        /**
+         * @brief Attach a chip to the bus.
+         *
+         * @param bus Shared bus (must outlive this object).
+         * @param chip_select Chip select line of the chip (must outlive this object).
+         */
+        Device(SharedSpiBus& bus, TChipSelect& chip_select)
+            : m_bus{bus}
+            , m_chip_select{chip_select}
+        {
+            m_bus.attach(*this);
+        }
+
+        ~Device()
+        {
+            m_bus.detach(*this);
+        }
+
+        Device(const Device&) = delete;
+        Device& operator=(const Device&) = delete;
+
+        bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, uint32_t timeout_ms)
+        {
+            m_tx_data = tx_data;
+            m_rx_data = rx_data;
+            m_timeout_ms = timeout_ms;
+            m_pending.store(true, std::memory_order_release);
+
+            m_bus.m_lock.lock();
+
+            if (m_pending.load(std::memory_order_acquire))
+            {
+                m_bus.combine();
+            }
+
+            const bool success{m_success};
+            m_bus.m_lock.unlock();
+
+            return success;
+        }
+
+        void select() noexcept
+        {
+        }
+
+        void deselect() noexcept
+        {
+        }
+
+      private:
+        friend class SharedSpiBus;
+
+        SharedSpiBus& m_bus;
+        TChipSelect& m_chip_select;
+        Device* m_next{};
+
+        std::span<const uint8_t> m_tx_data{};
+        std::span<uint8_t> m_rx_data{};
+        uint32_t m_timeout_ms{};
+        bool m_success{};
+        std::atomic<bool> m_pending{};
+    };
+
+    /**
+     * @brief Construct bus on a physical SPI device.
+     *
+     * @param spi Reference to SPI device (must outlive this object).
+     */
+    explicit SharedSpiBus(TSpi& spi)
+        : m_spi_device{spi}
+    {
+    }
+
+    SharedSpiBus(const SharedSpiBus&) = delete;
+    SharedSpiBus& operator=(const SharedSpiBus&) = delete;
+
+    /**
+     * @brief Number of lock-holder batches sent so far.
+     */
+    [[nodiscard]] std::size_t batch_count() const noexcept
+    {
+        return m_batch_count.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Number of datagrams sent so far; transfer_count() / batch_count() is the average batch length.
+     */
+    [[nodiscard]] std::size_t transfer_count() const noexcept
+    {
+        return m_transfer_count.load(std::memory_order_relaxed);
+    }
+
+  private:
+    TSpi& m_spi_device;
+    TLock m_lock{};
+    Device* m_devices{};
+
+    // Written under m_lock only; atomic so the statistics can be read from any thread.
+    std::atomic<std::size_t> m_batch_count{};
+    std::atomic<std::size_t> m_transfer_count{};
+
+    void attach(Device& device)
+    {
+        m_lock.lock();
+
+        Device** link{&m_devices};
+        while (nullptr != *link)
+        {
+            link = &(*link)->m_next;
+        }
+        *link = &device;
+
+        m_lock.unlock();
+    }
+
+    void detach(Device& device)
+    {
+        m_lock.lock();
+
+        for (Device** link{&m_devices}; nullptr != *link; link = &(*link)->m_next)
+        {
+            if (*link == &device)
+            {
+                *link = device.m_next;
+                break;
+            }
+        }
+
+        m_lock.unlock();
+    }
+
+    /**
+     * @brief Send every posted datagram in attach order (called with m_lock held).
+     */
+    void combine()
+    {
+        std::size_t sent{};
+
+        m_spi_device.select();
+
+        for (Device* device{m_devices}; nullptr != device; device = device->m_next)
+        {
+            if (!device->m_pending.load(std::memory_order_acquire))
+            {
+                continue;
+            }
+
+            device->m_chip_select.select();
+            device->m_success = m_spi_device.transfer(device->m_tx_data, device->m_rx_data, device->m_timeout_ms);
+            device->m_chip_select.deselect();
+
+            device->m_pending.store(false, std::memory_order_release);
+            ++sent;
+        }
+
+        m_spi_device.deselect();
+
+        m_batch_count.store(m_batch_count.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+        m_transfer_count.store(m_transfer_count.load(std::memory_order_relaxed) + sent, std::memory_order_relaxed);
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_SHARED_SPI_BUS_HPP
@@ -0,0 +1,164 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : spi_transport
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_SPI_TRANSPORT_HPP
+#define TMCXX_FEATURES_SPI_TRANSPORT_HPP
+
+#include "tmcxx/base/concepts.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace tmcxx::features {
+
+class SpiTransport;
+
+/**
+ * @brief SPI device types an SpiTransport can wrap (every SpiDevice except the transports themselves).
+ */
+template<typename T>
+concept TransportBackend = core::concepts::SpiDevice<T> && !std::derived_from<std::remove_cv_t<T>, SpiTransport>;
+
+/**
+ * @brief Type-erased SpiDevice: a device pointer and three function pointers.
+ *
+ * Thin-template mode. TMC5160<SpiTransport> (ThinTMC5160) and everything below it - CoreCommunicator, the register
+ * access tables, motion - is instantiated once for all SPI backends of a firmware; only the three thunks below are
+ * generated per backend type. The cost is one indirect call per SPI transfer, which is small next to the transfer
+ * itself.
+ *
+ * @code
+ * features::SpiTransport x_spi{spi1_dma};
+ * features::SpiTransport y_spi{spi2_polled};
+ * ThinTMC5160<> x_axis{x_spi, settings}; // same driver code as y_axis
+ * ThinTMC5160<> y_axis{y_spi, settings};
+ * @endcode
+ *
+ * Async submission (AsyncSpiDevice) is not forwarded; BatchSpiTransport keeps transfer_frames() batching.
+ */
+class SpiTransport {
+  public:
+    /**
+     * @brief Wrap an SPI device.
+     *
+     * @param device SPI device (must outlive this object and every driver using it).
+     */
+    template<TransportBackend TSpi>
+    explicit SpiTransport(TSpi& device) noexcept
+        : m_device{&device}
+        , m_transfer{&transfer_thunk<TSpi>}
+        , m_select{&select_thunk<TSpi>}
+        , m_deselect{&deselect_thunk<TSpi>}
+    {
+    }
+
+    bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, uint32_t timeout_ms)
+    {
+        return m_transfer(m_device, tx_data, rx_data, timeout_ms);
+    }
+
+    void select()
+    {
+        m_select(m_device);
+    }
+
+    void deselect()
+    {
+        m_deselect(m_device);
+    }
+
+  protected:
+    /**
+     * @brief Wrapped device, for the thunks of derived transports.
+     */
+    [[nodiscard]] void* device() const noexcept
+    {
+        return m_device;
+    }
+
+  private:
+    using transfer_fn_t = bool (*)(void*, std::span<const uint8_t>, std::span<uint8_t>, uint32_t);
+    using chip_select_fn_t = void (*)(void*);
+
+    template<typename TSpi>
+    static bool transfer_thunk(
+        void* device, std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, uint32_t timeout_ms)
+    {
+        return static_cast<TSpi*>(device)->transfer(tx_data, rx_data, timeout_ms);
+    }
+
+    template<typename TSpi>
+    static void select_thunk(void* device)
+    {
+        static_cast<TSpi*>(device)->select();
+    }
+
+    template<typename TSpi>
+    static void deselect_thunk(void* device)
+    {
+        static_cast<TSpi*>(device)->deselect();
+    }
+
+    void* m_device;
+    transfer_fn_t m_transfer;
+    chip_select_fn_t m_select;
+    chip_select_fn_t m_deselect;
+};
+
+/**
+ * @brief Type-erased BatchSpiDevice: SpiTransport plus transfer_frames().
+ *
+ * Drivers on a BatchSpiTransport send pipelines with one transfer_frames() call, like on the wrapped device. All
+ * batch backends share one TMC5160<BatchSpiTransport> instantiation.
+ */
+class BatchSpiTransport : public SpiTransport {
+  public:
+    /**
+     * @brief Wrap a batch-capable SPI device.
+     *
+     * @param device SPI device (must outlive this object and every driver using it).
+     */
+    template<TransportBackend TSpi>
+        requires core::concepts::BatchSpiDevice<TSpi>
+    explicit BatchSpiTransport(TSpi& device) noexcept
+        : SpiTransport{device}
+        , m_transfer_frames{&transfer_frames_thunk<TSpi>}
+    {
+    }
+
+    bool transfer_frames(
+        std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, std::size_t frame_size, uint32_t timeout_ms)
+    {
+        return m_transfer_frames(device(), tx_data, rx_data, frame_size, timeout_ms);
+    }
+
+  private:
+    using transfer_frames_fn_t = bool (*)(void*, std::span<const uint8_t>, std::span<uint8_t>, std::size_t, uint32_t);
+
+    template<typename TSpi>
+    static bool transfer_frames_thunk(void* device,
+        std::span<const uint8_t> tx_data,
+        std::span<uint8_t> rx_data,
+        std::size_t frame_size,
+        uint32_t timeout_ms)
+    {
+        return static_cast<TSpi*>(device)->transfer_frames(tx_data, rx_data, frame_size, timeout_ms);
+    }
+
+    transfer_frames_fn_t m_transfer_frames;
+};
+
+static_assert(core::concepts::SpiDevice<SpiTransport>);
+static_assert(!core::concepts::BatchSpiDevice<SpiTransport>);
+static_assert(core::concepts::BatchSpiDevice<BatchSpiTransport>);
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_SPI_TRANSPORT_HPP
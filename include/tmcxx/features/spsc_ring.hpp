@@ -0,0 +1,132 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : spsc_ring
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_SPSC_RING_HPP
+#define TMCXX_FEATURES_SPSC_RING_HPP
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+
+namespace tmcxx::features {
+
+/**
+ * @brief Alignment used to keep producer and consumer state on separate cache lines.
+ */
+inline constexpr std::size_t cache_line_size{64U};
+
+/**
+ * @brief Wait-free single-producer / single-consumer ring buffer.
+ *
+ * Fixed capacity, no heap. Indices are free-running counters masked into the slot array, so all Capacity slots
+ * are usable. Producer and consumer indices live on their own cache lines, and each side keeps a private copy of
+ * the other's index so a push or pop only touches the shared line when the cached view says full or empty.
+ *
+ * try_push() may only be called from one thread (or interrupt) and try_pop() from one other.
+ *
+ * @tparam T Element type (trivially copyable).
+ * @tparam Capacity Number of slots (power of two).
+ */
+template<typename T, std::size_t Capacity>
+requires(std::has_single_bit(Capacity) && std::is_trivially_copyable_v<T>)
+class SpscRing {
+  public:
+    static constexpr std::size_t capacity{Capacity};
+
+    SpscRing() = default;
+    SpscRing(const SpscRing&) = delete;
+    SpscRing& operator=(const SpscRing&) = delete;
+
+    /**
+     * @brief Append an element (producer side).
+     *
+     * @param item Element to copy into the ring.
+     * @return False if the ring is full; the element is dropped.
+     */
+    [[nodiscard]] bool try_push(const T& item) noexcept
+    {
+        const std::size_t head{m_head.load(std::memory_order_relaxed)};
+
+        if ((head - m_producer_tail) == Capacity)
+        {
+            m_producer_tail = m_tail.load(std::memory_order_acquire);
+
+            if ((head - m_producer_tail) == Capacity) [[unlikely]]
+            {
+                return false;
+            }
+        }
+
+        m_slots[head & index_mask] = item;
+        m_head.store(head + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Remove the oldest element (consumer side).
+     *
+     * @param item Receives the element.
+     * @return False if the ring is empty; @p item is untouched.
+     */
+    [[nodiscard]] bool try_pop(T& item) noexcept
+    {
+        const std::size_t tail{m_tail.load(std::memory_order_relaxed)};
+
+        if (tail == m_consumer_head)
+        {
+            m_consumer_head = m_head.load(std::memory_order_acquire);
+
+            if (tail == m_consumer_head)
+            {
+                return false;
+            }
+        }
+
+        item = m_slots[tail & index_mask];
+        m_tail.store(tail + 1U, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Number of stored elements (exact only when both sides are idle).
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire);
+    }
+
+    /**
+     * @brief Check whether the ring holds no element (same caveat as size()).
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return 0U == size();
+    }
+
+  private:
+    static constexpr std::size_t index_mask{Capacity - 1U};
+
+    /**
+     * @brief Written by the producer; m_producer_tail is its private view of m_tail.
+     */
+    alignas(cache_line_size) std::atomic<std::size_t> m_head{};
+    std::size_t m_producer_tail{};
+
+    /**
+     * @brief Written by the consumer; m_consumer_head is its private view of m_head.
+     */
+    alignas(cache_line_size) std::atomic<std::size_t> m_tail{};
+    std::size_t m_consumer_head{};
+
+    alignas(cache_line_size) std::array<T, Capacity> m_slots{};
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_SPSC_RING_HPP
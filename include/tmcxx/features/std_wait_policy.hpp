@@ -0,0 +1,66 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : std_wait_policy
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_STD_WAIT_POLICY_HPP
+#define TMCXX_FEATURES_STD_WAIT_POLICY_HPP
+
+#include "tmcxx/features/motion_wait.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace tmcxx::features {
+
+/**
+ * @brief WaitPolicy on the standard clock and a condition variable (hosted targets, e.g. Linux).
+ *
+ * Ticks are microseconds of std::chrono::steady_clock. notify() wakes a sleeping wait at once, e.g. from the thread
+ * that watches the DIAG pin (gpiod edge event); a notification without a sleeper is kept for the next wait.
+ */
+class StdWaitPolicy {
+  public:
+    [[nodiscard]] uint32_t now() const noexcept
+    {
+        const auto elapsed{std::chrono::steady_clock::now().time_since_epoch()};
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count());
+    }
+
+    void wait(uint32_t ticks)
+    {
+        std::unique_lock lock{m_mutex};
+
+        m_wake.wait_for(lock, std::chrono::microseconds{ticks}, [this] {
+            return m_notified;
+        });
+        m_notified = false;
+    }
+
+    /**
+     * @brief Wake the current (or next) wait() early.
+     */
+    void notify()
+    {
+        {
+            const std::lock_guard lock{m_mutex};
+            m_notified = true;
+        }
+        m_wake.notify_all();
+    }
+
+  private:
+    std::mutex m_mutex{};
+    std::condition_variable m_wake{};
+    bool m_notified{};
+};
+
+static_assert(WaitPolicy<StdWaitPolicy>);
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_STD_WAIT_POLICY_HPP
@@ -0,0 +1,167 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : telemetry_sampler
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_TELEMETRY_SAMPLER_HPP
+#define TMCXX_FEATURES_TELEMETRY_SAMPLER_HPP
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/motion_snapshot.hpp"
+#include "tmcxx/features/spsc_ring.hpp"
+#include "tmcxx/helpers/error.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace tmcxx::features {
+
+/**
+ * @brief One telemetry record: motion state and driver status at a point in time.
+ */
+struct TelemetrySample
+{
+    /**
+     * @brief Caller supplied tick count at which the sample was taken.
+     */
+    uint32_t timestamp{};
+
+    MotionSnapshot motion{};
+
+    /**
+     * @brief DRV_STATUS register value.
+     */
+    uint32_t drv_status{};
+};
+
+/**
+ * @brief Fills an SpscRing with TelemetrySamples of one axis at a fixed rate.
+ *
+ * Runs on the producer side (control loop or high-priority task): poll() is cheap when no sample is due, and a
+ * due sample costs one pipelined burst (XACTUAL, VACTUAL, RAMP_STAT, DRV_STATUS: 5 transfers). A full ring drops
+ * the new sample instead of blocking; drops and read errors are counted and may be read from any thread.
+ *
+ * @code
+ * SpscRing<TelemetrySample, 256> ring{};
+ * TelemetrySampler sampler{axis, ring, 500U}; // every 500 us at 1 MHz ticks
+ * // control loop:   (void)sampler.poll(micros());
+ * // logging thread: TelemetrySample s{}; while (ring.try_pop(s)) { ... }
+ * @endcode
+ *
+ * @tparam Axis Driver type (e.g. TMC5160<TSpi>).
+ * @tparam Capacity Ring capacity.
+ */
+template<typename Axis, std::size_t Capacity>
+class TelemetrySampler {
+  public:
+    using ring_t = SpscRing<TelemetrySample, Capacity>;
+
+    /**
+     * @brief Construct sampler.
+     *
+     * @param axis Driver to sample (must outlive this object).
+     * @param ring Ring to fill; this sampler is its only producer (must outlive this object).
+     * @param period_ticks Minimum tick distance between two samples.
+     */
+    TelemetrySampler(Axis& axis, ring_t& ring, uint32_t period_ticks) noexcept
+        : m_axis{axis}
+        , m_ring{ring}
+        , m_period{period_ticks}
+    {
+    }
+
+    TelemetrySampler(const TelemetrySampler&) = delete;
+    TelemetrySampler& operator=(const TelemetrySampler&) = delete;
+
+    /**
+     * @brief Take a sample if the period elapsed since the previous one.
+     *
+     * @param now Current tick count (wrap-around safe).
+     * @return True if a sample was pushed, false if none was due or the ring was full, or the read error.
+     */
+    [[nodiscard]] helpers::result_t<bool> poll(uint32_t now)
+    {
+        if (m_started && (now - m_last_sample) < m_period)
+        {
+            return false;
+        }
+
+        return sample(now);
+    }
+
+    /**
+     * @brief Take a sample immediately and restart the period.
+     *
+     * @param now Current tick count, stored as the sample timestamp.
+     * @return True if the sample was pushed, false if the ring was full, or the read error.
+     */
+    [[nodiscard]] helpers::result_t<bool> sample(uint32_t now)
+    {
+        m_started = true;
+        m_last_sample = now;
+
+        const auto values{m_axis.template read_registers<chip::tmc5160::XACTUAL,
+            chip::tmc5160::VACTUAL,
+            chip::tmc5160::RAMP_STAT,
+            chip::tmc5160::DRV_STATUS>()};
+        if (!values) [[unlikely]]
+        {
+            increment(m_read_errors);
+            return tl::unexpected(values.error());
+        }
+
+        const auto& [x_actual, v_actual, ramp_stat, drv_status]{*values};
+        const TelemetrySample record{.timestamp = now,
+            .motion = MotionSnapshot::from_registers(x_actual, v_actual, ramp_stat, m_axis.last_status()),
+            .drv_status = drv_status};
+
+        if (!m_ring.try_push(record)) [[unlikely]]
+        {
+            increment(m_dropped);
+            return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief Samples lost because the ring was full.
+     */
+    [[nodiscard]] uint32_t dropped() const noexcept
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Samples lost because the SPI burst failed.
+     */
+    [[nodiscard]] uint32_t read_errors() const noexcept
+    {
+        return m_read_errors.load(std::memory_order_relaxed);
+    }
+
+  private:
+    Axis& m_axis;
+    ring_t& m_ring;
+    uint32_t m_period{};
+    uint32_t m_last_sample{};
+    bool m_started{};
+
+    std::atomic<uint32_t> m_dropped{};
+    std::atomic<uint32_t> m_read_errors{};
+
+    /**
+     * @brief Single-writer increment: plain load/store, no read-modify-write atomics (Cortex-M0 friendly).
+     */
+    static void increment(std::atomic<uint32_t>& counter) noexcept
+    {
+        counter.store(counter.load(std::memory_order_relaxed) + 1U, std::memory_order_relaxed);
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_TELEMETRY_SAMPLER_HPP
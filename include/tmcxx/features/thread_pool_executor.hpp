@@ -0,0 +1,149 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : thread_pool_executor
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_THREAD_POOL_EXECUTOR_HPP
+#define TMCXX_FEATURES_THREAD_POOL_EXECUTOR_HPP
+
+#include "tmcxx/features/axis_group.hpp"
+
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <span>
+#include <thread>
+
+namespace tmcxx::features {
+
+/**
+ * @brief LaneExecutor with persistent worker threads (hosted targets, e.g. Linux).
+ *
+ * The calling thread runs task 0 and the workers the remaining ones, strided by worker count, so
+ * Workers = lane count - 1 runs every bus in parallel without waking a thread per call.
+ *
+ * @tparam Workers Number of worker threads.
+ */
+template<std::size_t Workers>
+requires(Workers > 0U)
+class ThreadPoolExecutor {
+  public:
+    ThreadPoolExecutor()
+    {
+        for (std::size_t idx{}; idx < Workers; ++idx)
+        {
+            m_threads[idx] = std::thread{[this, idx] {
+                worker_loop(idx);
+            }};
+        }
+    }
+
+    ThreadPoolExecutor(const ThreadPoolExecutor&) = delete;
+    ThreadPoolExecutor& operator=(const ThreadPoolExecutor&) = delete;
+
+    ~ThreadPoolExecutor()
+    {
+        {
+            const std::lock_guard lock{m_mutex};
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+
+        for (auto& thread: m_threads)
+        {
+            thread.join();
+        }
+    }
+
+    /**
+     * @brief Run all tasks, blocking until the last one finished.
+     *
+     * @param tasks Tasks to run; concurrent calls to execute() are serialised.
+     */
+    void execute(std::span<const LaneTask> tasks)
+    {
+        if (tasks.empty())
+        {
+            return;
+        }
+
+        const std::lock_guard serial{m_execute_mutex};
+
+        {
+            const std::lock_guard lock{m_mutex};
+            m_tasks = tasks;
+            m_pending = Workers;
+            ++m_generation;
+        }
+        m_wake.notify_all();
+
+        tasks.front().run(tasks.front().context);
+
+        std::unique_lock lock{m_mutex};
+        m_done.wait(lock, [this] {
+            return m_pending == 0U;
+        });
+    }
+
+  private:
+    std::array<std::thread, Workers> m_threads{};
+
+    std::mutex m_execute_mutex{};
+    std::mutex m_mutex{};
+    std::condition_variable m_wake{};
+    std::condition_variable m_done{};
+
+    std::span<const LaneTask> m_tasks{};
+    std::size_t m_pending{};
+    uint64_t m_generation{};
+    bool m_stopping{};
+
+    void worker_loop(std::size_t worker)
+    {
+        uint64_t seen_generation{};
+
+        while (true)
+        {
+            std::span<const LaneTask> tasks{};
+
+            {
+                std::unique_lock lock{m_mutex};
+                m_wake.wait(lock, [this, seen_generation] {
+                    return m_stopping || m_generation != seen_generation;
+                });
+
+                if (m_stopping)
+                {
+                    return;
+                }
+
+                seen_generation = m_generation;
+                tasks = m_tasks;
+            }
+
+            for (std::size_t idx{worker + 1U}; idx < tasks.size(); idx += Workers)
+            {
+                tasks[idx].run(tasks[idx].context);
+            }
+
+            bool last{};
+            {
+                const std::lock_guard lock{m_mutex};
+                last = (--m_pending == 0U);
+            }
+
+            if (last)
+            {
+                m_done.notify_one();
+            }
+        }
+    }
+};
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_THREAD_POOL_EXECUTOR_HPP
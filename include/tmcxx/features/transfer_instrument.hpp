@@ -0,0 +1,265 @@
+/************************************************************
+ *  Project : TMCxx
+ *  File    : transfer_instrument
+ *  Author  : Mustafa Berk YILMAZ (mustafa.yilmaz@redearge.com)
+ *  Created : 14.10.2026
+ ************************************************************/
+
+#ifndef TMCXX_FEATURES_TRANSFER_INSTRUMENT_HPP
+#define TMCXX_FEATURES_TRANSFER_INSTRUMENT_HPP
+
+#include "tmcxx/helpers/constants.hpp"
+
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+namespace tmcxx::features {
+
+/**
+ * @brief One TSpi transfer as seen by CoreCommunicator.
+ *
+ * A blocking transfer() or an asynchronous datagram carries one 5-byte datagram, a transfer_frames() batch several.
+ */
+struct TransferEvent
+{
+    /**
+     * @brief Datagrams sent, 5 bytes each; byte 0 of every datagram is the address with the write bit.
+     */
+    std::span<const uint8_t> tx{};
+
+    /**
+     * @brief Replies received (valid when success is set).
+     */
+    std::span<const uint8_t> rx{};
+
+    /**
+     * @brief Duration of the TSpi call (from submission to completion for async datagrams), in instrument ticks.
+     */
+    uint32_t ticks{};
+
+    bool success{};
+
+    [[nodiscard]] constexpr std::size_t datagrams() const noexcept
+    {
+        return tx.size() / datagram_size;
+    }
+
+    static constexpr std::size_t datagram_size{5U};
+};
+
+/**
+ * @brief Instrumentation policy of CoreCommunicator.
+ *
+ * When enabled is false every hook is discarded at compile time; CoreCommunicator stores the policy with
+ * [[no_unique_address]], so NoInstrumentation adds neither code nor data. Otherwise now() is sampled around each
+ * TSpi call and record() receives the event, in the context of the transfer (an interrupt for async devices).
+ */
+template<typename T>
+concept TransferInstrument = requires(T instrument, const TransferEvent& event) {
+    { T::enabled } -> std::convertible_to<bool>;
+    { instrument.now() } -> std::same_as<uint32_t>;
+    { instrument.record(event) } -> std::same_as<void>;
+};
+
+/**
+ * @brief Default policy: no instrumentation.
+ */
+struct NoInstrumentation
+{
+    static constexpr bool enabled{false};
+
+    [[nodiscard]] constexpr uint32_t now() const noexcept
+    {
+        return 0U;
+    }
+
+    constexpr void record(const TransferEvent&) const noexcept
+    {
+    }
+};
+
+/**
+ * @brief Instrumentation policy collecting SPI counters and a latency histogram.
+ *
+ * Counts datagrams per register address: a read is attributed to the address of its request datagram, so a
+ * pipelined burst also counts the dummy request that fetches the last reply. Latencies go into power-of-two buckets;
+ * bucket 0 holds zero-tick transfers and bucket i latencies in [2^(i-1), 2^i), the last bucket everything above.
+ * Without a clock every latency is 0.
+ *
+ * @code
+ * TMC5160<MySpi, features::Converter, features::TransferStats> motor{spi, settings};
+ * motor.instrument().set_clock(&micros);
+ * (void)motor.apply_default_configuration();
+ * const auto writes{motor.instrument().writes(chip::tmc5160::RegAddress::CHOPCONF)};
+ * @endcode
+ *
+ * Updates are not synchronised; read the counters from the thread that owns the driver.
+ */
+class TransferStats {
+  public:
+    static constexpr bool enabled{true};
+
+    static constexpr std::size_t histogram_buckets{16U};
+
+    using clock_t = uint32_t (*)() noexcept;
+    using trace_hook_t = void (*)(void* context, const TransferEvent& event);
+
+    /**
+     * @brief Per-address datagram counters.
+     */
+    struct RegisterCounters
+    {
+        uint32_t reads{};
+        uint32_t writes{};
+        uint32_t failures{};
+    };
+
+    [[nodiscard]] uint32_t now() const noexcept
+    {
+        return (nullptr != m_clock) ? m_clock() : 0U;
+    }
+
+    void record(const TransferEvent& event) noexcept
+    {
+        ++m_transfers;
+        m_bytes += event.tx.size();
+        ++m_histogram[bucket(event.ticks)];
+
+        if (!event.success)
+        {
+            ++m_failed_transfers;
+        }
+
+        for (std::size_t offset{}; offset < event.tx.size(); offset += TransferEvent::datagram_size)
+        {
+            auto& counters{m_registers[event.tx[offset] & address_mask]};
+
+            if ((event.tx[offset] & helpers::constant::tmc_write_bit) != 0U)
+            {
+                ++counters.writes;
+            }
+            else
+            {
+                ++counters.reads;
+            }
+
+            if (!event.success)
+            {
+                ++counters.failures;
+            }
+        }
+
+        if (nullptr != m_trace_hook)
+        {
+            m_trace_hook(m_trace_context, event);
+        }
+    }
+
+    /**
+     * @brief Set the latency clock (e.g. a microsecond counter), nullptr to stop measuring.
+     */
+    void set_clock(clock_t clock) noexcept
+    {
+        m_clock = clock;
+    }
+
+    /**
+     * @brief Install a hook called with every transfer, nullptr to remove it.
+     */
+    void set_trace_hook(trace_hook_t hook, void* context = nullptr) noexcept
+    {
+        m_trace_hook = hook;
+        m_trace_context = context;
+    }
+
+    /**
+     * @brief Clear every counter (clock and trace hook are kept).
+     */
+    void reset() noexcept
+    {
+        m_registers = {};
+        m_histogram = {};
+        m_transfers = 0U;
+        m_failed_transfers = 0U;
+        m_bytes = 0U;
+    }
+
+    [[nodiscard]] const RegisterCounters& counters(uint8_t address) const noexcept
+    {
+        return m_registers[address & address_mask];
+    }
+
+    template<typename Addr>
+    requires std::is_enum_v<Addr>
+    [[nodiscard]] uint32_t reads(Addr address) const noexcept
+    {
+        return counters(static_cast<uint8_t>(address)).reads;
+    }
+
+    template<typename Addr>
+    requires std::is_enum_v<Addr>
+    [[nodiscard]] uint32_t writes(Addr address) const noexcept
+    {
+        return counters(static_cast<uint8_t>(address)).writes;
+    }
+
+    /**
+     * @brief Number of TSpi calls (a batch counts once).
+     */
+    [[nodiscard]] uint32_t transfers() const noexcept
+    {
+        return m_transfers;
+    }
+
+    [[nodiscard]] uint32_t failed_transfers() const noexcept
+    {
+        return m_failed_transfers;
+    }
+
+    /**
+     * @brief Bytes sent (5 per datagram).
+     */
+    [[nodiscard]] uint64_t bytes() const noexcept
+    {
+        return m_bytes;
+    }
+
+    [[nodiscard]] const std::array<uint32_t, histogram_buckets>& latency_histogram() const noexcept
+    {
+        return m_histogram;
+    }
+
+    /**
+     * @brief Histogram bucket of a latency.
+     */
+    [[nodiscard]] static constexpr std::size_t bucket(uint32_t ticks) noexcept
+    {
+        const auto width{static_cast<std::size_t>(std::bit_width(ticks))};
+        return (width < histogram_buckets) ? width : histogram_buckets - 1U;
+    }
+
+  private:
+    static constexpr uint8_t address_mask{0x7FU};
+
+    std::array<RegisterCounters, helpers::constant::tmc_register_count> m_registers{};
+    std::array<uint32_t, histogram_buckets> m_histogram{};
+    uint32_t m_transfers{};
+    uint32_t m_failed_transfers{};
+    uint64_t m_bytes{};
+
+    clock_t m_clock{};
+    trace_hook_t m_trace_hook{};
+    void* m_trace_context{};
+};
+
+static_assert(TransferInstrument<NoInstrumentation>);
+static_assert(TransferInstrument<TransferStats>);
+
+} // namespace tmcxx::features
+
+#endif // TMCXX_FEATURES_TRANSFER_INSTRUMENT_HPP
@@ -9,16 +9,30 @@
 #define TMCXX_TMC5160_HPP
 
 #include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/chips/tmc5160_settings.hpp"
 #include "tmcxx/detail/tmc5160_bus.hpp"
 #include "tmcxx/detail/tmc5160_motion.hpp"
 #include "tmcxx/detail/tmc5160_register_access.hpp"
 #include "tmcxx/features/converter.hpp"
 #include "tmcxx/features/core_communicator.hpp"
+#include "tmcxx/features/fixed_point_converter.hpp"
+#include "tmcxx/features/microstep_table.hpp"
+#include "tmcxx/features/motion_profile.hpp"
+#include "tmcxx/features/motion_wait.hpp"
+#include "tmcxx/features/persistent_image.hpp"
+#include "tmcxx/features/ramp_predictor.hpp"
+#include "tmcxx/features/register_image.hpp"
+#include "tmcxx/features/register_snapshot.hpp"
+#include "tmcxx/features/spi_transport.hpp"
 #include "tmcxx/helpers/constants.hpp"
 #include "tmcxx/helpers/error.hpp"
 #include "tmcxx/vendor/expected.hpp"
 
+#include <array>
+#include <concepts>
+#include <cstddef>
 #include <cstdint>
+#include <span>
 
 namespace tmcxx {
 
@@ -27,7 +41,16 @@ namespace tmcxx {
     return (... && args.has_value());
 }
 
-template<core::concepts::SpiDevice TSpi>
+/**
+ * @brief TMC5160 stepper driver.
+ *
+ * @tparam TSpi SPI device type satisfying SpiDevice concept.
+ * @tparam TConverter Unit converter; features::FixedPointConverter keeps float math off the motion path.
+ * @tparam TInstrument Transfer instrumentation policy; features::TransferStats counts datagrams per register.
+ */
+template<core::concepts::SpiDevice TSpi,
+    core::concepts::UnitConverter TConverter = features::Converter,
+    features::TransferInstrument TInstrument = features::NoInstrumentation>
 class TMC5160 {
     /**
      * @brief Register address enum type alias.
@@ -37,12 +60,12 @@ class TMC5160 {
     /**
      * @brief Bus type alias.
      */
-    using bus_t = detail::TMC5160Bus<TSpi>;
+    using bus_t = detail::TMC5160Bus<TSpi, TInstrument>;
 
     /**
      * @brief Motion type alias.
      */
-    using motion_t = detail::TMC5160Motion<bus_t>;
+    using motion_t = detail::TMC5160Motion<bus_t, TConverter>;
 
     /**
      * @brief Register access type alias.
@@ -50,34 +73,10 @@ class TMC5160 {
     using regs_access_t = detail::TMC5160RegisterAccess<bus_t>;
 
   public:
-    struct Settings
-    {
-        units::frequency_t f_clk_hz{helpers::constant::default_clock_freq};
-        units::resistance_t r_sense{helpers::constant::default_r_sense_ohms};
-        units::microsteps_t full_steps{helpers::constant::default_full_steps};
-
-        units::current_t run_current{};
-        units::current_t hold_current{};
-        uint8_t hold_delay{};
-        uint8_t power_down_delay{};
-
-        units::rpm_t v_start{};
-        units::rpm_t v_stop{};
-        units::rpm_t v_1{};
-        units::rpm_t v_max{};
-
-        units::acceleration_t a_1{};
-        units::acceleration_t a_max{};
-        units::acceleration_t d_max{};
-        units::acceleration_t d_1{};
-
-        bool stealth_chop_enabled{};
-
-        uint8_t toff{};
-        uint8_t hstrt{};
-        int8_t hend{};
-        uint8_t tbl{};
-    };
+    /**
+     * @brief Driver configuration (chip::tmc5160::Settings).
+     */
+    using Settings = chip::tmc5160::Settings;
 
     /**
      * @brief TMC5160 Constructor
@@ -99,7 +98,9 @@ class TMC5160 {
      */
     [[nodiscard]] helpers::result_t<void> apply_default_configuration() noexcept
     {
-        if (!is_all_ok(m_bus.template write<chip::tmc5160::VSTOP>(100U),
+        m_bus.begin_transaction();
+
+        const bool staged{is_all_ok(m_bus.template write<chip::tmc5160::VSTOP>(100U),
                 m_bus.template write<chip::tmc5160::V1>(40'000U),
                 m_bus.template write<chip::tmc5160::AMAX>(10'000U),
                 m_bus.template write<chip::tmc5160::DMAX>(10'000U),
@@ -114,92 +115,355 @@ class TMC5160 {
                 m_bus.template write_field<chip::tmc5160::CHOPCONF::toff_t>(3U),
                 m_bus.template write_field<chip::tmc5160::CHOPCONF::hstrt_t>(4U),
                 m_bus.template write_field<chip::tmc5160::CHOPCONF::hend_t>(1U),
-                m_bus.template write_field<chip::tmc5160::CHOPCONF::tbl_t>(2U),
+                m_bus.template write_field<chip::tmc5160::CHOPCONF::tbl_t>(2U))};
 
-                m_bus.template write<chip::tmc5160::XTARGET>(0U))) [[unlikely]]
+        if (const auto res{m_bus.commit()}; !staged || !res) [[unlikely]]
         {
             return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
         }
 
+        // Outside the commit, which sorts by address: XTARGET and RAMPMODE keep the baseline order.
+        if (const auto res{m_bus.template write<chip::tmc5160::XTARGET>(0U)}; !res) [[unlikely]]
+        {
+            return res;
+        }
+
         return m_bus.template write<chip::tmc5160::RAMPMODE>(
             static_cast<uint32_t>(chip::tmc5160::RampModeType::POSITIONING));
     }
 
     /**
      * @brief Apply the settings from the Settings struct.
+     *
+     * The configuration registers are staged in the shadow cache first, so every register is sent exactly once, in
+     * ascending address order. XTARGET = 0 and XACTUAL = 0 follow the commit back to back, so the ramp generator
+     * never sees a zeroed position with the old target for more than one datagram.
      * @return Result<void> (Success or ErrorCode).
      */
     [[nodiscard]] helpers::result_t<void> apply_settings() noexcept
     {
-        using namespace units::literals;
+        m_bus.begin_transaction();
 
-        if (const auto res{m_bus.template write<chip::tmc5160::RAMPMODE>(
-                static_cast<uint32_t>(chip::tmc5160::RampModeType::POSITIONING))};
-            !res) [[unlikely]]
+        const auto staged{stage_settings()};
+        const auto committed{m_bus.commit()};
+
+        if (!staged) [[unlikely]]
         {
-            return res;
+            return staged;
         }
 
-        if (const auto res{m_motion.set_start_speed(m_settings.v_start)}; !res) [[unlikely]]
+        if (!committed) [[unlikely]]
         {
-            return res;
+            return committed;
         }
-        if (const auto res{m_motion.set_stop_velocity(m_settings.v_stop)}; !res) [[unlikely]]
+
+        if (const auto res{m_bus.template write<chip::tmc5160::XTARGET>(0U)}; !res) [[unlikely]]
         {
             return res;
         }
-        if (const auto res{m_motion.set_ramp_transition_velocity(m_settings.v_1)}; !res) [[unlikely]]
+
+        return m_bus.template write<chip::tmc5160::XACTUAL>(0U);
+    }
+
+    /**
+     * @brief Reconfigure the chip from the shadow copy after a reset or brown-out.
+     *
+     * Rewrites only the configuration registers written so far, once each. Position (XACTUAL) and target (XTARGET)
+     * are not replayed, so the motor does not start moving.
+     *
+     * @code
+     * if (motor.last_status().reset_flag()) { motor.restore_from_shadow(); }
+     * @endcode
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> restore_from_shadow()
+    {
+        return m_bus.restore_from_shadow();
+    }
+
+    /**
+     * @brief Forget that the shadow copy matches the chip, e.g. after a failed DaisyChain frame.
+     *
+     * Values are kept: apply_profile() resends every register and restore_from_shadow() still replays them.
+     */
+    void invalidate_shadow() noexcept
+    {
+        m_bus.invalidate_shadow();
+    }
+
+    /**
+     * @brief Stream a precomputed register image (see features::make_register_image).
+     *
+     * Equivalent to apply_settings() for the Settings the image was built from, without any unit conversion at
+     * runtime. Like apply_settings(), the configuration registers go out as one commit() and the position
+     * registers (XTARGET, XACTUAL) are written after it, in image order.
+     *
+     * @param image Register values in apply_settings() order.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> apply_register_image(const features::register_image_t& image)
+    {
+        m_bus.begin_transaction();
+
+        bool staged{true};
+        for (const auto& [address, value]: image)
         {
-            return res;
+            if (chip::tmc5160::ShadowLayout::is_restorable(address))
+            {
+                staged = m_regs.set_register_value(static_cast<regs_t>(address), value).has_value() && staged;
+            }
         }
-        if (const auto res{m_motion.set_max_velocity(m_settings.v_max)}; !res) [[unlikely]]
+
+        if (const auto res{m_bus.commit()}; !res) [[unlikely]]
         {
             return res;
         }
 
-        if (auto res{
-                m_motion.set_advanced_acceleration(m_settings.a_1, m_settings.a_max, m_settings.d_max, m_settings.d_1)};
-            !res) [[unlikely]]
+        if (!staged) [[unlikely]]
         {
-            return res;
+            return tl::unexpected(helpers::ErrorCode::REGISTER_ACCESS_FAILED);
         }
 
-        const auto run_current_val{m_converter.current_to_cs(m_settings.run_current)};
+        for (const auto& [address, value]: image)
+        {
+            if (chip::tmc5160::ShadowLayout::is_restorable(address))
+            {
+                continue;
+            }
 
-        if (const auto hold_current_val{m_converter.current_to_cs(m_settings.hold_current)};
-            !is_all_ok(m_bus.template write_field<chip::tmc5160::IHOLD_IRUN::i_run_t>(run_current_val),
-                m_bus.template write_field<chip::tmc5160::IHOLD_IRUN::i_hold_t>(hold_current_val),
-                m_bus.template write_field<chip::tmc5160::IHOLD_IRUN::i_hold_delay_t>(m_settings.hold_delay)))
+            if (const auto res{m_regs.set_register_value(static_cast<regs_t>(address), value)}; !res) [[unlikely]]
+            {
+                return res;
+            }
+        }
+
+        return {};
+    }
+
+    /**
+     * @brief Switch to a precomputed profile (see TMC5160Builder::build_profile), writing only what changed.
+     *
+     * Registers whose shadow is valid and already holds the profile value are skipped; the rest go out in one
+     * commit(). Switching between profiles that differ in VMAX and IRUN costs two datagrams. Registers never
+     * written, or not confirmed since a failed write, are always sent.
+     *
+     * @param profile Register words to apply.
+     * @return Result<void>: REGISTER_ACCESS_FAILED if an entry could not be staged (the others are still sent),
+     * else the commit() result.
+     */
+    [[nodiscard]] helpers::result_t<void> apply_profile(const features::Profile& profile)
+    {
+        const auto& core{m_bus.core()};
+
+        m_bus.begin_transaction();
+
+        bool staged{true};
+        for (const auto& [address, value]: profile.writes)
         {
-            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+            if (core.is_shadow_valid(address) && core.get_shadow(address) == value)
+            {
+                continue;
+            }
+
+            staged = m_regs.set_register_value(static_cast<regs_t>(address), value).has_value() && staged;
         }
 
-        if (const auto res{m_bus.template write<chip::tmc5160::TWPOWER_DOWN>(m_settings.power_down_delay)}; !res)
-            [[unlikely]]
+        const auto committed{m_bus.commit()};
+
+        if (!staged) [[unlikely]]
         {
-            return res;
+            return tl::unexpected(helpers::ErrorCode::REGISTER_ACCESS_FAILED);
         }
 
-        if (!is_all_ok(m_bus.template write_field<chip::tmc5160::CHOPCONF::toff_t>(m_settings.toff),
-                m_bus.template write_field<chip::tmc5160::CHOPCONF::hstrt_t>(m_settings.hstrt),
-                m_bus.template write_field<chip::tmc5160::CHOPCONF::hend_t>(m_settings.hend),
-                m_bus.template write_field<chip::tmc5160::CHOPCONF::tbl_t>(m_settings.tbl)))
+        return committed;
+    }
+
+    /**
+     * @brief Apply a binary register image (see features::RegisterImageView) in one commit().
+     *
+     * Every entry is staged in the shadow cache and the whole image goes out as one coalesced burst; afterwards the
+     * shadow is valid for all of them, so apply_profile() and restore_from_shadow() work without apply_settings().
+     * Images hold restorable registers only: unlike apply_settings(), XACTUAL and XTARGET are left untouched.
+     *
+     * @code
+     * const auto image{features::RegisterImageView::parse(flash_bytes)};
+     * if (image) { (void)motor.apply_image(*image); }
+     * @endcode
+     *
+     * @param image Parsed image.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> apply_image(const features::RegisterImageView& image)
+    {
+        m_bus.begin_transaction();
+
+        bool staged{true};
+        for (const auto [address, value]: image)
         {
-            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+            staged = m_regs.set_register_value(static_cast<regs_t>(address), value).has_value() && staged;
         }
 
-        if (const auto res{m_motion.set_stealth_chop(m_settings.stealth_chop_enabled)}; !res) [[unlikely]]
+        const auto committed{m_bus.commit()};
+
+        if (!staged) [[unlikely]]
         {
-            return res;
+            return tl::unexpected(helpers::ErrorCode::REGISTER_ACCESS_FAILED);
         }
 
-        if (!is_all_ok(m_bus.template write<chip::tmc5160::XTARGET>(0U),
-                m_bus.template write<chip::tmc5160::XACTUAL>(0U))) [[unlikely]]
+        return committed;
+    }
+
+    /**
+     * @brief Serialize the configured registers of the shadow cache as a binary image, without SPI traffic.
+     *
+     * Covers what restore_from_shadow() would replay; XTARGET, XACTUAL and other trigger or volatile registers are
+     * not part of it.
+     *
+     * @param out Destination, up to features::image_format::image_size(configured registers) bytes.
+     * @return Bytes written, or INVALID_PARAMETER if @p out is too small.
+     */
+    [[nodiscard]] helpers::result_t<std::size_t> dump_image(std::span<uint8_t> out) const
+    {
+        const auto& core{m_bus.core()};
+
+        std::array<features::RegisterWrite, features::image_format::max_entries> writes{};
+        std::size_t count{};
+
+        for (const uint8_t address: chip::tmc5160::ShadowLayout::address_of_slot)
         {
-            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+            if (core.is_configured(address))
+            {
+                writes[count++] = features::RegisterWrite{address, core.get_shadow(address).value_or(0U)};
+            }
         }
 
-        return {};
+        return features::write_register_image(std::span{writes}.first(count), out);
+    }
+
+    /**
+     * @brief Upload a microstep table (MSLUT_0..7, MSLUTSEL, MSLUTSTART) as one burst of 10 datagrams.
+     *
+     * The table is not shadowed, so restore_from_shadow() does not replay it: upload it again after a chip reset.
+     * On a DaisyChain with a QueueDepth of at least MicrostepTable::register_count, uploading inside
+     * begin_frame()/end_frame() on every axis costs 10 frames for the whole chain.
+     *
+     * @code
+     * constexpr auto table{features::make_microstep_table<features::sine_quarter_wave(240U)>()};
+     * chain.begin_frame();
+     * (void)x_axis.load_microstep_table(table);
+     * (void)y_axis.load_microstep_table(table);
+     * (void)chain.end_frame();
+     * @endcode
+     *
+     * @param table Precomputed register words.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> load_microstep_table(const features::MicrostepTable& table)
+    {
+        const auto values{table.values()};
+
+        return m_bus.write_burst(features::MicrostepTable::addresses, values);
+    }
+
+    /**
+     * @brief Scale the encoder to XACTUAL units: ENC_CONST from the resolution and ENCMODE.enc_sel_decimal.
+     *
+     * Decimal mode is selected when it represents the factor exactly and binary mode does not (e.g. 4000 counts
+     * give 12.8 microsteps per count). Both registers go out in one commit() and are replayed by
+     * restore_from_shadow().
+     *
+     * @param counts_per_rev Encoder counts per revolution; negative if the encoder counts against the motor.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> configure_encoder(int32_t counts_per_rev)
+    {
+        if (0 == counts_per_rev) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::INVALID_PARAMETER);
+        }
+
+        constexpr int64_t microsteps{256};
+        constexpr int64_t binary_scale{65'536};
+        constexpr int64_t decimal_scale{10'000};
+
+        const int64_t steps{static_cast<int64_t>(m_settings.full_steps.raw()) * microsteps};
+        const bool decimal{((steps * decimal_scale) % counts_per_rev) == 0 &&
+                           ((steps * binary_scale) % counts_per_rev) != 0};
+
+        const features::Converter converter{m_settings.f_clk_hz, m_settings.full_steps, m_settings.r_sense};
+
+        m_bus.begin_transaction();
+
+        const bool staged{is_all_ok(
+            m_bus.template write_field<chip::tmc5160::ENCMODE::enc_sel_decimal_t>(decimal ? 1U : 0U),
+            m_bus.template write<chip::tmc5160::ENC_CONST>(converter.encoder_to_enc_const(counts_per_rev, decimal)))};
+
+        const auto committed{m_bus.commit()};
+
+        if (!staged) [[unlikely]]
+        {
+            return tl::unexpected(helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+        }
+
+        return committed;
+    }
+
+    /**
+     * @brief Clear sticky RAMP_STAT events by writing 1 to them (RAMP_STAT is not shadowed).
+     *
+     * Only the given events are cleared; the datagram goes out at once, also inside a transaction.
+     *
+     * @code
+     * (void)motor.clear_ramp_events(chip::tmc5160::RAMP_STAT::event_stop_sg_t{1U}.value);
+     * @endcode
+     *
+     * @param events RAMP_STAT event bits to clear; bits outside RAMP_STAT::event_mask are ignored.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> clear_ramp_events(uint32_t events)
+    {
+        constexpr std::array<uint8_t, 1> address{chip::tmc5160::RAMP_STAT::address};
+        const std::array<uint32_t, 1> value{events & chip::tmc5160::RAMP_STAT::event_mask};
+
+        return m_bus.write_burst(address, value);
+    }
+
+    /**
+     * @brief Set the encoder position, e.g. to XACTUAL after homing (X_ENC is not shadowed).
+     *
+     * @param position Encoder position in XACTUAL units.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> set_encoder_position(int32_t position)
+    {
+        constexpr std::array<uint8_t, 1> address{chip::tmc5160::X_ENC::address};
+        const std::array<uint32_t, 1> value{static_cast<uint32_t>(position)};
+
+        return m_bus.write_burst(address, value);
+    }
+
+    /**
+     * @brief Start staging register writes; see commit().
+     *
+     * @code
+     * motor.begin_transaction();
+     * motor.set_irun(1.2_A);
+     * motor.set_ihold(0.4_A);
+     * motor.commit(); // IHOLD_IRUN is sent once
+     * @endcode
+     */
+    void begin_transaction() noexcept
+    {
+        m_bus.begin_transaction();
+    }
+
+    /**
+     * @brief Send every register staged since begin_transaction() exactly once.
+     * @return Result<void>.
+     */
+    [[nodiscard]] helpers::result_t<void> commit()
+    {
+        return m_bus.commit();
     }
 
     /**
@@ -290,6 +554,231 @@ class TMC5160 {
         return m_motion.get_actual_velocity();
     }
 
+    /**
+     * @brief Read signed position, signed velocity, RAMP_STAT and SPI status with one pipelined burst.
+     *
+     * Register units only; convert lazily, e.g. snapshot.velocity_rpm(converter()).
+     * @return Result<MotionSnapshot>.
+     */
+    [[nodiscard]] helpers::result_t<features::MotionSnapshot> get_motion_snapshot()
+    {
+        return m_motion.get_motion_snapshot();
+    }
+
+    /**
+     * @brief Read several registers with one pipelined burst.
+     *
+     * @tparam Regs Register types from tmc5160_registers.hpp.
+     * @return Register values in template argument order, or error.
+     */
+    template<core::concepts::Register... Regs>
+    [[nodiscard]] helpers::result_t<std::array<uint32_t, sizeof...(Regs)>> read_registers()
+    {
+        return m_bus.template read_many<Regs...>();
+    }
+
+    /**
+     * @brief Write a raw register value (staged while a transaction is open).
+     *
+     * @tparam Reg Writable register type from tmc5160_registers.hpp.
+     * @param value Register value.
+     * @return Result<void>.
+     */
+    template<core::concepts::WritableRegister Reg>
+    [[nodiscard]] helpers::result_t<void> write_register(uint32_t value)
+    {
+        return m_bus.template write<Reg>(value);
+    }
+
+    /**
+     * @brief Write one field, merged into the shadow copy of its register (staged while a transaction is open).
+     *
+     * @tparam Field Writable field type (e.g. chip::tmc5160::COOLCONF::sgt_t).
+     * @param value Field value.
+     * @return Result<void>.
+     */
+    template<core::concepts::WritableField Field>
+    [[nodiscard]] helpers::result_t<void> write_field(uint32_t value)
+    {
+        return m_bus.template write_field<Field>(value);
+    }
+
+    /**
+     * @brief Unit converter built from the settings.
+     * @return Const reference to the converter.
+     */
+    [[nodiscard]] const TConverter& converter() const noexcept
+    {
+        return m_converter;
+    }
+
+    /**
+     * @brief Predict a positioning move of @p distance with the ramp registers last written to the chip.
+     *
+     * Reads the shadow cache only, no SPI traffic. Registers never written count as 0, their reset value.
+     *
+     * @code
+     * motor.move_to(target, 300_rpm);
+     * const auto move{motor.predict_move(target - position)};
+     * wait(move.duration()); // poll position_reached only from here on
+     * @endcode
+     *
+     * @param distance Signed distance from the current position to the target.
+     * @return Predicted phases, duration and position over time.
+     */
+    [[nodiscard]] features::RampPrediction predict_move(units::microsteps_t distance) const noexcept
+    {
+        const auto shadow{[this](uint8_t address) { return m_bus.get_shadow(address).value_or(0U); }};
+
+        const features::RampRegisters ramp{.v_start = shadow(chip::tmc5160::VSTART::address),
+            .a_1 = shadow(chip::tmc5160::A1::address),
+            .v_1 = shadow(chip::tmc5160::V1::address),
+            .a_max = shadow(chip::tmc5160::AMAX::address),
+            .v_max = shadow(chip::tmc5160::VMAX::address),
+            .d_max = shadow(chip::tmc5160::DMAX::address),
+            .d_1 = shadow(chip::tmc5160::D1::address),
+            .v_stop = shadow(chip::tmc5160::VSTOP::address)};
+
+        const features::Converter converter{m_settings.f_clk_hz, m_settings.full_steps, m_settings.r_sense};
+
+        return features::predict_move(ramp, converter, distance);
+    }
+
+    /**
+     * @brief Transfer instrumentation policy (SPI counters, latency histogram, trace hook).
+     * @return Reference to the policy.
+     */
+    [[nodiscard]] TInstrument& instrument() noexcept
+    {
+        return m_bus.instrument();
+    }
+
+    [[nodiscard]] const TInstrument& instrument() const noexcept
+    {
+        return m_bus.instrument();
+    }
+
+    /**
+     * @brief Confirm every commit() batch against the IFCNT write counter and resend batches that came up short.
+     *
+     * Costs one IFCNT read per batch; see features::CoreCommunicator::set_write_verification(). IFCNT only counts
+     * UART writes, so on an SPI link enabling fails with NOT_IMPLEMENTED and verification stays off.
+     * @param enabled Verify commits.
+     * @param max_resends Resends of a batch before commit() fails with SPI_TRANSFER_FAILED.
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> set_write_verification(bool enabled, uint8_t max_resends = 2U)
+    {
+        return m_bus.core().set_write_verification(enabled, max_resends);
+    }
+
+    /**
+     * @brief Batches resent by write verification since it was enabled.
+     * @return Resend count.
+     */
+    [[nodiscard]] std::size_t resent_batches() const noexcept
+    {
+        return m_bus.core().resent_batches();
+    }
+
+    /**
+     * @brief SPI status flags received with the most recent datagram.
+     *
+     * Free of SPI traffic: any read or write refreshes it (position_reached, standstill, stallguard, ...).
+     * @return SpiStatus.
+     */
+    [[nodiscard]] chip::tmc5160::SpiStatus last_status() const noexcept
+    {
+        return m_bus.last_status();
+    }
+
+    /**
+     * @brief Fetch fresh SPI status flags with a single datagram.
+     * @return Result<SpiStatus>.
+     */
+    [[nodiscard]] helpers::result_t<chip::tmc5160::SpiStatus> poll_status()
+    {
+        return m_bus.poll_status();
+    }
+
+    /**
+     * @brief Block until a status condition holds, polling one status datagram per back-off interval.
+     *
+     * @code
+     * if (const auto res{motor.wait_until(features::WaitCondition::POSITION_REACHED, 2'000'000U, waiter)}; !res)
+     * {
+     *     // res.error() == ErrorCode::TIMEOUT after 2 s of 1 us ticks
+     * }
+     * @endcode
+     *
+     * @param condition Condition to wait for.
+     * @param timeout Timeout in policy ticks.
+     * @param policy Clock and sleep (e.g. features::StdWaitPolicy); its wake signal cuts the back-off short.
+     * @param backoff Poll interval.
+     * @return Result<void>: ErrorCode::TIMEOUT if the condition did not hold in time.
+     */
+    template<features::WaitPolicy Policy>
+    [[nodiscard]] helpers::result_t<void> wait_until(
+        features::WaitCondition condition, uint32_t timeout, Policy& policy, features::Backoff backoff = {})
+    {
+        return features::wait_until(*this, condition, timeout, policy, backoff);
+    }
+
+    /**
+     * @brief Block until the target position is reached; see wait_until().
+     * @return Result<void>.
+     */
+    template<features::WaitPolicy Policy>
+    [[nodiscard]] helpers::result_t<void> wait_for_position(uint32_t timeout, Policy& policy)
+    {
+        return wait_until(features::WaitCondition::POSITION_REACHED, timeout, policy);
+    }
+
+    /**
+     * @brief Block until the velocity ramp reached VMAX; see wait_until().
+     * @return Result<void>.
+     */
+    template<features::WaitPolicy Policy>
+    [[nodiscard]] helpers::result_t<void> wait_for_velocity(uint32_t timeout, Policy& policy)
+    {
+        return wait_until(features::WaitCondition::VELOCITY_REACHED, timeout, policy);
+    }
+
+    /**
+     * @brief Block until the motor stands still; see wait_until().
+     * @return Result<void>.
+     */
+    template<features::WaitPolicy Policy>
+    [[nodiscard]] helpers::result_t<void> wait_for_standstill(uint32_t timeout, Policy& policy)
+    {
+        return wait_until(features::WaitCondition::STANDSTILL, timeout, policy);
+    }
+
+    /**
+     * @brief Block until StallGuard2 reports a stall; see wait_until().
+     * @return Result<void>.
+     */
+    template<features::WaitPolicy Policy>
+    [[nodiscard]] helpers::result_t<void> wait_for_stall(uint32_t timeout, Policy& policy)
+    {
+        return wait_until(features::WaitCondition::STALL, timeout, policy);
+    }
+
+    /**
+     * @brief co_await-able wait_until(); retries run from the policy's timer callback.
+     *
+     * @code
+     * const auto res{co_await motor.async_wait_until(features::WaitCondition::STANDSTILL, 500'000U, timers)};
+     * @endcode
+     * @return Awaitable yielding Result<void>.
+     */
+    template<features::AsyncWaitPolicy Policy>
+    [[nodiscard]] auto async_wait_until(
+        features::WaitCondition condition, uint32_t timeout, Policy& policy, features::Backoff backoff = {})
+    {
+        return features::WaitAwaiter<TMC5160, Policy>{*this, condition, timeout, policy, backoff};
+    }
+
     /**
      * @brief Set motor run current (IRUN).
      *
@@ -440,14 +929,40 @@ class TMC5160 {
     }
 
     /**
+     * @brief Read every mapped register.
      *
-     * @return
+     * @return Register values indexed by address, or the first error.
      */
     [[nodiscard]] helpers::result_t<std::array<uint32_t, helpers::constant::tmc_register_count>> get_all_registers()
     {
         return m_regs.get_all_registers();
     }
 
+    /**
+     * @brief Capture a compile-time selection of registers with one pipelined burst.
+     *
+     * Volatile/RO registers come from the chip, the others from the shadow cache.
+     *
+     * @tparam Mask Registers to capture (all mapped registers by default).
+     * @return Snapshot indexed by address, with per-register errors.
+     */
+    template<features::RegisterMask Mask = regs_access_t::mapped_registers>
+    [[nodiscard]] features::RegisterSnapshot snapshot()
+    {
+        return m_regs.template snapshot<Mask>();
+    }
+
+    /**
+     * @brief Capture a runtime selection of registers with one pipelined burst.
+     *
+     * @param mask Registers to capture.
+     * @return Snapshot indexed by address, with per-register errors.
+     */
+    [[nodiscard]] features::RegisterSnapshot snapshot(const features::RegisterMask& mask)
+    {
+        return m_regs.snapshot(mask);
+    }
+
     /**
      *
      * @param reg_address
@@ -471,17 +986,98 @@ class TMC5160 {
     }
 
   private:
+    /**
+     * @brief Write the Settings struct through the bus (staged by apply_settings()).
+     * @return Result<void> (Success or ErrorCode).
+     */
+    [[nodiscard]] helpers::result_t<void> stage_settings() noexcept
+    {
+        if (const auto res{m_bus.template write<chip::tmc5160::RAMPMODE>(
+                static_cast<uint32_t>(chip::tmc5160::RampModeType::POSITIONING))};
+            !res) [[unlikely]]
+        {
+            return res;
+        }
+
+        if (const auto res{m_motion.set_start_speed(m_settings.v_start)}; !res) [[unlikely]]
+        {
+            return res;
+        }
+        if (const auto res{m_motion.set_stop_velocity(m_settings.v_stop)}; !res) [[unlikely]]
+        {
+            return res;
+        }
+        if (const auto res{m_motion.set_ramp_transition_velocity(m_settings.v_1)}; !res) [[unlikely]]
+        {
+            return res;
+        }
+        if (const auto res{m_motion.set_max_velocity(m_settings.v_max)}; !res) [[unlikely]]
+        {
+            return res;
+        }
+
+        if (auto res{
+                m_motion.set_advanced_acceleration(m_settings.a_1, m_settings.a_max, m_settings.d_max, m_settings.d_1)};
+            !res) [[unlikely]]
+        {
+            return res;
+        }
+
+        const auto run_current_val{m_converter.current_to_cs(m_settings.run_current)};
+
+        if (const auto hold_current_val{m_converter.current_to_cs(m_settings.hold_current)};
+            !is_all_ok(m_bus.template write_field<chip::tmc5160::IHOLD_IRUN::i_run_t>(run_current_val),
+                m_bus.template write_field<chip::tmc5160::IHOLD_IRUN::i_hold_t>(hold_current_val),
+                m_bus.template write_field<chip::tmc5160::IHOLD_IRUN::i_hold_delay_t>(m_settings.hold_delay)))
+        {
+            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+        }
+
+        if (const auto res{m_bus.template write<chip::tmc5160::TWPOWER_DOWN>(m_settings.power_down_delay)}; !res)
+            [[unlikely]]
+        {
+            return res;
+        }
+
+        if (!is_all_ok(m_bus.template write_field<chip::tmc5160::CHOPCONF::toff_t>(m_settings.toff),
+                m_bus.template write_field<chip::tmc5160::CHOPCONF::hstrt_t>(m_settings.hstrt),
+                m_bus.template write_field<chip::tmc5160::CHOPCONF::hend_t>(m_settings.hend),
+                m_bus.template write_field<chip::tmc5160::CHOPCONF::tbl_t>(m_settings.tbl)))
+        {
+            return tl::unexpected(helpers::ErrorCode::SPI_TRANSFER_FAILED);
+        }
+
+        if (const auto res{m_motion.set_stealth_chop(m_settings.stealth_chop_enabled)}; !res) [[unlikely]]
+        {
+            return res;
+        }
+
+        return {};
+    }
+
     /**
      * @brief Tested default datas for running step motor.
      */
 
     bus_t m_bus{};
-    features::Converter m_converter;
+    TConverter m_converter;
     motion_t m_motion{};
     regs_access_t m_regs{};
     Settings m_settings{};
 };
 
+/**
+ * @brief Thin-template TMC5160: one driver instantiation shared by every SPI backend (see features::SpiTransport).
+ *
+ * @tparam TConverter Unit converter, as for TMC5160.
+ * @tparam TInstrument Transfer instrumentation policy, as for TMC5160.
+ * @tparam TTransport features::SpiTransport, or features::BatchSpiTransport for transfer_frames() devices.
+ */
+template<core::concepts::UnitConverter TConverter = features::Converter,
+    features::TransferInstrument TInstrument = features::NoInstrumentation,
+    std::derived_from<features::SpiTransport> TTransport = features::SpiTransport>
+using ThinTMC5160 = TMC5160<TTransport, TConverter, TInstrument>;
+
 } // namespace tmcxx
 
 #endif // TMCXX_TMC5160_HPP
@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/features/axis_group.hpp"
+#include "tmcxx/features/daisy_chain.hpp"
+#include "tmcxx/features/thread_pool_executor.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace units::literals;
+using ::tmcxx::test::MockSpi;
+
+using driver_t = TMC5160<MockSpi>;
+
+constexpr uint8_t xtarget_address{0x2DU};
+constexpr uint8_t vmax_address{0x27U};
+
+static_assert(LaneExecutor<SequentialExecutor>);
+static_assert(LaneExecutor<ThreadPoolExecutor<1>>);
+static_assert(FrameBatcher<DaisyChain<MockSpi, 2>>);
+
+class AxisGroupTest : public ::testing::Test {
+  protected:
+    MockSpi bus_a;
+    MockSpi bus_b;
+
+    driver_t::Settings settings{};
+
+    driver_t x_axis{bus_a, settings};
+    driver_t y_axis{bus_a, settings};
+    driver_t z_axis{bus_b, settings};
+
+    AxisLane<driver_t, 2> lane_a{{&x_axis, &y_axis}};
+    AxisLane<driver_t, 1> lane_b{{&z_axis}};
+
+    SequentialExecutor sequential{};
+};
+
+TEST_F(AxisGroupTest, AxisCountSpansAllLanes)
+{
+    AxisGroup group{sequential, lane_a, lane_b};
+
+    EXPECT_EQ(group.axis_count, 3U);
+    EXPECT_EQ(group.lane_count, 2U);
+}
+
+TEST_F(AxisGroupTest, MoveToUsesTargetPerGroupIndex)
+{
+    AxisGroup group{sequential, lane_a, lane_b};
+
+    ASSERT_TRUE(group.move_to({100_steps, 200_steps, 300_steps}, 60_rpm));
+
+    const auto bus_a_targets{bus_a.find_writes_to(xtarget_address)};
+    ASSERT_EQ(bus_a_targets.size(), 2U);
+    EXPECT_EQ(bus_a_targets[0].get_write_value(), 100U);
+    EXPECT_EQ(bus_a_targets[1].get_write_value(), 200U);
+    EXPECT_EQ(bus_b.get_last_written_value(xtarget_address), 300U);
+}
+
+TEST_F(AxisGroupTest, StopReachesEveryAxis)
+{
+    AxisGroup group{sequential, lane_a, lane_b};
+
+    ASSERT_TRUE(group.stop());
+
+    EXPECT_EQ(bus_a.find_writes_to(vmax_address).size(), 2U);
+    EXPECT_EQ(bus_b.find_writes_to(vmax_address).size(), 1U);
+}
+
+TEST_F(AxisGroupTest, FailureIsReportedAfterCommandingEveryAxis)
+{
+    AxisGroup group{sequential, lane_a, lane_b};
+    bus_a.set_next_transfer_failure(true);
+
+    const auto result{group.rotate(30_rpm)};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(bus_b.find_writes_to(vmax_address).size(), 1U) << "Other lanes must still be commanded";
+}
+
+TEST_F(AxisGroupTest, DaisyChainLaneSharesFrames)
+{
+    using chain_t = DaisyChain<MockSpi, 3>;
+    using chained_driver_t = TMC5160<chain_t::Channel>;
+
+    MockSpi chain_bus{};
+    chain_t chain{chain_bus};
+    chained_driver_t axis_0{chain.channel(0), settings};
+    chained_driver_t axis_1{chain.channel(1), settings};
+    chained_driver_t axis_2{chain.channel(2), settings};
+
+    AxisLane<chained_driver_t, 3, chain_t> chained{chain, {&axis_0, &axis_1, &axis_2}};
+    AxisGroup group{sequential, chained, lane_b};
+
+    ASSERT_TRUE(group.move_to({1_steps, 2_steps, 3_steps, 4_steps}, 60_rpm));
+
+    EXPECT_EQ(chain.frame_count(), 3U) << "RAMPMODE, VSTART, XTARGET for all chained axes";
+    EXPECT_EQ(bus_b.get_last_written_value(xtarget_address), 4U);
+}
+
+TEST_F(AxisGroupTest, FailedChainFrameInvalidatesShadows)
+{
+    using chain_t = DaisyChain<MockSpi, 2, 16>;
+    using chained_driver_t = TMC5160<chain_t::Channel>;
+
+    MockSpi chain_bus{};
+    chain_t chain{chain_bus};
+    chained_driver_t axis_0{chain.channel(0), settings};
+    chained_driver_t axis_1{chain.channel(1), settings};
+    const auto profile{compute_profile(settings)};
+
+    AxisLane<chained_driver_t, 2, chain_t> chained{chain, {&axis_0, &axis_1}};
+    AxisGroup group{sequential, chained};
+    const auto apply_profile{[&profile](auto& axis, std::size_t) {
+        return axis.apply_profile(profile);
+    }};
+
+    chain_bus.set_transfer_failure_after(1U);
+    ASSERT_FALSE(group.for_each_axis(apply_profile));
+    EXPECT_FALSE(chain.lost_writes(0)) << "Reports are discarded once the shadows are invalidated";
+
+    const std::size_t frames_before{chain.frame_count()};
+    ASSERT_TRUE(group.for_each_axis(apply_profile));
+
+    EXPECT_EQ(chain.frame_count() - frames_before, profile.writes.size()) << "Nothing may be skipped as unchanged";
+}
+
+TEST(ThreadPoolExecutorTest, RunsTasksConcurrently)
+{
+    struct Rendezvous
+    {
+        std::atomic<int> arrived{};
+        std::atomic<int> met{};
+    } rendezvous{};
+
+    const auto wait_for_peer{[](void* context) {
+        auto* state{static_cast<Rendezvous*>(context)};
+        state->arrived.fetch_add(1);
+
+        const auto deadline{std::chrono::steady_clock::now() + std::chrono::seconds{2}};
+        while (state->arrived.load() < 2 && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::yield();
+        }
+
+        if (state->arrived.load() == 2)
+        {
+            state->met.fetch_add(1);
+        }
+    }};
+
+    ThreadPoolExecutor<1> pool{};
+    const std::array<LaneTask, 2> tasks{LaneTask{wait_for_peer, &rendezvous}, LaneTask{wait_for_peer, &rendezvous}};
+
+    pool.execute(tasks);
+
+    EXPECT_EQ(rendezvous.met.load(), 2);
+}
+
+TEST(ThreadPoolExecutorTest, RunsEveryTaskWithFewerWorkers)
+{
+    std::atomic<int> runs{};
+    const auto count{[](void* context) {
+        static_cast<std::atomic<int>*>(context)->fetch_add(1);
+    }};
+
+    ThreadPoolExecutor<2> pool{};
+    const std::array<LaneTask, 5> tasks{
+        LaneTask{count, &runs}, LaneTask{count, &runs}, LaneTask{count, &runs}, LaneTask{count, &runs},
+        LaneTask{count, &runs}};
+
+    for (int round{}; round < 10; ++round)
+    {
+        pool.execute(tasks);
+    }
+
+    EXPECT_EQ(runs.load(), 50);
+}
+
+TEST_F(AxisGroupTest, ThreadPoolDrivesLanesInParallel)
+{
+    ThreadPoolExecutor<1> pool{};
+    AxisGroup group{pool, lane_a, lane_b};
+
+    ASSERT_TRUE(group.move_to({10_steps, 20_steps, 30_steps}, 60_rpm));
+
+    EXPECT_EQ(bus_a.find_writes_to(xtarget_address).size(), 2U);
+    EXPECT_EQ(bus_b.get_last_written_value(xtarget_address), 30U);
+}
+
+} // namespace tmcxx::features::test
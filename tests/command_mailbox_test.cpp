@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/features/command_mailbox.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace units::literals;
+using ::tmcxx::test::MockBatchSpi;
+using ::tmcxx::test::MockSpi;
+
+using driver_t = TMC5160<MockSpi>;
+
+constexpr uint8_t rampmode_address{0x20U};
+constexpr uint8_t vmax_address{0x27U};
+constexpr uint8_t xtarget_address{0x2DU};
+
+constexpr MotionSegment slow_velocity{.mode = chip::tmc5160::RampModeType::VELOCITY_POS, .vmax = 1000U};
+constexpr MotionSegment fast_velocity{.mode = chip::tmc5160::RampModeType::VELOCITY_NEG, .vmax = 5000U};
+
+class CommandMailboxTest : public ::testing::Test {
+  protected:
+    MockSpi spi;
+    driver_t::Settings settings{};
+    driver_t axis{spi, settings};
+    CommandMailbox<driver_t> mailbox{axis};
+};
+
+TEST_F(CommandMailboxTest, EmptyDrainSendsNothing)
+{
+    const auto sent{mailbox.drain()};
+
+    ASSERT_TRUE(sent);
+    EXPECT_FALSE(*sent);
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+}
+
+TEST_F(CommandMailboxTest, LatestVelocityWins)
+{
+    mailbox.post(slow_velocity);
+    mailbox.post(fast_velocity);
+    EXPECT_TRUE(mailbox.has_pending());
+
+    const auto sent{mailbox.drain()};
+
+    ASSERT_TRUE(sent);
+    EXPECT_TRUE(*sent);
+    EXPECT_FALSE(mailbox.has_pending());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 2U);
+    EXPECT_EQ(txs[0].get_address(), rampmode_address);
+    EXPECT_EQ(txs[0].get_write_value(), static_cast<uint32_t>(chip::tmc5160::RampModeType::VELOCITY_NEG));
+    EXPECT_EQ(txs[1].get_address(), vmax_address);
+    EXPECT_EQ(txs[1].get_write_value(), 5000U);
+}
+
+TEST_F(CommandMailboxTest, MoveSendsTargetInSameCommit)
+{
+    mailbox.post_move(2500_steps, 120_rpm);
+
+    ASSERT_TRUE(mailbox.drain());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 3U);
+    EXPECT_EQ(txs[1].get_write_value(), axis.converter().rpm_to_vmax(120_rpm));
+    EXPECT_EQ(txs[2].get_address(), xtarget_address);
+    EXPECT_EQ(txs[2].get_write_value(), 2500U);
+}
+
+TEST_F(CommandMailboxTest, StopCancelsEarlierMotion)
+{
+    mailbox.post(fast_velocity);
+    mailbox.post_stop();
+
+    ASSERT_TRUE(mailbox.drain());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 1U);
+    EXPECT_EQ(txs[0].get_address(), vmax_address);
+    EXPECT_EQ(txs[0].get_write_value(), 0U);
+}
+
+TEST_F(CommandMailboxTest, MotionAfterStopIsSentAfterIt)
+{
+    mailbox.post_stop();
+    mailbox.post(slow_velocity);
+
+    ASSERT_TRUE(mailbox.drain());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 3U);
+    EXPECT_EQ(txs[0].get_address(), vmax_address);
+    EXPECT_EQ(txs[0].get_write_value(), 0U);
+    EXPECT_EQ(txs[2].get_write_value(), 1000U);
+}
+
+TEST_F(CommandMailboxTest, FailedDrainRearmsCommand)
+{
+    mailbox.post_stop();
+    spi.set_next_transfer_failure(true);
+
+    const auto failed{mailbox.drain()};
+
+    ASSERT_FALSE(failed);
+    EXPECT_EQ(failed.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_TRUE(mailbox.has_pending());
+
+    ASSERT_TRUE(mailbox.drain());
+    EXPECT_EQ(spi.get_last_written_value(vmax_address), 0U);
+    EXPECT_FALSE(mailbox.has_pending());
+}
+
+TEST_F(CommandMailboxTest, StopDuringFailedMotionDrainCancelsIt)
+{
+    mailbox.post(fast_velocity);
+    spi.set_failure_hook([this] {
+        mailbox.post_stop();
+    });
+    spi.set_next_transfer_failure(true);
+
+    ASSERT_FALSE(mailbox.drain());
+    spi.set_failure_hook({});
+
+    ASSERT_TRUE(mailbox.drain());
+    EXPECT_FALSE(mailbox.has_pending());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 1U) << "The cancelled velocity must not follow the stop";
+    EXPECT_EQ(txs[0].get_address(), vmax_address);
+    EXPECT_EQ(txs[0].get_write_value(), 0U);
+}
+
+TEST_F(CommandMailboxTest, StopDuringFailedStopDrainCancelsLaterMotion)
+{
+    mailbox.post_stop();
+    mailbox.post(slow_velocity);
+    spi.set_failure_hook([this] {
+        mailbox.post_stop();
+    });
+    spi.set_next_transfer_failure(true);
+
+    ASSERT_FALSE(mailbox.drain());
+    spi.set_failure_hook({});
+
+    ASSERT_TRUE(mailbox.drain());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 1U);
+    EXPECT_EQ(txs[0].get_write_value(), 0U);
+}
+
+TEST_F(CommandMailboxTest, WakeHookRunsOnEveryPost)
+{
+    int wakes{};
+    mailbox.set_wake_hook(
+        [](void* context) {
+            ++*static_cast<int*>(context);
+        },
+        &wakes);
+
+    mailbox.post_stop();
+    mailbox.post_velocity(30_rpm);
+
+    EXPECT_EQ(wakes, 2);
+}
+
+TEST_F(CommandMailboxTest, ConcurrentPostsEndWithNewestCommand)
+{
+    constexpr uint32_t posts{2000U};
+    std::atomic<bool> done{false};
+
+    std::thread producer{[&] {
+        for (uint32_t idx{1U}; idx <= posts; ++idx)
+        {
+            mailbox.post(MotionSegment{.mode = chip::tmc5160::RampModeType::VELOCITY_POS, .vmax = idx});
+            std::this_thread::yield();
+        }
+        done.store(true);
+    }};
+
+    while (!done.load())
+    {
+        ASSERT_TRUE(mailbox.drain());
+        std::this_thread::yield();
+    }
+    producer.join();
+    ASSERT_TRUE(mailbox.drain());
+
+    EXPECT_EQ(spi.get_last_written_value(vmax_address), posts);
+}
+
+TEST(CommandMailboxBatchTest, MotionGoesOutAsOneBatch)
+{
+    MockBatchSpi spi;
+    TMC5160<MockBatchSpi> axis{spi, {}};
+    CommandMailbox mailbox{axis};
+
+    mailbox.post_move(100_steps, 60_rpm);
+    ASSERT_TRUE(mailbox.drain());
+
+    EXPECT_EQ(spi.get_batch_sizes(), (std::vector<std::size_t>{3U}));
+}
+
+} // namespace tmcxx::features::test
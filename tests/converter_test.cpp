@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include "tmcxx/base/concepts.hpp"
 #include "tmcxx/features/converter.hpp"
+#include "tmcxx/features/fixed_point_converter.hpp"
+
+#include <cstdlib>
 
 namespace tmcxx::features::test {
 
@@ -156,6 +160,27 @@ TEST_F(ConverterTest, DurationToTzerowaitIsMonotonic)
     EXPECT_LT(short_dur, long_dur);
 }
 
+TEST_F(ConverterTest, EncoderConstantScalesToMicrosteps)
+{
+    EXPECT_EQ(converter.encoder_to_enc_const(1024), 50U << 16U);
+    EXPECT_EQ(converter.encoder_to_enc_const(4000), (12U << 16U) | 52429U) << "0.8 * 65536, rounded";
+    EXPECT_EQ(converter.encoder_to_enc_const(4000, true), (12U << 16U) | 8000U);
+    EXPECT_EQ(converter.encoder_to_enc_const(0), 0U);
+}
+
+TEST_F(ConverterTest, EncoderConstantNegativeDirection)
+{
+    // -12.8 = -13 + 0.2
+    EXPECT_EQ(converter.encoder_to_enc_const(-4000, true), 0xFFF3'0000U | 2000U);
+    EXPECT_EQ(converter.encoder_to_enc_const(-4000), 0xFFF3'0000U | 13107U);
+    EXPECT_EQ(converter.encoder_to_enc_const(-1024), 0xFFCE'0000U);
+}
+
+TEST_F(ConverterTest, EncoderConstantSaturates)
+{
+    EXPECT_EQ(converter.encoder_to_enc_const(1), 0x7FFF'0000U) << "51200 microsteps per count exceed 16 bits";
+}
+
 TEST(ConverterConstexprTest, CanBeUsedAtCompileTime)
 {
     constexpr Converter conv{12.0_MHz, units::microsteps_t{200}, 75.0_mOhm};
@@ -217,4 +242,129 @@ INSTANTIATE_TEST_SUITE_P(SenseResistors,
         150.0f
         ));
 
+static_assert(core::concepts::UnitConverter<Converter>);
+static_assert(core::concepts::UnitConverter<FixedPointConverter>);
+
+struct MotorParams
+{
+    float clock_hz;
+    int32_t full_steps;
+    float rsense_ohm;
+};
+
+class FixedPointConverterTest : public ::testing::TestWithParam<MotorParams> {
+  protected:
+    [[nodiscard]] Converter reference() const
+    {
+        const auto& params{GetParam()};
+        return Converter{units::frequency_t{params.clock_hz},
+            units::microsteps_t{params.full_steps},
+            units::resistance_t{params.rsense_ohm}};
+    }
+
+    [[nodiscard]] FixedPointConverter fixed() const
+    {
+        const auto& params{GetParam()};
+        return FixedPointConverter{units::frequency_t{params.clock_hz},
+            units::microsteps_t{params.full_steps},
+            units::resistance_t{params.rsense_ohm}};
+    }
+
+    static void expect_within_lsb(uint32_t expected, uint32_t actual, float input)
+    {
+        EXPECT_LE(std::abs(static_cast<int64_t>(expected) - static_cast<int64_t>(actual)), 1) << "input " << input;
+    }
+};
+
+TEST_P(FixedPointConverterTest, RpmToVmaxMatchesReference)
+{
+    const auto ref{reference()};
+    const auto fix{fixed()};
+
+    for (float rpm{0.0f}; rpm <= 3000.0f; rpm += 7.3f)
+    {
+        expect_within_lsb(ref.rpm_to_vmax(units::rpm_t{rpm}), fix.rpm_to_vmax(units::rpm_t{rpm}), rpm);
+    }
+}
+
+TEST_P(FixedPointConverterTest, VmaxToRpmMatchesReference)
+{
+    const auto ref{reference()};
+    const auto fix{fixed()};
+
+    for (uint32_t vmax{0U}; vmax <= 8'000'000U; vmax += 49'999U)
+    {
+        const float expected{ref.vmax_to_rpm(vmax).raw()};
+        EXPECT_NEAR(fix.vmax_to_rpm(vmax).raw(), expected, 0.001f + (expected * 1e-5f)) << "vmax " << vmax;
+    }
+}
+
+TEST_P(FixedPointConverterTest, CurrentToCsMatchesReference)
+{
+    const auto ref{reference()};
+    const auto fix{fixed()};
+
+    for (float amps{0.0f}; amps <= 5.0f; amps += 0.01f)
+    {
+        expect_within_lsb(ref.current_to_cs(units::current_t{amps}), fix.current_to_cs(units::current_t{amps}), amps);
+    }
+}
+
+TEST_P(FixedPointConverterTest, AccelToRegisterMatchesReference)
+{
+    const auto ref{reference()};
+    const auto fix{fixed()};
+
+    for (float accel{0.0f}; accel <= 5'000'000.0f; accel += 4'321.0f)
+    {
+        const units::acceleration_t value{accel};
+        expect_within_lsb(ref.accel_to_register(value), fix.accel_to_register(value), accel);
+    }
+}
+
+TEST_P(FixedPointConverterTest, DurationToTzerowaitMatchesReference)
+{
+    const auto ref{reference()};
+    const auto fix{fixed()};
+
+    for (float seconds{0.0f}; seconds <= 3.0f; seconds += 0.0123f)
+    {
+        const units::time_duration_t value{seconds};
+        expect_within_lsb(ref.duration_to_tzerowait(value), fix.duration_to_tzerowait(value), seconds);
+    }
+}
+
+TEST_P(FixedPointConverterTest, NegativeAndHugeInputsSaturate)
+{
+    const auto fix{fixed()};
+
+    EXPECT_EQ(fix.rpm_to_vmax(units::rpm_t{-10.0f}), 0U);
+    EXPECT_EQ(fix.current_to_cs(units::current_t{100.0f}), 31U);
+    EXPECT_EQ(fix.accel_to_register(units::acceleration_t{1e12f}), 65'535U);
+    EXPECT_EQ(fix.duration_to_tzerowait(units::time_duration_t{1e6f}), 65'535U);
+}
+
+TEST_P(FixedPointConverterTest, Q16EntryPointMatchesFloatEntryPoint)
+{
+    const auto fix{fixed()};
+
+    constexpr uint32_t rpm_120_q16{120U << FixedPointConverter::rpm_frac_bits};
+    EXPECT_EQ(fix.rpm_q16_to_vmax(rpm_120_q16), fix.rpm_to_vmax(120.0_rpm));
+}
+
+INSTANTIATE_TEST_SUITE_P(MotorSetups,
+    FixedPointConverterTest,
+    ::testing::Values(MotorParams{12'000'000.0f, 200, 0.075f},
+        MotorParams{8'000'000.0f, 200, 0.05f},
+        MotorParams{16'000'000.0f, 400, 0.15f}));
+
+TEST(FixedPointConverterConstexprTest, ScalesFoldAtCompileTime)
+{
+    constexpr FixedPointConverter conv{12.0_MHz, units::microsteps_t{200}, 75.0_mOhm};
+    constexpr auto vmax{conv.rpm_to_vmax(60.0_rpm)};
+
+    static_assert(vmax > 70'000U && vmax < 75'000U);
+    EXPECT_EQ(vmax, Converter(12.0_MHz, units::microsteps_t{200}, 75.0_mOhm).rpm_to_vmax(60.0_rpm));
+}
+
 } // namespace tmcxx::features::test
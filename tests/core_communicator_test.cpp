@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <coroutine>
+#include <exception>
+
 #include "mocks/mock_spi.hpp"
+#include "mocks/tmc5160_emulator.hpp"
 
 #include "tmcxx/chips/tmc5160_registers.hpp"
 #include "tmcxx/features/core_communicator.hpp"
@@ -260,6 +264,42 @@ TEST_F(CoreCommunicatorTest, GetShadowForInvalidAddressReturnsError)
     EXPECT_EQ(shadow.error(), helpers::ErrorCode::REGISTER_ACCESS_FAILED);
 }
 
+TEST_F(CoreCommunicatorTest, GetShadowForUnshadowedRegisterReturnsError)
+{
+    const auto read_only{comm.get_shadow(DRV_STATUS::address)};
+    const auto unmapped{comm.get_shadow(static_cast<uint8_t>(RegAddress::MSCNT))};
+
+    EXPECT_EQ(read_only.error(), helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+    EXPECT_EQ(unmapped.error(), helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+}
+
+TEST(ShadowLayoutTest, SlotsAreDenseAndAscending)
+{
+    static_assert(ShadowLayout::slot<GCONF>() == 0U);
+    static_assert(ShadowLayout::find(DRV_STATUS::address) == ShadowLayout::no_slot);
+    static_assert(ShadowLayout::find(200U) == ShadowLayout::no_slot);
+
+    for (std::size_t slot{}; slot < ShadowLayout::slot_count; ++slot)
+    {
+        const uint8_t addr{ShadowLayout::address_of_slot[slot]};
+        EXPECT_EQ(ShadowLayout::find(addr), slot);
+
+        if (slot > 0U)
+        {
+            EXPECT_LT(ShadowLayout::address_of_slot[slot - 1U], addr);
+        }
+    }
+}
+
+TEST(ShadowLayoutTest, CacheHoldsOnlyWritableRegisters)
+{
+    EXPECT_LT(ShadowLayout::slot_count, std::size_t{helpers::constant::tmc_register_count} / 4U);
+    constexpr std::size_t full_map_bytes{helpers::constant::tmc_register_count * sizeof(uint32_t)};
+
+    EXPECT_LT(sizeof(CoreCommunicator<::tmcxx::test::MockSpi>), full_map_bytes)
+        << "The shadow cache alone used to take 512 bytes";
+}
+
 TEST_F(CoreCommunicatorTest, ShadowUpdatedAfterFieldWrite)
 {
     EXPECT_TRUE(comm.write_field<IHOLD_IRUN::i_run_t>(20U));
@@ -341,4 +381,896 @@ TEST_F(CoreCommunicatorTest, WriteToHighAddressRegister)
     EXPECT_EQ(tx.tx_data[0], expected);
 }
 
+TEST_F(CoreCommunicatorTest, ReadManyReturnsValuesInOrder)
+{
+    spi.set_register_value(XACTUAL::address, 0x11111111U);
+    spi.set_register_value(VACTUAL::address, 0x22222222U);
+    spi.set_register_value(DRV_STATUS::address, 0x33333333U);
+    spi.set_register_value(GSTAT::address, 0x44444444U);
+
+    const auto result{comm.read_many<XACTUAL, VACTUAL, DRV_STATUS, GSTAT>()};
+
+    ASSERT_TRUE(result.has_value());
+    const auto [x_actual, v_actual, drv_status, gstat]{*result};
+    EXPECT_EQ(x_actual, 0x11111111U);
+    EXPECT_EQ(v_actual, 0x22222222U);
+    EXPECT_EQ(drv_status, 0x33333333U);
+    EXPECT_EQ(gstat, 0x44444444U);
+}
+
+TEST_F(CoreCommunicatorTest, ReadManyCostsOneTransferMoreThanRegisterCount)
+{
+    [[maybe_unused]] const auto result{comm.read_many<XACTUAL, VACTUAL, DRV_STATUS, GSTAT>()};
+
+    const auto& transactions{spi.get_transactions()};
+    ASSERT_EQ(transactions.size(), 5U);
+
+    EXPECT_EQ(transactions[0].tx_data[0], XACTUAL::address);
+    EXPECT_EQ(transactions[1].tx_data[0], VACTUAL::address);
+    EXPECT_EQ(transactions[2].tx_data[0], DRV_STATUS::address);
+    EXPECT_EQ(transactions[3].tx_data[0], GSTAT::address);
+    EXPECT_EQ(transactions[4].tx_data[0], 0U);
+    EXPECT_EQ(spi.get_select_count(), 5U);
+}
+
+TEST_F(CoreCommunicatorTest, ReadManyServesCachedRegistersFromShadow)
+{
+    EXPECT_TRUE(comm.write<VMAX>(0xABCDU));
+    spi.clear_transactions();
+    spi.set_register_value(XACTUAL::address, 0x1234U);
+
+    const auto result{comm.read_many<VMAX, XACTUAL>()};
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ((*result)[0], 0xABCDU);
+    EXPECT_EQ((*result)[1], 0x1234U);
+    EXPECT_EQ(spi.get_transaction_count(), 2U);
+}
+
+TEST_F(CoreCommunicatorTest, ReadManyOfCachedRegistersSkipsSpi)
+{
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+    EXPECT_TRUE(comm.write<AMAX>(2U));
+    spi.clear_transactions();
+
+    const auto result{comm.read_many<VMAX, AMAX>()};
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ((*result)[0], 1U);
+    EXPECT_EQ((*result)[1], 2U);
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+}
+
+TEST_F(CoreCommunicatorTest, ReadManyReturnsErrorOnFailure)
+{
+    spi.set_next_transfer_failure(true);
+
+    const auto result{comm.read_many<XACTUAL, VACTUAL>()};
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+TEST_F(CoreCommunicatorTest, ReadBurstRejectsMismatchedSpans)
+{
+    constexpr std::array<uint8_t, 2> addresses{XACTUAL::address, VACTUAL::address};
+    std::array<uint32_t, 1> values{};
+
+    const auto result{comm.read_burst(addresses, values)};
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), helpers::ErrorCode::INVALID_PARAMETER);
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+}
+
+TEST_F(CoreCommunicatorTest, TolerantReadBurstReadsEveryRegister)
+{
+    spi.set_register_value(XACTUAL::address, 11U);
+    spi.set_register_value(VACTUAL::address, 22U);
+    spi.set_register_value(DRV_STATUS::address, 33U);
+
+    constexpr std::array<uint8_t, 3> addresses{XACTUAL::address, VACTUAL::address, DRV_STATUS::address};
+    std::array<uint32_t, 3> values{};
+    std::array<helpers::ErrorCode, 3> errors{};
+
+    ASSERT_TRUE(comm.read_burst(addresses, values, errors));
+
+    EXPECT_EQ(values, (std::array<uint32_t, 3>{11U, 22U, 33U}));
+    EXPECT_EQ(spi.get_transaction_count(), 4U);
+}
+
+TEST_F(CoreCommunicatorTest, TolerantReadBurstFailsOnlyTheLostReply)
+{
+    spi.set_register_value(XACTUAL::address, 11U);
+    spi.set_register_value(VACTUAL::address, 22U);
+    spi.set_register_value(DRV_STATUS::address, 33U);
+    spi.set_transfer_failure_after(1U);
+
+    constexpr std::array<uint8_t, 3> addresses{XACTUAL::address, VACTUAL::address, DRV_STATUS::address};
+    std::array<uint32_t, 3> values{};
+    std::array<helpers::ErrorCode, 3> errors{};
+
+    const auto result{comm.read_burst(addresses, values, errors)};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(errors[0], helpers::ErrorCode::SPI_TRANSFER_FAILED) << "Its reply was clocked by the failed frame";
+    EXPECT_EQ(errors[1], helpers::ErrorCode::SUCCESS);
+    EXPECT_EQ(errors[2], helpers::ErrorCode::SUCCESS);
+    EXPECT_EQ(values[1], 22U);
+    EXPECT_EQ(values[2], 33U);
+}
+
+TEST_F(CoreCommunicatorTest, TolerantReadBurstResendsAFailedFirstRequest)
+{
+    spi.set_register_value(XACTUAL::address, 11U);
+    spi.set_register_value(VACTUAL::address, 22U);
+    spi.set_next_transfer_failure(true);
+
+    constexpr std::array<uint8_t, 2> addresses{XACTUAL::address, VACTUAL::address};
+    std::array<uint32_t, 2> values{};
+    std::array<helpers::ErrorCode, 2> errors{};
+
+    EXPECT_FALSE(comm.read_burst(addresses, values, errors)) << "The failed transfer is still reported";
+    EXPECT_EQ(errors, (std::array{helpers::ErrorCode::SUCCESS, helpers::ErrorCode::SUCCESS}))
+        << "No reply was lost, so no register fails";
+    EXPECT_EQ(values, (std::array<uint32_t, 2>{11U, 22U}));
+    EXPECT_EQ(spi.get_transaction_count(), 3U);
+}
+
+TEST_F(CoreCommunicatorTest, TolerantReadBurstTerminatesOnDeadBus)
+{
+    std::size_t failures{};
+    spi.set_failure_hook([&] {
+        ++failures;
+        spi.set_next_transfer_failure(true);
+    });
+    spi.set_next_transfer_failure(true);
+
+    constexpr std::array<uint8_t, 2> addresses{XACTUAL::address, VACTUAL::address};
+    std::array<uint32_t, 2> values{};
+    std::array<helpers::ErrorCode, 2> errors{};
+
+    EXPECT_FALSE(comm.read_burst(addresses, values, errors));
+    EXPECT_EQ(errors, (std::array{helpers::ErrorCode::SPI_TRANSFER_FAILED, helpers::ErrorCode::SPI_TRANSFER_FAILED}));
+    EXPECT_EQ(failures, 4U) << "Each request is sent twice";
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+}
+
+TEST_F(CoreCommunicatorTest, TransactionStagesWritesUntilCommit)
+{
+    comm.begin_transaction();
+
+    EXPECT_TRUE(comm.in_transaction());
+    EXPECT_TRUE(comm.write<VMAX>(1000U));
+    EXPECT_TRUE(comm.write_field<IHOLD_IRUN::i_run_t>(16U));
+
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+    EXPECT_EQ(comm.pending_writes(), 2U);
+    EXPECT_EQ(comm.get_shadow(VMAX::address).value(), 1000U);
+
+    EXPECT_TRUE(comm.commit());
+
+    EXPECT_FALSE(comm.in_transaction());
+    EXPECT_EQ(comm.pending_writes(), 0U);
+    EXPECT_EQ(spi.get_transaction_count(), 2U);
+    EXPECT_EQ(spi.get_last_written_value(VMAX::address), 1000U);
+}
+
+TEST_F(CoreCommunicatorTest, CommitSendsEachDirtyRegisterOnce)
+{
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write_field<IHOLD_IRUN::i_hold_t>(5U));
+    EXPECT_TRUE(comm.write_field<IHOLD_IRUN::i_run_t>(15U));
+    EXPECT_TRUE(comm.write_field<IHOLD_IRUN::i_hold_delay_t>(10U));
+    EXPECT_TRUE(comm.write_field<CHOPCONF::toff_t>(3U));
+    EXPECT_TRUE(comm.write_field<CHOPCONF::tbl_t>(2U));
+    EXPECT_TRUE(comm.commit());
+
+    ASSERT_EQ(spi.find_writes_to(IHOLD_IRUN::address).size(), 1U);
+    ASSERT_EQ(spi.find_writes_to(CHOPCONF::address).size(), 1U);
+    EXPECT_EQ(spi.get_transaction_count(), 2U);
+
+    const auto written{spi.get_last_written_value(IHOLD_IRUN::address)};
+    ASSERT_TRUE(written.has_value());
+    EXPECT_EQ(IHOLD_IRUN::i_hold_t::extract(*written), 5U);
+    EXPECT_EQ(IHOLD_IRUN::i_run_t::extract(*written), 15U);
+    EXPECT_EQ(IHOLD_IRUN::i_hold_delay_t::extract(*written), 10U);
+}
+
+TEST_F(CoreCommunicatorTest, CommitFlushesInAddressOrder)
+{
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write<CHOPCONF>(1U));
+    EXPECT_TRUE(comm.write<GCONF>(2U));
+    EXPECT_TRUE(comm.write<VMAX>(3U));
+    EXPECT_TRUE(comm.commit());
+
+    const auto& transactions{spi.get_transactions()};
+    ASSERT_EQ(transactions.size(), 3U);
+    EXPECT_EQ(transactions[0].get_address(), GCONF::address);
+    EXPECT_EQ(transactions[1].get_address(), VMAX::address);
+    EXPECT_EQ(transactions[2].get_address(), CHOPCONF::address);
+}
+
+TEST_F(CoreCommunicatorTest, CommitFailureKeepsUnsentRegistersDirty)
+{
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+    EXPECT_TRUE(comm.write<AMAX>(2U));
+
+    spi.set_next_transfer_failure(true);
+    const auto failed{comm.commit()};
+
+    ASSERT_FALSE(failed.has_value());
+    EXPECT_EQ(failed.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(comm.pending_writes(), 2U);
+
+    EXPECT_TRUE(comm.commit());
+    EXPECT_EQ(comm.pending_writes(), 0U);
+    EXPECT_EQ(spi.get_last_written_value(AMAX::address), 2U);
+    EXPECT_EQ(spi.get_last_written_value(VMAX::address), 1U);
+}
+
+TEST_F(CoreCommunicatorTest, ImmediateWriteClearsPendingStage)
+{
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+    EXPECT_TRUE(comm.commit());
+    spi.clear_transactions();
+
+    EXPECT_TRUE(comm.commit());
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+}
+
+TEST_F(CoreCommunicatorTest, WriteRecordsSpiStatus)
+{
+    constexpr uint8_t position_reached_and_standstill{0x28U};
+    spi.set_status_byte(position_reached_and_standstill);
+
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+
+    const auto status{comm.last_status()};
+    EXPECT_EQ(status.raw, position_reached_and_standstill);
+    EXPECT_TRUE(status.position_reached());
+    EXPECT_TRUE(status.standstill());
+    EXPECT_FALSE(status.velocity_reached());
+    EXPECT_FALSE(status.driver_error());
+}
+
+TEST_F(CoreCommunicatorTest, ReadRecordsSpiStatus)
+{
+    spi.set_status_byte(0x02U);
+
+    EXPECT_TRUE(comm.read<GSTAT>());
+
+    EXPECT_TRUE(comm.last_status().driver_error());
+}
+
+TEST_F(CoreCommunicatorTest, FailedTransferKeepsLastStatus)
+{
+    spi.set_status_byte(0x01U);
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+
+    spi.set_status_byte(0x00U);
+    spi.set_next_transfer_failure(true);
+    EXPECT_FALSE(comm.write<VMAX>(2U));
+
+    EXPECT_TRUE(comm.last_status().reset_flag());
+}
+
+TEST_F(CoreCommunicatorTest, PollStatusUsesSingleDatagram)
+{
+    spi.set_status_byte(0x10U);
+
+    const auto status{comm.poll_status()};
+
+    ASSERT_TRUE(status);
+    EXPECT_TRUE(status->velocity_reached());
+    EXPECT_EQ(spi.get_transaction_count(), 1U);
+    EXPECT_FALSE(spi.get_last_transaction().is_write);
+}
+
+TEST_F(CoreCommunicatorTest, PollStatusReturnsErrorOnFailure)
+{
+    spi.set_next_transfer_failure(true);
+
+    const auto status{comm.poll_status()};
+
+    ASSERT_FALSE(status);
+    EXPECT_EQ(status.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+TEST_F(CoreCommunicatorTest, StatusHookFiresOnlyOnChange)
+{
+    struct HookRecord
+    {
+        int calls{};
+        SpiStatus previous{};
+        SpiStatus current{};
+    } record{};
+
+    comm.set_status_hook(
+        [](void* context, SpiStatus previous, SpiStatus current)
+        {
+            auto* rec{static_cast<HookRecord*>(context)};
+            ++rec->calls;
+            rec->previous = previous;
+            rec->current = current;
+        },
+        &record);
+
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+    EXPECT_EQ(record.calls, 0);
+
+    spi.set_status_byte(0x20U);
+    EXPECT_TRUE(comm.write<VMAX>(2U));
+    EXPECT_TRUE(comm.write<VMAX>(3U));
+
+    EXPECT_EQ(record.calls, 1);
+    EXPECT_EQ(record.previous.raw, 0x00U);
+    EXPECT_TRUE(record.current.position_reached());
+
+    comm.set_status_hook(nullptr);
+    spi.set_status_byte(0x00U);
+    EXPECT_TRUE(comm.write<VMAX>(4U));
+    EXPECT_EQ(record.calls, 1);
+}
+
+TEST_F(CoreCommunicatorTest, ShadowValidTracksWriteOutcome)
+{
+    EXPECT_FALSE(comm.is_shadow_valid(VMAX::address));
+
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+    EXPECT_TRUE(comm.is_shadow_valid(VMAX::address));
+
+    spi.set_next_transfer_failure(true);
+    EXPECT_FALSE(comm.write<VMAX>(2U));
+    EXPECT_FALSE(comm.is_shadow_valid(VMAX::address));
+}
+
+TEST_F(CoreCommunicatorTest, StagedWriteIsValidOnlyAfterCommit)
+{
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write<AMAX>(1U));
+    EXPECT_FALSE(comm.is_shadow_valid(AMAX::address));
+
+    EXPECT_TRUE(comm.commit());
+    EXPECT_TRUE(comm.is_shadow_valid(AMAX::address));
+}
+
+TEST_F(CoreCommunicatorTest, InvalidateShadowKeepsValues)
+{
+    EXPECT_TRUE(comm.write<VMAX>(1234U));
+
+    comm.invalidate_shadow();
+
+    EXPECT_FALSE(comm.is_shadow_valid(VMAX::address));
+    EXPECT_EQ(comm.get_shadow(VMAX::address).value(), 1234U);
+    EXPECT_EQ(comm.configured_registers(), 1U);
+}
+
+TEST_F(CoreCommunicatorTest, RestoreRewritesOnlyConfiguredRegisters)
+{
+    EXPECT_TRUE(comm.write<VMAX>(5000U));
+    EXPECT_TRUE(comm.write<AMAX>(300U));
+    EXPECT_TRUE(comm.write<XTARGET>(1000U));
+    EXPECT_TRUE(comm.write<XACTUAL>(10U));
+    EXPECT_TRUE(comm.write_field<CHOPCONF::toff_t>(3U));
+    EXPECT_EQ(comm.configured_registers(), 3U);
+    spi.clear_transactions();
+
+    comm.invalidate_shadow();
+    ASSERT_TRUE(comm.restore_from_shadow());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 3U);
+    EXPECT_EQ(txs[0].get_address(), AMAX::address);
+    EXPECT_EQ(txs[0].get_write_value(), 300U);
+    EXPECT_EQ(txs[1].get_address(), VMAX::address);
+    EXPECT_EQ(txs[1].get_write_value(), 5000U);
+    EXPECT_EQ(txs[2].get_address(), CHOPCONF::address);
+    EXPECT_TRUE(comm.is_shadow_valid(VMAX::address));
+    EXPECT_FALSE(comm.is_shadow_valid(XTARGET::address));
+}
+
+TEST_F(CoreCommunicatorTest, FailedRestoreCanBeRetried)
+{
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+    EXPECT_TRUE(comm.write<AMAX>(2U));
+    spi.clear_transactions();
+
+    spi.set_next_transfer_failure(true);
+    EXPECT_FALSE(comm.restore_from_shadow());
+    EXPECT_EQ(comm.pending_writes(), 2U);
+
+    ASSERT_TRUE(comm.commit());
+    EXPECT_EQ(spi.get_transaction_count(), 2U);
+    EXPECT_EQ(comm.pending_writes(), 0U);
+}
+
+class CoreCommunicatorAsyncTest : public ::testing::Test {
+  protected:
+    struct Completion
+    {
+        int calls{};
+        helpers::result_t<uint32_t> result{};
+    };
+
+    static void record(void* context, helpers::result_t<uint32_t> result)
+    {
+        auto* completion{static_cast<Completion*>(context)};
+        completion->calls++;
+        completion->result = result;
+    }
+
+    /**
+     * @brief Minimal eager coroutine used to drive the awaitables.
+     */
+    struct Task
+    {
+        struct promise_type
+        {
+            Task get_return_object() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_void() noexcept
+            {
+            }
+
+            void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+    };
+
+    ::tmcxx::test::MockAsyncSpi spi;
+    CoreCommunicator<::tmcxx::test::MockAsyncSpi> comm{spi};
+};
+
+TEST_F(CoreCommunicatorAsyncTest, SubmitWriteCompletesFromCallback)
+{
+    Completion completion{};
+
+    ASSERT_TRUE(comm.submit_write<XTARGET>(1000U, &record, &completion));
+
+    EXPECT_TRUE(comm.async_busy());
+    EXPECT_TRUE(spi.is_selected());
+    EXPECT_EQ(completion.calls, 0);
+
+    spi.complete_pending();
+
+    EXPECT_FALSE(comm.async_busy());
+    EXPECT_FALSE(spi.is_selected());
+    EXPECT_EQ(completion.calls, 1);
+    EXPECT_TRUE(completion.result.has_value());
+    EXPECT_EQ(spi.get_last_written_value(XTARGET::address), 1000U);
+    EXPECT_EQ(comm.get_shadow(XTARGET::address).value(), 1000U);
+}
+
+TEST_F(CoreCommunicatorAsyncTest, SubmitWriteCompletesWithZero)
+{
+    Completion completion{};
+    spi.set_register_value(GCONF::address, 0xBEEFU);
+    ASSERT_TRUE(comm.read<XACTUAL>()) << "Leaves GCONF as the pipelined reply of the next datagram";
+
+    ASSERT_TRUE(comm.submit_write<XTARGET>(1000U, &record, &completion));
+    spi.complete_pending();
+
+    ASSERT_EQ(completion.calls, 1);
+    ASSERT_TRUE(completion.result.has_value());
+    EXPECT_EQ(*completion.result, 0U);
+}
+
+TEST_F(CoreCommunicatorAsyncTest, SubmitReadChainsReplyDatagram)
+{
+    Completion completion{};
+    spi.set_register_value(XACTUAL::address, 0xCAFEU);
+
+    ASSERT_TRUE(comm.submit_read<XACTUAL>(&record, &completion));
+
+    spi.complete_pending();
+    EXPECT_EQ(completion.calls, 0);
+    EXPECT_TRUE(spi.has_pending());
+
+    spi.complete_pending();
+    ASSERT_EQ(completion.calls, 1);
+    ASSERT_TRUE(completion.result.has_value());
+    EXPECT_EQ(*completion.result, 0xCAFEU);
+    EXPECT_EQ(spi.get_submit_count(), 2U);
+}
+
+TEST_F(CoreCommunicatorAsyncTest, AsyncCompletionRecordsSpiStatus)
+{
+    Completion completion{};
+    spi.set_status_byte(0x08U);
+
+    ASSERT_TRUE(comm.submit_write<XTARGET>(1U, &record, &completion));
+    EXPECT_FALSE(comm.last_status().standstill());
+
+    spi.complete_pending();
+
+    EXPECT_TRUE(comm.last_status().standstill());
+}
+
+TEST_F(CoreCommunicatorAsyncTest, SubmitReadOfCachedRegisterCompletesImmediately)
+{
+    Completion completion{};
+    EXPECT_TRUE(comm.write<VMAX>(42U));
+    spi.clear_transactions();
+
+    ASSERT_TRUE(comm.submit_read<VMAX>(&record, &completion));
+
+    EXPECT_EQ(completion.calls, 1);
+    EXPECT_EQ(completion.result.value(), 42U);
+    EXPECT_FALSE(spi.has_pending());
+}
+
+TEST_F(CoreCommunicatorAsyncTest, SecondSubmitWhileBusyIsRejected)
+{
+    Completion completion{};
+
+    ASSERT_TRUE(comm.submit_write<VMAX>(1U, &record, &completion));
+
+    const auto second{comm.submit_write<AMAX>(2U, &record, &completion)};
+    ASSERT_FALSE(second.has_value());
+    EXPECT_EQ(second.error(), helpers::ErrorCode::CHIP_BUSY);
+
+    const auto blocking{comm.write<AMAX>(2U)};
+    ASSERT_FALSE(blocking.has_value());
+    EXPECT_EQ(blocking.error(), helpers::ErrorCode::CHIP_BUSY);
+
+    spi.complete_all();
+    EXPECT_FALSE(comm.async_busy());
+}
+
+TEST_F(CoreCommunicatorAsyncTest, RefusedSubmitReleasesChipSelect)
+{
+    Completion completion{};
+    spi.set_next_submit_refused(true);
+
+    const auto res{comm.submit_write<VMAX>(1U, &record, &completion)};
+
+    ASSERT_FALSE(res.has_value());
+    EXPECT_EQ(res.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_FALSE(spi.is_selected());
+    EXPECT_FALSE(comm.async_busy());
+}
+
+TEST_F(CoreCommunicatorAsyncTest, FailedTransferReportsError)
+{
+    Completion completion{};
+
+    ASSERT_TRUE(comm.submit_read<XACTUAL>(&record, &completion));
+    spi.complete_pending(false);
+
+    ASSERT_EQ(completion.calls, 1);
+    ASSERT_FALSE(completion.result.has_value());
+    EXPECT_EQ(completion.result.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+TEST_F(CoreCommunicatorAsyncTest, CoroutineAwaitsReadAndWrite)
+{
+    spi.set_register_value(XACTUAL::address, 777U);
+
+    helpers::result_t<void> write_result{tl::unexpected(helpers::ErrorCode::UNKNOWN_ERROR)};
+    helpers::result_t<uint32_t> read_result{tl::unexpected(helpers::ErrorCode::UNKNOWN_ERROR)};
+    bool finished{false};
+
+    auto control_loop{[&]() -> Task {
+        write_result = co_await comm.async_write<XTARGET>(500U);
+        read_result = co_await comm.async_read<XACTUAL>();
+        finished = true;
+    }};
+
+    control_loop();
+
+    EXPECT_FALSE(finished);
+    spi.complete_all();
+
+    EXPECT_TRUE(finished);
+    EXPECT_TRUE(write_result.has_value());
+    ASSERT_TRUE(read_result.has_value());
+    EXPECT_EQ(*read_result, 777U);
+    EXPECT_EQ(spi.get_last_written_value(XTARGET::address), 500U);
+}
+
+TEST_F(CoreCommunicatorAsyncTest, CoroutineDoesNotSuspendOnCachedRead)
+{
+    EXPECT_TRUE(comm.write<VMAX>(9U));
+
+    helpers::result_t<uint32_t> read_result{};
+    bool finished{false};
+
+    auto task{[&]() -> Task {
+        read_result = co_await comm.async_read<VMAX>();
+        finished = true;
+    }};
+
+    task();
+
+    EXPECT_TRUE(finished);
+    EXPECT_EQ(read_result.value(), 9U);
+}
+
+class CoreCommunicatorBatchTest : public ::testing::Test {
+  protected:
+    ::tmcxx::test::MockBatchSpi spi;
+    CoreCommunicator<::tmcxx::test::MockBatchSpi> comm{spi};
+};
+
+TEST_F(CoreCommunicatorBatchTest, ReadManySendsOneBatch)
+{
+    spi.set_register_value(XACTUAL::address, 0x11111111U);
+    spi.set_register_value(VACTUAL::address, 0x22222222U);
+    spi.set_register_value(DRV_STATUS::address, 0x33333333U);
+
+    const auto result{comm.read_many<XACTUAL, VACTUAL, DRV_STATUS>()};
+
+    ASSERT_TRUE(result.has_value());
+    const auto [x_actual, v_actual, drv_status]{*result};
+    EXPECT_EQ(x_actual, 0x11111111U);
+    EXPECT_EQ(v_actual, 0x22222222U);
+    EXPECT_EQ(drv_status, 0x33333333U);
+
+    ASSERT_EQ(spi.get_batch_sizes().size(), 1U);
+    EXPECT_EQ(spi.get_batch_sizes()[0], 4U);
+    EXPECT_EQ(spi.get_transaction_count(), 4U);
+}
+
+TEST_F(CoreCommunicatorBatchTest, LongBurstKeepsPipelineAcrossBatches)
+{
+    std::array<uint8_t, 20> addresses{};
+    std::array<uint32_t, 20> values{};
+    for (uint8_t idx{}; idx < addresses.size(); ++idx)
+    {
+        addresses[idx] = static_cast<uint8_t>(0x20U + idx);
+        spi.set_register_value(addresses[idx], 1000U + idx);
+    }
+
+    ASSERT_TRUE(comm.read_burst(addresses, values));
+
+    for (std::size_t idx{}; idx < values.size(); ++idx)
+    {
+        EXPECT_EQ(values[idx], 1000U + idx) << "register " << idx;
+    }
+    EXPECT_EQ(spi.get_batch_sizes(), (std::vector<std::size_t>{16U, 5U}));
+}
+
+TEST_F(CoreCommunicatorBatchTest, CommitSendsDirtyRegistersInOneBatch)
+{
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write<CHOPCONF>(1U));
+    EXPECT_TRUE(comm.write<GCONF>(2U));
+    EXPECT_TRUE(comm.write<VMAX>(3U));
+    EXPECT_TRUE(comm.commit());
+
+    ASSERT_EQ(spi.get_batch_sizes().size(), 1U);
+    EXPECT_EQ(spi.get_batch_sizes()[0], 3U);
+
+    const auto& transactions{spi.get_transactions()};
+    ASSERT_EQ(transactions.size(), 3U);
+    EXPECT_EQ(transactions[0].get_address(), GCONF::address);
+    EXPECT_EQ(transactions[1].get_address(), VMAX::address);
+    EXPECT_EQ(transactions[2].get_address(), CHOPCONF::address);
+    EXPECT_TRUE(comm.is_shadow_valid(VMAX::address));
+}
+
+TEST_F(CoreCommunicatorBatchTest, FailedBatchKeepsRegistersDirty)
+{
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write<VMAX>(1U));
+    EXPECT_TRUE(comm.write<AMAX>(2U));
+
+    spi.set_next_batch_failure(true);
+    const auto failed{comm.commit()};
+
+    ASSERT_FALSE(failed.has_value());
+    EXPECT_EQ(failed.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(comm.pending_writes(), 2U);
+    EXPECT_FALSE(comm.is_shadow_valid(VMAX::address));
+
+    EXPECT_TRUE(comm.commit());
+    EXPECT_EQ(comm.pending_writes(), 0U);
+    EXPECT_EQ(spi.get_last_written_value(AMAX::address), 2U);
+}
+
+TEST_F(CoreCommunicatorBatchTest, BatchRecordsSpiStatus)
+{
+    constexpr uint8_t standstill{0x08U};
+    spi.set_status_byte(standstill);
+
+    [[maybe_unused]] const auto result{comm.read_many<XACTUAL, VACTUAL>()};
+
+    EXPECT_TRUE(comm.last_status().standstill());
+}
+
+/**
+ * @brief Emulator with the transfer_frames() batch extension: one CS assertion per datagram, like MockBatchSpi.
+ */
+class BatchEmulator : public ::tmcxx::test::TMC5160Emulator {
+  public:
+    bool transfer_frames(
+        std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, std::size_t frame_size, uint32_t timeout_ms)
+    {
+        ++m_batch_count;
+
+        bool success{true};
+        for (std::size_t offset{}; offset < tx_data.size() && success; offset += frame_size)
+        {
+            select();
+            success = transfer(tx_data.subspan(offset, frame_size), rx_data.subspan(offset, frame_size), timeout_ms);
+            deselect();
+        }
+        return success;
+    }
+
+    [[nodiscard]] std::size_t batch_count() const noexcept
+    {
+        return m_batch_count;
+    }
+
+  private:
+    std::size_t m_batch_count{};
+};
+
+class CoreCommunicatorVerificationTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        chip.set_uart_mode(true);
+        ASSERT_TRUE(comm.set_write_verification(true));
+        probe_datagrams = chip.datagrams();
+    }
+
+    void stage_ramp()
+    {
+        comm.begin_transaction();
+        EXPECT_TRUE(comm.write<AMAX>(1000U));
+        EXPECT_TRUE(comm.write<VMAX>(50000U));
+        EXPECT_TRUE(comm.write<DMAX>(1200U));
+    }
+
+    ::tmcxx::test::TMC5160Emulator chip;
+    CoreCommunicator<::tmcxx::test::TMC5160Emulator> comm{chip};
+    std::size_t probe_datagrams{};
+};
+
+TEST(CoreCommunicatorVerificationProbeTest, SpiLinkRefusesVerification)
+{
+    ::tmcxx::test::TMC5160Emulator chip;
+    CoreCommunicator<::tmcxx::test::TMC5160Emulator> comm{chip};
+
+    const auto refused{comm.set_write_verification(true)};
+
+    ASSERT_FALSE(refused.has_value());
+    EXPECT_EQ(refused.error(), helpers::ErrorCode::NOT_IMPLEMENTED);
+    EXPECT_FALSE(comm.write_verification_enabled());
+    EXPECT_EQ(chip.datagrams(), 2U + 1U + 2U) << "IFCNT read, GSTAT write, IFCNT read";
+
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write<VMAX>(50000U));
+    ASSERT_TRUE(comm.commit()) << "Commits stay unverified instead of failing";
+    EXPECT_EQ(chip.peek(RegAddress::VMAX), 50000U);
+}
+
+TEST_F(CoreCommunicatorVerificationTest, ProbeCostsOneWrite)
+{
+    EXPECT_TRUE(comm.write_verification_enabled());
+    EXPECT_EQ(probe_datagrams, 2U + 1U + 2U);
+    EXPECT_EQ(chip.peek(RegAddress::IFCNT), 1U);
+}
+
+TEST_F(CoreCommunicatorVerificationTest, CommitCostsOneCounterReadPerBatch)
+{
+    stage_ramp();
+    ASSERT_TRUE(comm.commit());
+
+    EXPECT_EQ(chip.datagrams() - probe_datagrams, 3U + 2U)
+        << "3 writes + lagged IFCNT read; the probe set the baseline";
+    EXPECT_EQ(comm.resent_batches(), 0U);
+    EXPECT_EQ(chip.peek(RegAddress::VMAX), 50000U);
+
+    const auto before{chip.datagrams()};
+    EXPECT_TRUE(comm.write<VMAX>(60000U));
+    EXPECT_TRUE(comm.write<AMAX>(900U));
+    comm.begin_transaction();
+    EXPECT_TRUE(comm.write<DMAX>(1100U));
+    ASSERT_TRUE(comm.commit());
+
+    EXPECT_EQ(chip.datagrams() - before, 2U + 2U + 1U + 2U)
+        << "Immediate writes bypass verification and force a fresh baseline";
+}
+
+TEST_F(CoreCommunicatorVerificationTest, LostDatagramResendsBatch)
+{
+    stage_ramp();
+    chip.drop_next_writes(1U);
+
+    ASSERT_TRUE(comm.commit());
+
+    EXPECT_EQ(comm.resent_batches(), 1U);
+    EXPECT_EQ(comm.pending_writes(), 0U);
+    EXPECT_EQ(chip.peek(RegAddress::AMAX), 1000U);
+    EXPECT_EQ(chip.peek(RegAddress::VMAX), 50000U);
+    EXPECT_EQ(chip.peek(RegAddress::DMAX), 1200U);
+    EXPECT_EQ(chip.peek(RegAddress::IFCNT), 1U + 2U + 3U) << "Probe write + accepted writes";
+}
+
+TEST_F(CoreCommunicatorVerificationTest, PersistentLossKeepsRegistersDirty)
+{
+    ASSERT_TRUE(comm.set_write_verification(true, 1U));
+    stage_ramp();
+    chip.drop_next_writes(6U);
+
+    const auto failed{comm.commit()};
+
+    ASSERT_FALSE(failed.has_value());
+    EXPECT_EQ(failed.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(comm.pending_writes(), 3U);
+    EXPECT_FALSE(comm.is_shadow_valid(VMAX::address));
+    EXPECT_EQ(comm.resent_batches(), 1U);
+
+    ASSERT_TRUE(comm.commit());
+    EXPECT_EQ(comm.pending_writes(), 0U);
+    EXPECT_EQ(chip.peek(RegAddress::VMAX), 50000U);
+}
+
+TEST_F(CoreCommunicatorVerificationTest, DisabledVerificationAddsNoTraffic)
+{
+    ASSERT_TRUE(comm.set_write_verification(false));
+    EXPECT_FALSE(comm.write_verification_enabled());
+    stage_ramp();
+    chip.drop_next_writes(1U);
+
+    ASSERT_TRUE(comm.commit());
+
+    EXPECT_EQ(chip.datagrams() - probe_datagrams, 3U);
+    EXPECT_EQ(chip.peek(RegAddress::AMAX), 0U) << "Lost datagram goes unnoticed";
+}
+
+TEST(CoreCommunicatorBatchVerificationTest, ResendsOnlyTheShortBatch)
+{
+    BatchEmulator chip;
+    CoreCommunicator<BatchEmulator> comm{chip};
+    chip.set_uart_mode(true);
+    ASSERT_TRUE(comm.set_write_verification(true));
+    const std::size_t probe_batches{chip.batch_count()};
+
+    comm.begin_transaction();
+    std::apply(
+        [&comm]<typename... Regs>(Regs...) {
+            (([&comm] {
+                if constexpr (core::concepts::WritableRegister<Regs>)
+                {
+                    EXPECT_TRUE(comm.template write<Regs>(1U));
+                }
+            }()),
+                ...);
+        },
+        register_tuple.fields);
+    ASSERT_GT(comm.pending_writes(), 16U) << "Commit needs two batches";
+    chip.drop_next_writes(1U);
+
+    ASSERT_TRUE(comm.commit());
+
+    EXPECT_EQ(comm.resent_batches(), 1U);
+    EXPECT_EQ(comm.pending_writes(), 0U);
+    EXPECT_EQ(chip.peek(RegAddress::GCONF), 1U);
+    EXPECT_EQ(chip.batch_count() - probe_batches, 4U + 2U) << "First batch twice, second batch once";
+}
+
 } // namespace tmcxx::features::test
@@ -0,0 +1,211 @@
+#include <gtest/gtest.h>
+
+#include "mocks/mock_spi.hpp"
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/detail/tmc5160_bus.hpp"
+#include "tmcxx/features/daisy_chain.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace chip::tmc5160;
+using namespace units::literals;
+
+using chain_t = DaisyChain<::tmcxx::test::MockSpi, 3>;
+using chain_bus_t = detail::TMC5160Bus<chain_t::Channel>;
+
+static_assert(core::concepts::SpiDevice<chain_t::Channel>, "Channel must satisfy SpiDevice concept");
+
+class DaisyChainTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        spi.reset();
+    }
+
+    [[nodiscard]] static uint32_t slot_value(const ::tmcxx::test::SpiTransaction& frame, std::size_t position)
+    {
+        const std::size_t offset{(2U - position) * 5U};
+        return (static_cast<uint32_t>(frame.tx_data[offset + 1U]) << 24U) |
+               (static_cast<uint32_t>(frame.tx_data[offset + 2U]) << 16U) |
+               (static_cast<uint32_t>(frame.tx_data[offset + 3U]) << 8U) |
+               static_cast<uint32_t>(frame.tx_data[offset + 4U]);
+    }
+
+    [[nodiscard]] static uint8_t slot_address(const ::tmcxx::test::SpiTransaction& frame, std::size_t position)
+    {
+        return frame.tx_data[(2U - position) * 5U];
+    }
+
+    ::tmcxx::test::MockSpi spi;
+    chain_t chain{spi};
+    chain_bus_t bus0{chain.channel(0)};
+    chain_bus_t bus1{chain.channel(1)};
+    chain_bus_t bus2{chain.channel(2)};
+};
+
+TEST_F(DaisyChainTest, ImmediateWriteSendsOneFramePaddedWithNops)
+{
+    EXPECT_TRUE(bus1.write<VMAX>(0x1234U));
+
+    ASSERT_EQ(spi.get_transaction_count(), 1U);
+    const auto& frame{spi.get_last_transaction()};
+
+    ASSERT_EQ(frame.tx_data.size(), chain_t::frame_size);
+    EXPECT_EQ(slot_address(frame, 1), 0x80U | VMAX::address);
+    EXPECT_EQ(slot_value(frame, 1), 0x1234U);
+    EXPECT_EQ(slot_address(frame, 0), 0x00U);
+    EXPECT_EQ(slot_address(frame, 2), 0x00U);
+    EXPECT_EQ(spi.get_select_count(), 1U);
+    EXPECT_FALSE(spi.is_selected());
+}
+
+TEST_F(DaisyChainTest, DeferredWritesShareOneFrame)
+{
+    chain.begin_frame();
+    EXPECT_TRUE(bus0.write<XTARGET>(100U));
+    EXPECT_TRUE(bus1.write<XTARGET>(200U));
+    EXPECT_TRUE(bus2.write<XTARGET>(300U));
+
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+    EXPECT_TRUE(chain.end_frame());
+
+    ASSERT_EQ(spi.get_transaction_count(), 1U);
+    const auto& frame{spi.get_last_transaction()};
+    EXPECT_EQ(slot_value(frame, 0), 100U);
+    EXPECT_EQ(slot_value(frame, 1), 200U);
+    EXPECT_EQ(slot_value(frame, 2), 300U);
+    EXPECT_EQ(chain.frame_count(), 1U);
+}
+
+TEST_F(DaisyChainTest, QueuedDatagramsAreSentColumnByColumn)
+{
+    chain.begin_frame();
+    EXPECT_TRUE(bus0.write<VMAX>(1U));
+    EXPECT_TRUE(bus0.write<AMAX>(2U));
+    EXPECT_TRUE(bus1.write<VMAX>(3U));
+    EXPECT_TRUE(chain.end_frame());
+
+    const auto& frames{spi.get_transactions()};
+    ASSERT_EQ(frames.size(), 2U);
+    EXPECT_EQ(slot_address(frames[0], 0), 0x80U | VMAX::address);
+    EXPECT_EQ(slot_address(frames[0], 1), 0x80U | VMAX::address);
+    EXPECT_EQ(slot_address(frames[1], 0), 0x80U | AMAX::address);
+    EXPECT_EQ(slot_address(frames[1], 1), 0x00U);
+}
+
+TEST_F(DaisyChainTest, FullQueueIsShiftedOutEarly)
+{
+    ::tmcxx::test::MockSpi shallow_spi;
+    DaisyChain<::tmcxx::test::MockSpi, 2, 1> shallow{shallow_spi};
+    detail::TMC5160Bus<DaisyChain<::tmcxx::test::MockSpi, 2, 1>::Channel> shallow_bus{shallow.channel(0)};
+
+    shallow.begin_frame();
+    EXPECT_TRUE(shallow_bus.write<VMAX>(1U));
+    EXPECT_EQ(shallow_spi.get_transaction_count(), 0U);
+
+    EXPECT_TRUE(shallow_bus.write<AMAX>(2U));
+    EXPECT_EQ(shallow_spi.get_transaction_count(), 1U);
+
+    EXPECT_TRUE(shallow.end_frame());
+    EXPECT_EQ(shallow_spi.get_transaction_count(), 2U);
+}
+
+TEST_F(DaisyChainTest, DeferredWritesUpdatePerChipShadow)
+{
+    chain.begin_frame();
+    EXPECT_TRUE(bus0.write_field<IHOLD_IRUN::i_run_t>(10U));
+    EXPECT_TRUE(bus2.write_field<IHOLD_IRUN::i_run_t>(20U));
+    EXPECT_TRUE(chain.end_frame());
+
+    EXPECT_EQ(IHOLD_IRUN::i_run_t::extract(bus0.core().get_shadow(IHOLD_IRUN::address).value()), 10U);
+    EXPECT_EQ(bus1.core().get_shadow(IHOLD_IRUN::address).value(), 0U);
+    EXPECT_EQ(IHOLD_IRUN::i_run_t::extract(bus2.core().get_shadow(IHOLD_IRUN::address).value()), 20U);
+}
+
+TEST_F(DaisyChainTest, ReadIsSentImmediatelyInsideFrame)
+{
+    spi.set_register_value(XACTUAL::address, 0xABCDU);
+
+    chain.begin_frame();
+    EXPECT_TRUE(bus0.write<VMAX>(1U));
+
+    // Chip 2 sits in slot 0, which is where the mock answers.
+    const auto position{bus2.read<XACTUAL>()};
+    EXPECT_TRUE(chain.end_frame());
+
+    ASSERT_TRUE(position.has_value());
+    EXPECT_EQ(*position, 0xABCDU);
+    EXPECT_EQ(spi.get_transaction_count(), 3U);
+    EXPECT_EQ(slot_address(spi.get_transactions()[0], 0), 0x80U | VMAX::address);
+}
+
+TEST_F(DaisyChainTest, FrameFailureIsReported)
+{
+    chain.begin_frame();
+    EXPECT_TRUE(bus0.write<VMAX>(1U));
+
+    spi.set_next_transfer_failure(true);
+    const auto res{chain.end_frame()};
+
+    ASSERT_FALSE(res.has_value());
+    EXPECT_EQ(res.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+TEST_F(DaisyChainTest, FailedFrameMarksChannelsThatLostWrites)
+{
+    chain.begin_frame();
+    EXPECT_TRUE(bus0.write<VMAX>(1U));
+    EXPECT_TRUE(bus0.write<AMAX>(2U));
+    EXPECT_TRUE(bus1.write<VMAX>(3U)) << "Deferred: acknowledged before it is sent";
+
+    spi.set_transfer_failure_after(1U);
+    ASSERT_FALSE(chain.end_frame());
+
+    EXPECT_TRUE(chain.lost_writes(0)) << "AMAX column was never sent";
+    EXPECT_FALSE(chain.lost_writes(1)) << "VMAX went out in the first frame";
+    EXPECT_FALSE(chain.lost_writes(2));
+
+    EXPECT_FALSE(bus0.write<VMAX>(4U)) << "The loss is reported on the channel's next transfer";
+    EXPECT_FALSE(chain.lost_writes(0));
+    EXPECT_TRUE(bus0.write<VMAX>(4U));
+    EXPECT_TRUE(bus2.write<VMAX>(5U));
+}
+
+TEST_F(DaisyChainTest, DiscardLostWritesClearsTheReports)
+{
+    chain.begin_frame();
+    EXPECT_TRUE(bus2.write<VMAX>(1U));
+
+    spi.set_next_transfer_failure(true);
+    ASSERT_FALSE(chain.end_frame());
+    ASSERT_TRUE(chain.lost_writes(2));
+
+    chain.discard_lost_writes();
+
+    EXPECT_FALSE(chain.lost_writes(2));
+    EXPECT_TRUE(bus2.write<VMAX>(2U));
+}
+
+TEST_F(DaisyChainTest, MoveToOnEveryAxisTakesOneFramePerRegister)
+{
+    TMC5160<chain_t::Channel>::Settings settings{};
+    TMC5160<chain_t::Channel> x_axis{chain.channel(0), settings};
+    TMC5160<chain_t::Channel> y_axis{chain.channel(1), settings};
+    TMC5160<chain_t::Channel> z_axis{chain.channel(2), settings};
+
+    chain.begin_frame();
+    EXPECT_TRUE(x_axis.move_to(1000_steps, 100_rpm));
+    EXPECT_TRUE(y_axis.move_to(2000_steps, 100_rpm));
+    EXPECT_TRUE(z_axis.move_to(3000_steps, 100_rpm));
+    EXPECT_TRUE(chain.end_frame());
+
+    ASSERT_EQ(spi.get_transaction_count(), 3U);
+    const auto& xtarget_frame{spi.get_last_transaction()};
+    EXPECT_EQ(slot_value(xtarget_frame, 0), 1000U);
+    EXPECT_EQ(slot_value(xtarget_frame, 1), 2000U);
+    EXPECT_EQ(slot_value(xtarget_frame, 2), 3000U);
+}
+
+} // namespace tmcxx::features::test
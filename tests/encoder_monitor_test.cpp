@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+
+#include "mocks/recording_spi.hpp"
+#include "mocks/tmc5160_emulator.hpp"
+#include "tmcxx/features/encoder_monitor.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace std::chrono_literals;
+using namespace units::literals;
+using ::tmcxx::test::RecordingBatchSpi;
+using ::tmcxx::test::TMC5160Emulator;
+
+namespace regs = chip::tmc5160;
+using regs::RegAddress;
+
+constexpr regs::Settings motor_settings{
+    .run_current = 1.0_A,
+    .hold_current = 0.5_A,
+    .v_stop = 1_rpm,
+    .v_max = 300_rpm,
+    .a_max = 512000_pps2,
+    .d_max = 512000_pps2,
+};
+
+static_assert(encoder_deviation(1000U, 1000U) == 0U);
+static_assert(encoder_deviation(1000U, 700U) == 300U, "Lagging rotor");
+static_assert(encoder_deviation(0x7FFF'FFF0U, 0x8000'0010U) == 0x20U, "Difference across the int32 wrap");
+static_assert(encoder_deviation(0U, 0x8000'0000U) == 0x8000'0000U, "INT32_MIN stays defined");
+
+class EncoderMonitorTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        ASSERT_TRUE(axis.apply_settings());
+        ASSERT_TRUE(axis.configure_encoder(4000));
+        ASSERT_TRUE(axis.set_encoder_position(0));
+    }
+
+    TMC5160Emulator chip;
+    TMC5160<TMC5160Emulator> axis{chip, motor_settings};
+    EncoderMonitor<TMC5160<TMC5160Emulator>> monitor{axis, 128U};
+};
+
+TEST_F(EncoderMonitorTest, CheckIsOnePipelinedBurst)
+{
+    const auto before{chip.datagrams()};
+
+    const auto check{monitor.sample()};
+
+    ASSERT_TRUE(check);
+    EXPECT_EQ(chip.datagrams() - before, 3U) << "XACTUAL, X_ENC + trailer";
+    EXPECT_FALSE(check->deviated);
+}
+
+TEST_F(EncoderMonitorTest, TracksMotionWithoutTripping)
+{
+    ASSERT_TRUE(axis.move_to(51'200_steps, 300_rpm));
+
+    for (int tick{}; tick < 50; ++tick)
+    {
+        chip.advance(2ms);
+        const auto check{monitor.sample()};
+        ASSERT_TRUE(check);
+        EXPECT_EQ(check->deviation, 0);
+    }
+
+    EXPECT_GT(chip.position(), 0.0);
+    EXPECT_FALSE(monitor.tripped());
+}
+
+TEST_F(EncoderMonitorTest, StepLossTripsAndLatches)
+{
+    ASSERT_TRUE(axis.move_to(51'200_steps, 300_rpm));
+    chip.advance(20ms);
+
+    chip.lose_steps(100);
+    const auto within{monitor.sample()};
+    ASSERT_TRUE(within);
+    EXPECT_EQ(within->deviation, -100);
+    EXPECT_FALSE(within->deviated) << "Inside the threshold";
+
+    chip.lose_steps(256);
+    const auto lost{monitor.sample()};
+    ASSERT_TRUE(lost);
+    EXPECT_EQ(lost->x_enc - lost->x_actual, -356);
+    EXPECT_TRUE(lost->deviated);
+
+    ASSERT_TRUE(axis.set_encoder_position(lost->x_actual));
+    const auto realigned{monitor.sample()};
+    ASSERT_TRUE(realigned);
+    EXPECT_FALSE(realigned->deviated);
+
+    EXPECT_TRUE(monitor.tripped()) << "Latched until clear()";
+    EXPECT_EQ(monitor.deviation_count(), 1U);
+    EXPECT_EQ(monitor.peak_deviation(), 356U);
+
+    monitor.clear();
+    EXPECT_FALSE(monitor.tripped());
+    EXPECT_EQ(monitor.peak_deviation(), 0U);
+}
+
+TEST_F(EncoderMonitorTest, EncoderSurvivesShadowRestore)
+{
+    chip.power_cycle();
+    ASSERT_TRUE(axis.restore_from_shadow());
+
+    EXPECT_EQ(chip.peek(RegAddress::ENC_CONST), (12U << 16U) | 8000U);
+    EXPECT_EQ(regs::ENCMODE::enc_sel_decimal_t::extract(chip.peek(RegAddress::ENCMODE)), 1U);
+}
+
+TEST(EncoderConfigurationTest, PicksTheExactFractionMode)
+{
+    TMC5160Emulator chip;
+    TMC5160<TMC5160Emulator> axis{chip, motor_settings};
+
+    ASSERT_TRUE(axis.configure_encoder(1000));
+    EXPECT_EQ(chip.peek(RegAddress::ENC_CONST), (51U << 16U) | 2000U) << "51.2 only exact in decimal";
+    EXPECT_EQ(chip.peek(RegAddress::ENCMODE), regs::ENCMODE::enc_sel_decimal_t{1U}.value);
+
+    ASSERT_TRUE(axis.configure_encoder(4096));
+    EXPECT_EQ(chip.peek(RegAddress::ENC_CONST), (12U << 16U) | 0x8000U) << "12.5 exact in binary";
+    EXPECT_EQ(chip.peek(RegAddress::ENCMODE), 0U);
+
+    EXPECT_EQ(axis.configure_encoder(0).error(), helpers::ErrorCode::INVALID_PARAMETER);
+}
+
+TEST(EncoderMonitorBatchTest, CheckIsOneBatch)
+{
+    RecordingBatchSpi<> spi;
+    TMC5160<RecordingBatchSpi<>> axis{spi, motor_settings};
+    EncoderMonitor monitor{axis, 64U};
+
+    ASSERT_TRUE(monitor.sample());
+
+    EXPECT_EQ(spi.get_batch_count(), 1U);
+    EXPECT_EQ(spi.get_datagram_count(), 3U);
+}
+
+} // namespace tmcxx::features::test
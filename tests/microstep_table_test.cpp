@@ -0,0 +1,141 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <numbers>
+
+#include "mocks/mock_spi.hpp"
+#include "mocks/recording_spi.hpp"
+#include "mocks/tmc5160_emulator.hpp"
+#include "tmcxx/features/daisy_chain.hpp"
+#include "tmcxx/features/microstep_table.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using ::tmcxx::test::RecordingBatchSpi;
+using ::tmcxx::test::TMC5160Emulator;
+
+namespace regs = chip::tmc5160;
+
+constexpr regs::Settings motor_settings{};
+
+constexpr auto sine_table{make_microstep_table<sine_quarter_wave(240U)>()};
+constexpr auto triangle_wave{sample_quarter_wave([](double phase) { return phase; }, 200U)};
+constexpr auto triangle_table{make_microstep_table<triangle_wave>()};
+
+static_assert(sine_table.decode() == sine_quarter_wave(240U), "Tables are generated and checked at compile time");
+static_assert(triangle_table.decode() == triangle_wave);
+static_assert(regs::MSLUT_7::address == static_cast<uint8_t>(regs::RegAddress::MSLUT_7));
+static_assert(MicrostepTable::addresses.back() == regs::MSLUTSTART::address);
+
+TEST(MicrostepTableTest, DefaultTableIsTheDatasheetSine)
+{
+    const auto wave{default_microstep_table.decode()};
+
+    EXPECT_EQ(wave.front(), 0U);
+    for (std::size_t idx{1U}; idx < wave.size(); ++idx)
+    {
+        const double expected{248.0 * std::sin((static_cast<double>(idx) - 0.5) * std::numbers::pi / 512.0)};
+        EXPECT_NEAR(static_cast<double>(wave[idx]), expected, 0.5) << idx;
+    }
+}
+
+TEST(MicrostepTableTest, EncoderReproducesDefaultWave)
+{
+    const auto table{encode_microstep_table(default_microstep_table.decode())};
+
+    ASSERT_TRUE(table);
+    EXPECT_EQ(table->decode(), default_microstep_table.decode());
+    EXPECT_EQ(table->lut[0], default_microstep_table.lut[0]) << "Same segment widths where the slope is steep";
+}
+
+TEST(MicrostepTableTest, SegmentsFollowTheSlope)
+{
+    EXPECT_EQ(regs::MSLUTSTART::start_sin_t::extract(sine_table.start), 0U);
+    EXPECT_EQ(regs::MSLUTSTART::start_sin90_t::extract(sine_table.start), 240U);
+
+    EXPECT_EQ(regs::MSLUTSEL::w0_t::extract(sine_table.sel), 2U) << "Steep start: +1/+2";
+    EXPECT_EQ(regs::MSLUTSEL::w1_t::extract(sine_table.sel), 1U) << "Flat top: +0/+1";
+
+    EXPECT_EQ(regs::MSLUTSEL::x1_t::extract(triangle_table.sel), 255U) << "Constant slope needs one segment";
+}
+
+TEST(MicrostepTableTest, UnencodableWavesAreRejected)
+{
+    quarter_wave_t jump{sine_quarter_wave()};
+    jump[100] = static_cast<uint8_t>(jump[99] + 4U);
+    EXPECT_EQ(encode_microstep_table(jump).error(), helpers::ErrorCode::INVALID_PARAMETER);
+
+    // Alternating falling and steep rising runs need five segments
+    quarter_wave_t zigzag{};
+    zigzag[0] = 100U;
+    for (std::size_t idx{}; idx < microstep_table_entries; ++idx)
+    {
+        const bool falling{((idx / 10U) % 2U) == 0U && idx < 50U};
+        const int step{falling ? -1 : ((idx < 50U) ? 2 : 0)};
+        zigzag[idx + 1U] = static_cast<uint8_t>(zigzag[idx] + step);
+    }
+    EXPECT_EQ(encode_microstep_table(zigzag).error(), helpers::ErrorCode::INVALID_PARAMETER);
+}
+
+TEST(MicrostepTableTest, UploadIsOneBurst)
+{
+    RecordingBatchSpi<> spi;
+    TMC5160<RecordingBatchSpi<>> motor{spi, motor_settings};
+
+    ASSERT_TRUE(motor.load_microstep_table(sine_table));
+
+    EXPECT_EQ(spi.get_batch_count(), 1U);
+    EXPECT_EQ(spi.get_datagram_count(), MicrostepTable::register_count);
+    EXPECT_EQ(spi.get_last_written_value(regs::MSLUT_3::address), sine_table.lut[3]);
+    EXPECT_EQ(spi.get_last_written_value(regs::MSLUTSEL::address), sine_table.sel);
+}
+
+TEST(MicrostepTableTest, EmulatedChipHoldsTable)
+{
+    TMC5160Emulator chip;
+    TMC5160<TMC5160Emulator> motor{chip, motor_settings};
+
+    motor.begin_transaction();
+    ASSERT_TRUE(motor.load_microstep_table(triangle_table)) << "Unshadowed burst is sent inside a transaction";
+    EXPECT_EQ(chip.peek(regs::RegAddress::MSLUT_0), triangle_table.lut[0]);
+    EXPECT_EQ(chip.peek(regs::RegAddress::MSLUTSTART), triangle_table.start);
+    ASSERT_TRUE(motor.commit());
+}
+
+TEST(MicrostepTableTest, DaisyChainUploadsEveryAxisInTenFrames)
+{
+    using chain_t = DaisyChain<::tmcxx::test::MockSpi, 3, MicrostepTable::register_count>;
+
+    ::tmcxx::test::MockSpi spi;
+    chain_t chain{spi};
+    using axis_t = TMC5160<chain_t::Channel>;
+    axis_t x_axis{chain.channel(0), motor_settings};
+    axis_t y_axis{chain.channel(1), motor_settings};
+    axis_t z_axis{chain.channel(2), motor_settings};
+
+    chain.begin_frame();
+    ASSERT_TRUE(x_axis.load_microstep_table(sine_table));
+    ASSERT_TRUE(y_axis.load_microstep_table(triangle_table));
+    ASSERT_TRUE(z_axis.load_microstep_table(sine_table));
+    ASSERT_TRUE(chain.end_frame());
+
+    EXPECT_EQ(chain.frame_count(), MicrostepTable::register_count);
+}
+
+TEST(MicrostepTableTest, BurstRejectsShadowedRegisters)
+{
+    RecordingBatchSpi<> spi;
+    CoreCommunicator<RecordingBatchSpi<>> comm{spi};
+
+    const std::array<uint8_t, 2> addresses{regs::MSLUT_0::address, regs::VMAX::address};
+    const std::array<uint32_t, 2> values{1U, 2U};
+
+    EXPECT_EQ(comm.write_burst(addresses, values).error(), helpers::ErrorCode::INVALID_PARAMETER);
+    EXPECT_EQ(comm.write_burst(std::span{addresses}.first(1U), values).error(), helpers::ErrorCode::INVALID_PARAMETER);
+    EXPECT_EQ(spi.get_datagram_count(), 0U);
+}
+
+} // namespace tmcxx::features::test
@@ -4,9 +4,11 @@
 #include <algorithm>
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <optional>
 #include <ranges>
 #include <span>
+#include <utility>
 #include <vector>
 
 #include "tmcxx/base/concepts.hpp"
@@ -57,7 +59,12 @@ class MockSpi {
         if (m_next_transfer_fails)
         {
             m_next_transfer_fails = false;
-            return false;
+            return fail_transfer();
+        }
+
+        if (m_transfers_until_failure > 0U && --m_transfers_until_failure == 0U)
+        {
+            return fail_transfer();
         }
 
         SpiTransaction transaction{};
@@ -67,6 +74,11 @@ class MockSpi {
         {
             const std::size_t copy_size{std::min(rx_data.size(), m_pending_response.size())};
             std::copy_n(m_pending_response.begin(), copy_size, rx_data.begin());
+        }
+
+        if (!rx_data.empty())
+        {
+            rx_data[0] = m_status_byte;
             transaction.rx_data.assign(rx_data.begin(), rx_data.end());
         }
 
@@ -144,6 +156,8 @@ class MockSpi {
         m_selected = false;
         m_select_count = 0;
         m_deselect_count = 0;
+        m_transfers_until_failure = 0;
+        m_status_byte = 0x00U;
     }
 
     [[nodiscard]] std::vector<SpiTransaction> find_writes_to(uint8_t address) const
@@ -176,7 +190,40 @@ class MockSpi {
         m_next_transfer_fails = fail;
     }
 
+    /**
+     * @brief Let @p successful transfers pass, then fail the following one.
+     */
+    void set_transfer_failure_after(std::size_t successful) noexcept
+    {
+        m_transfers_until_failure = successful + 1U;
+    }
+
+    /**
+     * @brief Callback run inside every failing transfer (e.g. to model an interrupt arriving mid-transfer).
+     */
+    void set_failure_hook(std::function<void()> hook)
+    {
+        m_failure_hook = std::move(hook);
+    }
+
+    /**
+     * @brief SPI status byte placed in rx[0] of every following transfer.
+     */
+    void set_status_byte(uint8_t status) noexcept
+    {
+        m_status_byte = status;
+    }
+
   private:
+    bool fail_transfer()
+    {
+        if (m_failure_hook)
+        {
+            m_failure_hook();
+        }
+        return false;
+    }
+
     void prepare_response(uint8_t address)
     {
         m_pending_response.clear();
@@ -196,10 +243,127 @@ class MockSpi {
     std::size_t m_select_count{0};
     std::size_t m_deselect_count{0};
     bool m_next_transfer_fails{false};
+    std::size_t m_transfers_until_failure{0};
+    uint8_t m_status_byte{0x00U};
+    std::function<void()> m_failure_hook;
 };
 
 static_assert(core::concepts::SpiDevice<MockSpi>, "MockSpi must satisfy SpiDevice concept");
 
+class MockAsyncSpi : public MockSpi {
+  public:
+    bool transfer_async(std::span<const uint8_t> tx_data,
+        std::span<uint8_t> rx_data,
+        core::concepts::spi_completion_t on_complete,
+        void* context)
+    {
+        if (m_refuse_next_submit)
+        {
+            m_refuse_next_submit = false;
+            return false;
+        }
+
+        m_pending = PendingTransfer{tx_data, rx_data, on_complete, context};
+        m_submit_count++;
+        return true;
+    }
+
+    [[nodiscard]] bool has_pending() const noexcept
+    {
+        return m_pending.has_value();
+    }
+
+    void complete_pending(bool success = true)
+    {
+        const auto pending{*m_pending};
+        m_pending.reset();
+
+        const bool transferred{transfer(pending.tx_data, pending.rx_data, 0U)};
+        pending.on_complete(pending.context, success && transferred);
+    }
+
+    void complete_all()
+    {
+        while (has_pending())
+        {
+            complete_pending();
+        }
+    }
+
+    void set_next_submit_refused(bool refuse)
+    {
+        m_refuse_next_submit = refuse;
+    }
+
+    [[nodiscard]] std::size_t get_submit_count() const noexcept
+    {
+        return m_submit_count;
+    }
+
+  private:
+    struct PendingTransfer
+    {
+        std::span<const uint8_t> tx_data;
+        std::span<uint8_t> rx_data;
+        core::concepts::spi_completion_t on_complete;
+        void* context;
+    };
+
+    std::optional<PendingTransfer> m_pending;
+    std::size_t m_submit_count{0};
+    bool m_refuse_next_submit{false};
+};
+
+static_assert(core::concepts::AsyncSpiDevice<MockAsyncSpi>, "MockAsyncSpi must satisfy AsyncSpiDevice concept");
+static_assert(!core::concepts::AsyncSpiDevice<MockSpi>, "MockSpi must stay a blocking-only device");
+
+/**
+ * @brief MockSpi with multi-datagram submission; every frame is recorded as its own transaction.
+ */
+class MockBatchSpi : public MockSpi {
+  public:
+    bool transfer_frames(
+        std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, std::size_t frame_size, uint32_t timeout_ms)
+    {
+        m_batch_sizes.push_back(tx_data.size() / frame_size);
+
+        if (m_next_batch_fails)
+        {
+            m_next_batch_fails = false;
+            return false;
+        }
+
+        bool success{true};
+        for (std::size_t offset{}; offset < tx_data.size() && success; offset += frame_size)
+        {
+            select();
+            success = transfer(tx_data.subspan(offset, frame_size), rx_data.subspan(offset, frame_size), timeout_ms);
+            deselect();
+        }
+        return success;
+    }
+
+    /**
+     * @brief Datagram count of every transfer_frames() call, in order.
+     */
+    [[nodiscard]] const std::vector<std::size_t>& get_batch_sizes() const noexcept
+    {
+        return m_batch_sizes;
+    }
+
+    void set_next_batch_failure(bool fail) noexcept
+    {
+        m_next_batch_fails = fail;
+    }
+
+  private:
+    std::vector<std::size_t> m_batch_sizes;
+    bool m_next_batch_fails{false};
+};
+
+static_assert(core::concepts::BatchSpiDevice<MockBatchSpi>, "MockBatchSpi must satisfy BatchSpiDevice concept");
+static_assert(!core::concepts::BatchSpiDevice<MockSpi>, "MockSpi must stay a single-datagram device");
+
 } // namespace tmcxx::test
 
 #endif // TMCXX_TESTS_MOCK_SPI_HPP
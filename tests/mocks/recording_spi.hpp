@@ -0,0 +1,328 @@
+#ifndef TMCXX_TESTS_RECORDING_SPI_HPP
+#define TMCXX_TESTS_RECORDING_SPI_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+
+#include "tmcxx/base/concepts.hpp"
+#include "tmcxx/helpers/constants.hpp"
+
+namespace tmcxx::test {
+
+/**
+ * @brief One recorded 40-bit datagram as sent (address byte + 32-bit data, big endian).
+ */
+struct DatagramRecord
+{
+    std::array<uint8_t, 5> bytes{};
+
+    [[nodiscard]] constexpr uint8_t get_address() const noexcept
+    {
+        return bytes[0] & 0x7FU;
+    }
+
+    [[nodiscard]] constexpr bool is_write_operation() const noexcept
+    {
+        return (bytes[0] & helpers::constant::tmc_write_bit) != 0U;
+    }
+
+    [[nodiscard]] constexpr uint32_t get_write_value() const noexcept
+    {
+        return (static_cast<uint32_t>(bytes[1]) << 24U) | (static_cast<uint32_t>(bytes[2]) << 16U) |
+               (static_cast<uint32_t>(bytes[3]) << 8U) | static_cast<uint32_t>(bytes[4]);
+    }
+};
+
+static_assert(sizeof(DatagramRecord) == 5U, "Records are packed 5-byte datagrams");
+
+/**
+ * @brief Allocation-free recording SPI device for high-volume tests.
+ *
+ * Replies like MockSpi (status byte, then the value of the register read by the previous datagram), but records into
+ * a preallocated ring of the last Capacity datagrams instead of one heap-allocated SpiTransaction per transfer.
+ * Transfers of several datagrams (daisy-chain frames) are split into 5-byte records; reply lag is kept per
+ * datagram position in the frame, as every chip of a chain shifts out its own previous reply. Per-address read and
+ * write counters plus the last value written to every address answer the usual queries in O(1), whether or not the
+ * datagram is still in the ring.
+ *
+ * @tparam Capacity Datagrams kept in the ring (oldest are overwritten).
+ */
+template<std::size_t Capacity = 1024U>
+class RecordingSpi {
+  public:
+    /**
+     * @brief Longest transfer accepted (chain length of a daisy-chain frame).
+     */
+    static constexpr std::size_t max_frame_datagrams{16U};
+    static constexpr std::size_t datagram_size{5U};
+
+    static_assert(Capacity > 0U, "Ring needs at least one record");
+
+    bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, [[maybe_unused]] uint32_t timeout_ms)
+    {
+        if (m_next_transfer_fails)
+        {
+            m_next_transfer_fails = false;
+            return false;
+        }
+
+        if (m_transfers_until_failure > 0U && --m_transfers_until_failure == 0U)
+        {
+            return false;
+        }
+
+        const std::size_t count{tx_data.size() / datagram_size};
+        if (0U == count || tx_data.size() != count * datagram_size || rx_data.size() != tx_data.size() ||
+            count > max_frame_datagrams) [[unlikely]]
+        {
+            return false;
+        }
+
+        for (std::size_t position{}; position < count; ++position)
+        {
+            const auto tx{tx_data.subspan(position * datagram_size, datagram_size)};
+            const auto rx{rx_data.subspan(position * datagram_size, datagram_size)};
+
+            rx[0] = m_status_byte;
+            const uint32_t reply{m_replies[position]};
+            for (std::size_t idx{}; idx < 4U; ++idx)
+            {
+                rx[1U + idx] = static_cast<uint8_t>(reply >> (8U * (3U - idx)));
+            }
+
+            record(tx, position);
+        }
+
+        ++m_transfer_count;
+        return true;
+    }
+
+    void select() noexcept
+    {
+        m_selected = true;
+        ++m_select_count;
+    }
+
+    void deselect() noexcept
+    {
+        m_selected = false;
+        ++m_deselect_count;
+    }
+
+    void set_register_value(uint8_t address, uint32_t value) noexcept
+    {
+        m_register_values[address & address_mask] = value;
+    }
+
+    /**
+     * @brief SPI status byte placed in the first byte of every following reply datagram.
+     */
+    void set_status_byte(uint8_t status) noexcept
+    {
+        m_status_byte = status;
+    }
+
+    void set_next_transfer_failure(bool fail) noexcept
+    {
+        m_next_transfer_fails = fail;
+    }
+
+    /**
+     * @brief Let @p successful transfers pass, then fail the following one.
+     */
+    void set_transfer_failure_after(std::size_t successful) noexcept
+    {
+        m_transfers_until_failure = successful + 1U;
+    }
+
+    /**
+     * @brief Datagrams recorded since the last reset, including those overwritten in the ring.
+     */
+    [[nodiscard]] std::size_t get_datagram_count() const noexcept
+    {
+        return m_datagram_count;
+    }
+
+    /**
+     * @brief Successful transfer() calls since the last reset.
+     */
+    [[nodiscard]] std::size_t get_transfer_count() const noexcept
+    {
+        return m_transfer_count;
+    }
+
+    /**
+     * @brief Datagrams still held by the ring.
+     */
+    [[nodiscard]] std::size_t get_record_count() const noexcept
+    {
+        return std::min(m_datagram_count, Capacity);
+    }
+
+    /**
+     * @brief Held datagram @p index, 0 = oldest still in the ring.
+     */
+    [[nodiscard]] const DatagramRecord& get_record(std::size_t index) const noexcept
+    {
+        const std::size_t first{m_datagram_count - get_record_count()};
+        return m_ring[(first + index) % Capacity];
+    }
+
+    [[nodiscard]] const DatagramRecord& get_last_record() const noexcept
+    {
+        return m_ring[(m_datagram_count - 1U) % Capacity];
+    }
+
+    [[nodiscard]] std::size_t get_read_count(uint8_t address) const noexcept
+    {
+        return m_read_counts[address & address_mask];
+    }
+
+    [[nodiscard]] std::size_t get_write_count(uint8_t address) const noexcept
+    {
+        return m_write_counts[address & address_mask];
+    }
+
+    /**
+     * @brief Value of the last write to @p address, O(1).
+     */
+    [[nodiscard]] std::optional<uint32_t> get_last_written_value(uint8_t address) const noexcept
+    {
+        const uint8_t addr{static_cast<uint8_t>(address & address_mask)};
+
+        if (0U == m_write_counts[addr])
+        {
+            return std::nullopt;
+        }
+        return m_last_written[addr];
+    }
+
+    [[nodiscard]] bool is_selected() const noexcept
+    {
+        return m_selected;
+    }
+
+    [[nodiscard]] std::size_t get_select_count() const noexcept
+    {
+        return m_select_count;
+    }
+
+    [[nodiscard]] std::size_t get_deselect_count() const noexcept
+    {
+        return m_deselect_count;
+    }
+
+    /**
+     * @brief Forget the recording and the counters; register values and the status byte are kept.
+     */
+    void clear_transactions() noexcept
+    {
+        m_datagram_count = 0U;
+        m_transfer_count = 0U;
+        m_read_counts.fill(0U);
+        m_write_counts.fill(0U);
+    }
+
+    void reset() noexcept
+    {
+        clear_transactions();
+        m_register_values.fill(0U);
+        m_last_written.fill(0U);
+        m_replies.fill(0U);
+        m_selected = false;
+        m_select_count = 0U;
+        m_deselect_count = 0U;
+        m_next_transfer_fails = false;
+        m_transfers_until_failure = 0U;
+        m_status_byte = 0x00U;
+    }
+
+  private:
+    static constexpr uint8_t address_mask{0x7FU};
+    static constexpr std::size_t address_count{helpers::constant::tmc_register_count};
+
+    std::array<DatagramRecord, Capacity> m_ring{};
+    std::size_t m_datagram_count{};
+    std::size_t m_transfer_count{};
+
+    std::array<std::size_t, address_count> m_read_counts{};
+    std::array<std::size_t, address_count> m_write_counts{};
+    std::array<uint32_t, address_count> m_last_written{};
+    std::array<uint32_t, address_count> m_register_values{};
+    std::array<uint32_t, max_frame_datagrams> m_replies{};
+
+    bool m_selected{false};
+    std::size_t m_select_count{};
+    std::size_t m_deselect_count{};
+    bool m_next_transfer_fails{false};
+    std::size_t m_transfers_until_failure{};
+    uint8_t m_status_byte{0x00U};
+
+    void record(std::span<const uint8_t> tx, std::size_t position) noexcept
+    {
+        auto& entry{m_ring[m_datagram_count % Capacity]};
+        std::copy_n(tx.begin(), datagram_size, entry.bytes.begin());
+        ++m_datagram_count;
+
+        const uint8_t addr{entry.get_address()};
+
+        if (entry.is_write_operation())
+        {
+            ++m_write_counts[addr];
+            m_last_written[addr] = entry.get_write_value();
+        }
+        else
+        {
+            ++m_read_counts[addr];
+            m_replies[position] = m_register_values[addr];
+        }
+    }
+};
+
+static_assert(core::concepts::SpiDevice<RecordingSpi<>>, "RecordingSpi must satisfy SpiDevice concept");
+static_assert(!core::concepts::BatchSpiDevice<RecordingSpi<>>, "RecordingSpi must stay a single-datagram device");
+
+/**
+ * @brief RecordingSpi with multi-datagram submission; every frame is recorded individually.
+ */
+template<std::size_t Capacity = 1024U>
+class RecordingBatchSpi : public RecordingSpi<Capacity> {
+  public:
+    bool transfer_frames(
+        std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, std::size_t frame_size, uint32_t timeout_ms)
+    {
+        ++m_batch_count;
+
+        bool success{true};
+        for (std::size_t offset{}; offset < tx_data.size() && success; offset += frame_size)
+        {
+            this->select();
+            success = this->transfer(tx_data.subspan(offset, frame_size), rx_data.subspan(offset, frame_size),
+                timeout_ms);
+            this->deselect();
+        }
+        return success;
+    }
+
+    /**
+     * @brief transfer_frames() calls since construction.
+     */
+    [[nodiscard]] std::size_t get_batch_count() const noexcept
+    {
+        return m_batch_count;
+    }
+
+  private:
+    std::size_t m_batch_count{};
+};
+
+static_assert(core::concepts::BatchSpiDevice<RecordingBatchSpi<>>,
+    "RecordingBatchSpi must satisfy BatchSpiDevice concept");
+
+} // namespace tmcxx::test
+
+#endif // TMCXX_TESTS_RECORDING_SPI_HPP
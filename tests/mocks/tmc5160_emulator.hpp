@@ -0,0 +1,670 @@
+#ifndef TMCXX_TESTS_TMC5160_EMULATOR_HPP
+#define TMCXX_TESTS_TMC5160_EMULATOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <span>
+#include <tuple>
+
+#include "tmcxx/base/concepts.hpp"
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/helpers/constants.hpp"
+
+namespace tmcxx::test {
+
+/**
+ * @brief Behavioral TMC5160 model behind the SpiDevice interface.
+ *
+ * Where MockSpi replies with canned values, the emulator keeps the chip's semantics:
+ *   - 40-bit datagrams with the one-datagram response lag: a reply carries the current SPI status byte and the data
+ *     latched by the previous read request (write datagrams do not change the latched data).
+ *   - WO registers read back as 0 and writes to RO registers are dropped (access taken from register_tuple, plus
+ *     the chip's other read-only registers). GSTAT clears on read and on writing 1, the RAMP_STAT latch/event
+ *     flags clear on writing 1. IFCNT stays 0 as on an SPI link; set_uart_mode() makes it count accepted writes.
+ *   - The ramp generator integrates XACTUAL/VACTUAL on a simulated clock moved by advance(): positioning with the
+ *     six-point VSTART/A1/V1/AMAX/VMAX/DMAX/D1/VSTOP ramp, velocity modes accelerating with AMAX, and hold.
+ *   - X_ENC follows the rotor in XACTUAL units (as with a matching ENC_CONST); lose_steps() makes it lag.
+ *   - SW_MODE.sg_stop stops the motor on a StallGuard2 stall (SG_RESULT = 0 above TCOOLTHRS, see set_sg_result())
+ *     and keeps it stopped while RAMP_STAT.event_stop_sg is set.
+ *
+ * Wire latency is modeled in simulated time (set_datagram_time(): every datagram advances the clock) and in wall
+ * time (set_blocking_latency(): every transfer spins), e.g. to measure end-to-end command latency of the stack.
+ * An instance models one chip without allocating, so hundreds of virtual axes are cheap.
+ */
+class TMC5160Emulator {
+  public:
+    /**
+     * @brief Hook called for every accepted write datagram, after the chip applied it.
+     */
+    using write_hook_t = void (*)(void* context, uint8_t address, uint32_t value);
+
+    static constexpr std::size_t datagram_size{5U};
+
+    /**
+     * @brief Construct a chip that just powered up (all registers 0, GSTAT.reset set).
+     *
+     * @param f_clk_hz Chip clock; scales the ramp registers like features::Converter.
+     */
+    explicit TMC5160Emulator(double f_clk_hz = 12'000'000.0) noexcept
+        : m_f_clk{f_clk_hz}
+    {
+        power_cycle();
+    }
+
+    bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, [[maybe_unused]] uint32_t timeout_ms)
+    {
+        if (tx_data.size() != datagram_size || rx_data.size() != datagram_size) [[unlikely]]
+        {
+            return false;
+        }
+
+        if (!m_selected)
+        {
+            ++m_framing_errors;
+        }
+
+        spin(m_blocking_latency);
+        advance(m_datagram_time);
+
+        rx_data[0] = status_byte();
+        for (std::size_t idx{}; idx < 4U; ++idx)
+        {
+            rx_data[1U + idx] = static_cast<uint8_t>(m_reply >> (8U * (3U - idx)));
+        }
+
+        const auto addr{static_cast<uint8_t>(tx_data[0] & address_mask)};
+        const uint32_t value{(static_cast<uint32_t>(tx_data[1]) << 24U) | (static_cast<uint32_t>(tx_data[2]) << 16U) |
+                             (static_cast<uint32_t>(tx_data[3]) << 8U) | static_cast<uint32_t>(tx_data[4])};
+
+        if ((tx_data[0] & helpers::constant::tmc_write_bit) != 0U)
+        {
+            if (m_dropped_writes > 0U)
+            {
+                --m_dropped_writes;
+            }
+            else
+            {
+                write(addr, value);
+            }
+        }
+        else
+        {
+            m_reply = read(addr);
+        }
+
+        ++m_datagrams;
+        return true;
+    }
+
+    void select() noexcept
+    {
+        m_selected = true;
+    }
+
+    void deselect() noexcept
+    {
+        m_selected = false;
+    }
+
+    /**
+     * @brief Run the ramp generator for @p duration of simulated time.
+     */
+    void advance(std::chrono::nanoseconds duration) noexcept
+    {
+        m_unintegrated += duration;
+
+        while (m_unintegrated >= m_step)
+        {
+            m_unintegrated -= m_step;
+            m_now += m_step;
+            integrate(std::chrono::duration<double>{m_step}.count());
+        }
+    }
+
+    /**
+     * @brief Simulated time since construction (advanced by advance() and by datagrams).
+     */
+    [[nodiscard]] std::chrono::nanoseconds now() const noexcept
+    {
+        return m_now + m_unintegrated;
+    }
+
+    /**
+     * @brief Reset the chip: registers, motion and latched reply cleared, GSTAT.reset set.
+     */
+    void power_cycle() noexcept
+    {
+        m_registers.fill(0U);
+        m_registers[address(RegAddress::GSTAT)] = gstat_reset;
+        m_registers[address(RegAddress::IOIN)] = chip_version << 24U;
+        m_ramp_events = 0U;
+        m_position = 0.0;
+        m_velocity = 0.0;
+        m_was_reached = true;
+        m_reply = 0U;
+        m_encoder_offset = 0U;
+    }
+
+    /**
+     * @brief Register value as the chip holds it, without read side effects (WO registers included).
+     */
+    [[nodiscard]] uint32_t peek(chip::tmc5160::RegAddress reg_address) const noexcept
+    {
+        return live_value(static_cast<uint8_t>(reg_address));
+    }
+
+    /**
+     * @brief Motor load seen by StallGuard2 (DRV_STATUS.SG_RESULT, 0 = stall, default 1023 = no load).
+     */
+    void set_sg_result(uint16_t sg_result) noexcept
+    {
+        m_sg_result = static_cast<uint16_t>(sg_result & sg_result_mask);
+    }
+
+    /**
+     * @brief Set GSTAT.drv_err (over temperature or short), reported in the status byte of every reply.
+     */
+    void set_driver_error(bool error) noexcept
+    {
+        auto& gstat{m_registers[address(RegAddress::GSTAT)]};
+        gstat = error ? (gstat | gstat_drv_err) : (gstat & ~gstat_drv_err);
+    }
+
+    /**
+     * @brief Simulated bus time of one datagram (e.g. 40 bits at the SPI clock plus chip select gaps).
+     */
+    void set_datagram_time(std::chrono::nanoseconds duration) noexcept
+    {
+        m_datagram_time = duration;
+    }
+
+    /**
+     * @brief Wall time every transfer() blocks for.
+     */
+    void set_blocking_latency(std::chrono::nanoseconds latency) noexcept
+    {
+        m_blocking_latency = latency;
+    }
+
+    /**
+     * @brief Integration step of the ramp generator (default 10 us).
+     */
+    void set_integration_step(std::chrono::nanoseconds step) noexcept
+    {
+        m_step = std::max(step, std::chrono::nanoseconds{1});
+    }
+
+    /**
+     * @brief Model the single wire (UART) interface, where IFCNT counts accepted write datagrams. Off by default.
+     */
+    void set_uart_mode(bool enabled) noexcept
+    {
+        m_uart_mode = enabled;
+    }
+
+    /**
+     * @brief Corrupt the next @p count write datagrams on the wire: the chip discards them and IFCNT stays.
+     */
+    void drop_next_writes(std::size_t count) noexcept
+    {
+        m_dropped_writes = count;
+    }
+
+    /**
+     * @brief Lose @p microsteps: the rotor, and X_ENC reading it, falls behind XACTUAL.
+     */
+    void lose_steps(int32_t microsteps) noexcept
+    {
+        m_encoder_offset -= static_cast<uint32_t>(microsteps);
+    }
+
+    void set_write_hook(write_hook_t hook, void* context = nullptr) noexcept
+    {
+        m_write_hook = hook;
+        m_write_context = context;
+    }
+
+    /**
+     * @brief Exact (unrounded) position in microsteps.
+     */
+    [[nodiscard]] double position() const noexcept
+    {
+        return m_position;
+    }
+
+    /**
+     * @brief Signed velocity in microsteps per second.
+     */
+    [[nodiscard]] double velocity() const noexcept
+    {
+        return m_velocity;
+    }
+
+    [[nodiscard]] std::size_t datagrams() const noexcept
+    {
+        return m_datagrams;
+    }
+
+    /**
+     * @brief Datagrams transferred while chip select was inactive (the chip would have ignored them).
+     */
+    [[nodiscard]] std::size_t framing_errors() const noexcept
+    {
+        return m_framing_errors;
+    }
+
+  private:
+    using RegAddress = chip::tmc5160::RegAddress;
+    using RampModeType = chip::tmc5160::RampModeType;
+
+    static constexpr uint8_t address_mask{0x7FU};
+    static constexpr uint32_t chip_version{0x30U};
+    static constexpr uint32_t gstat_reset{1U << 0U};
+    static constexpr uint32_t gstat_drv_err{1U << 1U};
+    static constexpr uint32_t ramp_event_mask{0xFCU};
+    static constexpr uint32_t ramp_event_stop_sg{chip::tmc5160::RAMP_STAT::event_stop_sg_t{1U}.value};
+    static constexpr uint32_t ramp_event_pos_reached{chip::tmc5160::RAMP_STAT::event_pos_reached_t{1U}.value};
+    static constexpr uint32_t sg_stop_bit{chip::tmc5160::SW_MODE::sg_stop_t{1U}.value};
+    static constexpr uint32_t tstep_max{(1U << 20U) - 1U};
+    static constexpr uint16_t sg_result_mask{0x3FFU};
+    static constexpr uint32_t vactual_mask{0xFFFFFFU};
+    static constexpr double velocity_scale{static_cast<double>(1ULL << 24U)};
+    static constexpr double acceleration_scale{static_cast<double>(1ULL << 41U)};
+    static constexpr double position_wrap{4'294'967'296.0};
+
+    /**
+     * @brief Access of every address: register_tuple's definitions plus the chip's other read-only registers.
+     */
+    static constexpr std::array<core::Access, helpers::constant::tmc_register_count> access_of_address{[] {
+        std::array<core::Access, helpers::constant::tmc_register_count> table{};
+        table.fill(core::Access::RW);
+
+        std::apply(
+            [&table]<typename... Regs>(Regs...) {
+                ((table[std::decay_t<Regs>::address] = std::decay_t<Regs>::access), ...);
+            },
+            chip::tmc5160::register_tuple.fields);
+
+        for (const auto reg: {RegAddress::IFCNT, RegAddress::IOIN, RegAddress::OTP_READ, RegAddress::OFFSET_READ,
+                 RegAddress::TSTEP, RegAddress::XLATCH, RegAddress::ENC_LATCH, RegAddress::MSCNT, RegAddress::MSCURACT,
+                 RegAddress::PWM_SCALE, RegAddress::PWM_AUTO, RegAddress::LOST_STEPS})
+        {
+            table[static_cast<uint8_t>(reg)] = core::Access::RO;
+        }
+
+        return table;
+    }()};
+
+    std::array<uint32_t, helpers::constant::tmc_register_count> m_registers{};
+    uint32_t m_ramp_events{};
+    uint32_t m_reply{};
+    uint16_t m_sg_result{sg_result_mask};
+    uint32_t m_encoder_offset{};
+
+    double m_f_clk{};
+    double m_position{};
+    double m_velocity{};
+    bool m_was_reached{true};
+
+    std::chrono::nanoseconds m_now{};
+    std::chrono::nanoseconds m_unintegrated{};
+    std::chrono::nanoseconds m_step{std::chrono::microseconds{10}};
+    std::chrono::nanoseconds m_datagram_time{};
+    std::chrono::nanoseconds m_blocking_latency{};
+
+    bool m_selected{};
+    std::size_t m_datagrams{};
+    std::size_t m_framing_errors{};
+    std::size_t m_dropped_writes{};
+    bool m_uart_mode{};
+
+    write_hook_t m_write_hook{};
+    void* m_write_context{};
+
+    [[nodiscard]] static constexpr uint8_t address(RegAddress reg) noexcept
+    {
+        return static_cast<uint8_t>(reg);
+    }
+
+    [[nodiscard]] uint32_t reg(RegAddress reg_address) const noexcept
+    {
+        return m_registers[address(reg_address)];
+    }
+
+    static void spin(std::chrono::nanoseconds latency) noexcept
+    {
+        if (latency <= std::chrono::nanoseconds::zero())
+        {
+            return;
+        }
+
+        const auto deadline{std::chrono::steady_clock::now() + latency};
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+        }
+    }
+
+    // --- Register semantics ---
+
+    [[nodiscard]] uint32_t read(uint8_t addr) noexcept
+    {
+        if (core::Access::WO == access_of_address[addr])
+        {
+            return 0U;
+        }
+
+        const uint32_t value{live_value(addr)};
+
+        if (address(RegAddress::GSTAT) == addr)
+        {
+            m_registers[addr] = 0U;
+        }
+
+        return value;
+    }
+
+    void write(uint8_t addr, uint32_t value) noexcept
+    {
+        if (address(RegAddress::GSTAT) == addr)
+        {
+            m_registers[addr] &= ~value;
+        }
+        else if (address(RegAddress::RAMP_STAT) == addr)
+        {
+            m_ramp_events &= ~(value & ramp_event_mask);
+        }
+        else if (core::Access::RO == access_of_address[addr])
+        {
+            return;
+        }
+        else if (address(RegAddress::XACTUAL) == addr)
+        {
+            // Moving the position counter does not move the rotor: X_ENC keeps its value.
+            const uint32_t x_enc{live_value(address(RegAddress::X_ENC))};
+            m_position = static_cast<double>(static_cast<int32_t>(value));
+            m_encoder_offset = x_enc - static_cast<uint32_t>(x_actual());
+        }
+        else if (address(RegAddress::X_ENC) == addr)
+        {
+            m_encoder_offset = value - static_cast<uint32_t>(x_actual());
+        }
+        else
+        {
+            m_registers[addr] = value;
+        }
+
+        if (m_uart_mode)
+        {
+            m_registers[address(RegAddress::IFCNT)] = (m_registers[address(RegAddress::IFCNT)] + 1U) & 0xFFU;
+        }
+
+        if (nullptr != m_write_hook)
+        {
+            m_write_hook(m_write_context, addr, value);
+        }
+    }
+
+    [[nodiscard]] uint32_t live_value(uint8_t addr) const noexcept
+    {
+        switch (static_cast<RegAddress>(addr))
+        {
+            case RegAddress::XACTUAL:
+                return static_cast<uint32_t>(x_actual());
+            case RegAddress::X_ENC:
+                return static_cast<uint32_t>(x_actual()) + m_encoder_offset;
+            case RegAddress::VACTUAL:
+                return static_cast<uint32_t>(std::lround(m_velocity * velocity_scale / m_f_clk)) & vactual_mask;
+            case RegAddress::TSTEP:
+                return t_step();
+            case RegAddress::RAMP_STAT:
+                return ramp_stat();
+            case RegAddress::DRV_STATUS:
+                return drv_status();
+            default:
+                return m_registers[addr];
+        }
+    }
+
+    [[nodiscard]] int32_t x_actual() const noexcept
+    {
+        return static_cast<int32_t>(static_cast<uint32_t>(std::llround(m_position)));
+    }
+
+    [[nodiscard]] bool position_reached() const noexcept
+    {
+        return x_actual() == static_cast<int32_t>(reg(RegAddress::XTARGET));
+    }
+
+    [[nodiscard]] bool velocity_reached() const noexcept
+    {
+        return std::fabs(m_velocity) == register_velocity(RegAddress::VMAX);
+    }
+
+    [[nodiscard]] uint32_t t_step() const noexcept
+    {
+        const double speed{std::fabs(m_velocity)};
+        return (speed * static_cast<double>(tstep_max) <= m_f_clk) ? tstep_max
+                                                                    : static_cast<uint32_t>(m_f_clk / speed);
+    }
+
+    [[nodiscard]] bool stall_detected() const noexcept
+    {
+        return 0U == m_sg_result && 0.0 != m_velocity && t_step() <= reg(RegAddress::TCOOLTHRS);
+    }
+
+    [[nodiscard]] uint32_t ramp_stat() const noexcept
+    {
+        using chip::tmc5160::RAMP_STAT;
+
+        return m_ramp_events | RAMP_STAT::velocity_reached_t{velocity_reached() ? 1U : 0U}.value |
+               RAMP_STAT::position_reached_t{position_reached() ? 1U : 0U}.value |
+               RAMP_STAT::vzero_t{(0.0 == m_velocity) ? 1U : 0U}.value |
+               RAMP_STAT::status_sg_t{stall_detected() ? 1U : 0U}.value;
+    }
+
+    [[nodiscard]] uint32_t drv_status() const noexcept
+    {
+        using chip::tmc5160::DRV_STATUS;
+        using chip::tmc5160::IHOLD_IRUN;
+
+        const bool standstill{0.0 == m_velocity};
+        const uint32_t currents{reg(RegAddress::IHOLD_IRUN)};
+        const uint32_t cs_actual{standstill ? IHOLD_IRUN::i_hold_t::extract(currents)
+                                            : IHOLD_IRUN::i_run_t::extract(currents)};
+
+        return DRV_STATUS::sg_result_t{m_sg_result}.value | DRV_STATUS::cs_actual_t{cs_actual}.value |
+               DRV_STATUS::stallguard_t{stall_detected() ? 1U : 0U}.value |
+               DRV_STATUS::stst_t{standstill ? 1U : 0U}.value;
+    }
+
+    [[nodiscard]] uint8_t status_byte() const noexcept
+    {
+        const uint32_t gstat{reg(RegAddress::GSTAT)};
+
+        return static_cast<uint8_t>(((gstat & gstat_reset) != 0U ? (1U << 0U) : 0U) |
+                                    ((gstat & gstat_drv_err) != 0U ? (1U << 1U) : 0U) |
+                                    (stall_detected() ? (1U << 2U) : 0U) | ((0.0 == m_velocity) ? (1U << 3U) : 0U) |
+                                    (velocity_reached() ? (1U << 4U) : 0U) | (position_reached() ? (1U << 5U) : 0U));
+    }
+
+    // --- Ramp generator ---
+
+    [[nodiscard]] double register_velocity(RegAddress reg_address) const noexcept
+    {
+        return static_cast<double>(reg(reg_address)) * m_f_clk / velocity_scale;
+    }
+
+    [[nodiscard]] double register_acceleration(RegAddress reg_address) const noexcept
+    {
+        return static_cast<double>(reg(reg_address)) * m_f_clk * m_f_clk / acceleration_scale;
+    }
+
+    /**
+     * @brief Deceleration registers are used with a floor of 1, so a ramp always ends.
+     */
+    [[nodiscard]] double register_deceleration(RegAddress reg_address) const noexcept
+    {
+        return static_cast<double>(std::max(reg(reg_address), 1U)) * m_f_clk * m_f_clk / acceleration_scale;
+    }
+
+    [[nodiscard]] bool below_v1(double speed) const noexcept
+    {
+        return 0U != reg(RegAddress::V1) && speed < register_velocity(RegAddress::V1);
+    }
+
+    [[nodiscard]] double acceleration(double speed) const noexcept
+    {
+        return register_acceleration(below_v1(speed) ? RegAddress::A1 : RegAddress::AMAX);
+    }
+
+    [[nodiscard]] double deceleration(double speed) const noexcept
+    {
+        return register_deceleration(below_v1(speed) ? RegAddress::D1 : RegAddress::DMAX);
+    }
+
+    /**
+     * @brief Highest speed from which the DMAX/D1 ramp still ends at VSTOP within @p distance.
+     */
+    [[nodiscard]] double arrival_limit(double distance) const noexcept
+    {
+        const double v_stop{register_velocity(RegAddress::VSTOP)};
+
+        if (0U == reg(RegAddress::V1))
+        {
+            return std::sqrt((v_stop * v_stop) + (2.0 * register_deceleration(RegAddress::DMAX) * distance));
+        }
+
+        const double v_1{register_velocity(RegAddress::V1)};
+        const double d_1{register_deceleration(RegAddress::D1)};
+        const double d_1_distance{std::max(0.0, (v_1 * v_1) - (v_stop * v_stop)) / (2.0 * d_1)};
+
+        if (distance <= d_1_distance)
+        {
+            return std::sqrt((v_stop * v_stop) + (2.0 * d_1 * distance));
+        }
+
+        return std::max(v_stop,
+            std::sqrt((v_1 * v_1) + (2.0 * register_deceleration(RegAddress::DMAX) * (distance - d_1_distance))));
+    }
+
+    void integrate(double dt) noexcept
+    {
+        using chip::tmc5160::RAMPMODE;
+
+        const bool sg_stop{(reg(RegAddress::SW_MODE) & sg_stop_bit) != 0U};
+
+        if (sg_stop && (m_ramp_events & ramp_event_stop_sg) != 0U)
+        {
+            m_velocity = 0.0;
+        }
+        else
+        {
+            const double v_max{register_velocity(RegAddress::VMAX)};
+            const double a_max{register_acceleration(RegAddress::AMAX)};
+
+            switch (static_cast<RampModeType>(RAMPMODE::mode_t::extract(reg(RegAddress::RAMPMODE))))
+            {
+                case RampModeType::POSITIONING:
+                    integrate_positioning(dt, v_max);
+                    break;
+                case RampModeType::VELOCITY_POS:
+                    approach(v_max, a_max * dt);
+                    m_position += m_velocity * dt;
+                    break;
+                case RampModeType::VELOCITY_NEG:
+                    approach(-v_max, a_max * dt);
+                    m_position += m_velocity * dt;
+                    break;
+                case RampModeType::HOLD:
+                    m_position += m_velocity * dt;
+                    break;
+            }
+
+            if (sg_stop && stall_detected())
+            {
+                m_velocity = 0.0;
+                m_ramp_events |= ramp_event_stop_sg;
+            }
+        }
+
+        if (std::fabs(m_position) >= position_wrap / 2.0)
+        {
+            m_position -= std::copysign(position_wrap, m_position);
+        }
+
+        const bool reached{position_reached() && 0.0 == m_velocity};
+        if (reached && !m_was_reached)
+        {
+            m_ramp_events |= ramp_event_pos_reached;
+        }
+        m_was_reached = reached;
+    }
+
+    void approach(double target, double step) noexcept
+    {
+        m_velocity = (m_velocity < target) ? std::min(m_velocity + step, target) : std::max(m_velocity - step, target);
+    }
+
+    /**
+     * @brief One step of the six-point ramp towards XTARGET.
+     *
+     * Motion away from the target (target moved behind the axis) and VMAX = 0 ramp down to a stop first. Towards
+     * the target the axis accelerates (A1 below V1, AMAX above) up to VMAX, capped by the speed from which the
+     * DMAX/D1 ramp ends at VSTOP on the target; it stops there. A target too close to brake for is overshot and
+     * approached again from the other side.
+     */
+    void integrate_positioning(double dt, double v_max) noexcept
+    {
+        const double distance{static_cast<double>(static_cast<int32_t>(reg(RegAddress::XTARGET))) - m_position};
+
+        if (0.0 == m_velocity && (0.0 == distance || 0.0 == v_max))
+        {
+            return;
+        }
+
+        const double direction{(0.0 != m_velocity) ? std::copysign(1.0, m_velocity) : std::copysign(1.0, distance)};
+        const double v_stop{register_velocity(RegAddress::VSTOP)};
+        double speed{std::fabs(m_velocity)};
+
+        if (0.0 == speed)
+        {
+            speed = std::min(register_velocity(RegAddress::VSTART), v_max);
+        }
+
+        if (distance * direction <= 0.0 || 0.0 == v_max)
+        {
+            speed -= deceleration(speed) * dt;
+            m_velocity = (speed <= v_stop) ? 0.0 : direction * speed;
+            m_position += m_velocity * dt;
+            return;
+        }
+
+        const double remaining{std::fabs(distance)};
+        const double ramped{(speed > v_max) ? std::max(v_max, speed - (deceleration(speed) * dt))
+                                              : std::min(v_max, speed + (acceleration(speed) * dt))};
+        const double limit{std::max(arrival_limit(remaining), m_f_clk / velocity_scale)};
+
+        speed = std::max(std::min(ramped, limit), speed - (deceleration(speed) * dt));
+
+        if (speed * dt >= remaining && speed <= limit)
+        {
+            m_position += distance;
+            m_velocity = 0.0;
+            return;
+        }
+
+        m_velocity = direction * speed;
+        m_position += m_velocity * dt;
+    }
+};
+
+static_assert(core::concepts::SpiDevice<TMC5160Emulator>, "TMC5160Emulator must satisfy SpiDevice concept");
+
+} // namespace tmcxx::test
+
+#endif // TMCXX_TESTS_TMC5160_EMULATOR_HPP
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/builder/tmc_register_builder.hpp"
+#include "tmcxx/features/motion_profile.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace units::literals;
+using ::tmcxx::test::MockSpi;
+
+constexpr chip::tmc5160::Settings traverse_settings{
+    .run_current = 1.5_A,
+    .hold_current = 0.5_A,
+    .v_start = 5_rpm,
+    .v_stop = 10_rpm,
+    .v_1 = 150_rpm,
+    .v_max = 600_rpm,
+    .a_1 = 2000_pps2,
+    .a_max = 4000_pps2,
+    .d_max = 4000_pps2,
+    .d_1 = 2000_pps2,
+};
+
+constexpr chip::tmc5160::Settings precision_settings{[] {
+    auto settings{traverse_settings};
+    settings.v_max = 60_rpm;
+    settings.run_current = 0.8_A;
+    return settings;
+}()};
+
+constexpr Profile traverse{compute_profile(traverse_settings)};
+constexpr Profile precision{compute_profile(precision_settings)};
+
+static_assert(std::ranges::is_sorted(profile_registers), "Profiles follow commit() order");
+static_assert(traverse.writes.front().address == chip::tmc5160::IHOLD_IRUN::address);
+static_assert(traverse.writes.back().address == chip::tmc5160::VSTOP::address);
+static_assert(traverse != precision);
+
+class MotionProfileTest : public ::testing::Test {
+  protected:
+    MockSpi spi;
+    TMC5160<MockSpi> driver{spi, traverse_settings};
+};
+
+TEST_F(MotionProfileTest, FirstApplyWritesEveryRegister)
+{
+    ASSERT_TRUE(driver.apply_profile(traverse));
+
+    EXPECT_EQ(spi.get_transaction_count(), profile_registers.size());
+
+    for (const auto& [address, value]: traverse.writes)
+    {
+        EXPECT_EQ(spi.get_last_written_value(address), value) << "address " << static_cast<int>(address);
+    }
+}
+
+TEST_F(MotionProfileTest, MatchesApplySettings)
+{
+    ASSERT_TRUE(driver.apply_settings());
+    spi.reset();
+
+    ASSERT_TRUE(driver.apply_profile(traverse));
+
+    EXPECT_EQ(spi.get_transaction_count(), 0U) << "Profile equals the configured registers";
+}
+
+TEST_F(MotionProfileTest, SwitchSendsOnlyChangedRegisters)
+{
+    ASSERT_TRUE(driver.apply_profile(traverse));
+    spi.reset();
+
+    ASSERT_TRUE(driver.apply_profile(precision));
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 2U);
+    EXPECT_EQ(txs[0].get_address(), chip::tmc5160::IHOLD_IRUN::address);
+    EXPECT_EQ(txs[1].get_address(), chip::tmc5160::VMAX::address);
+
+    spi.reset();
+    ASSERT_TRUE(driver.apply_profile(traverse));
+    EXPECT_EQ(spi.get_transaction_count(), 2U);
+}
+
+TEST_F(MotionProfileTest, FailedWriteIsResentOnNextApply)
+{
+    ASSERT_TRUE(driver.apply_profile(traverse));
+    spi.reset();
+
+    spi.set_next_transfer_failure(true);
+    EXPECT_FALSE(driver.apply_profile(precision));
+
+    spi.reset();
+    ASSERT_TRUE(driver.apply_profile(precision));
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 2U);
+    EXPECT_EQ(txs[0].get_address(), chip::tmc5160::IHOLD_IRUN::address);
+}
+
+TEST_F(MotionProfileTest, UnstageableEntryIsReported)
+{
+    auto corrupt{traverse};
+    corrupt.writes.front() = RegisterWrite{chip::tmc5160::DRV_STATUS::address, 1U};
+
+    const auto res{driver.apply_profile(corrupt)};
+
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error(), helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+    EXPECT_EQ(spi.get_transaction_count(), traverse.writes.size() - 1U) << "Valid entries still sent";
+}
+
+TEST_F(MotionProfileTest, BuilderProfileMatchesSettings)
+{
+    const auto profile{helpers::builder::TMC5160Builder{spi, traverse_settings}
+            .v_max(60_rpm)
+            .run_current(0.8_A)
+            .build_profile()};
+
+    EXPECT_EQ(profile, precision);
+}
+
+} // namespace tmcxx::features::test
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/features/motion_queue.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace units::literals;
+using ::tmcxx::test::MockSpi;
+
+using driver_t = TMC5160<MockSpi>;
+
+constexpr uint8_t rampmode_address{0x20U};
+constexpr uint8_t xactual_address{0x21U};
+constexpr uint8_t vmax_address{0x27U};
+constexpr uint8_t xtarget_address{0x2DU};
+
+constexpr uint8_t velocity_reached{0x10U};
+constexpr uint8_t position_reached{0x20U};
+
+class MotionQueueTest : public ::testing::Test {
+  protected:
+    MockSpi spi;
+    driver_t::Settings settings{};
+    driver_t axis{spi, settings};
+};
+
+TEST_F(MotionQueueTest, FirstPollSendsSegmentInOneCommit)
+{
+    MotionQueue queue{axis};
+    ASSERT_TRUE(queue.push_move(1000_steps, 120_rpm));
+
+    const auto sent{queue.poll()};
+
+    ASSERT_TRUE(sent);
+    EXPECT_TRUE(*sent);
+    const auto& transactions{spi.get_transactions()};
+    ASSERT_EQ(transactions.size(), 3U);
+    EXPECT_EQ(transactions[0].get_address(), rampmode_address);
+    EXPECT_EQ(transactions[1].get_address(), vmax_address);
+    EXPECT_EQ(transactions[2].get_address(), xtarget_address);
+    EXPECT_EQ(transactions[2].get_write_value(), 1000U);
+    EXPECT_EQ(transactions[1].get_write_value(), axis.converter().rpm_to_vmax(120_rpm));
+    ASSERT_NE(queue.active(), nullptr);
+    EXPECT_EQ(queue.active()->target, 1000);
+}
+
+TEST_F(MotionQueueTest, WaitsForPositionReached)
+{
+    MotionQueue queue{axis};
+    ASSERT_TRUE(queue.push_move(1000_steps, 120_rpm));
+    ASSERT_TRUE(queue.push_move(2000_steps, 120_rpm));
+    ASSERT_TRUE(queue.poll());
+    spi.clear_transactions();
+
+    const auto sent{queue.poll()};
+
+    ASSERT_TRUE(sent);
+    EXPECT_FALSE(*sent);
+    EXPECT_EQ(spi.get_transaction_count(), 1U) << "One status datagram while moving";
+    EXPECT_EQ(queue.pending(), 1U);
+}
+
+TEST_F(MotionQueueTest, PositionReachedSendsNextTarget)
+{
+    MotionQueue queue{axis};
+    ASSERT_TRUE(queue.push_move(1000_steps, 120_rpm));
+    ASSERT_TRUE(queue.push_move(2000_steps, 120_rpm));
+    ASSERT_TRUE(queue.poll());
+    spi.clear_transactions();
+
+    spi.set_status_byte(position_reached);
+    const auto sent{queue.poll()};
+
+    ASSERT_TRUE(sent);
+    EXPECT_TRUE(*sent);
+    EXPECT_EQ(spi.get_last_written_value(xtarget_address), 2000U);
+    EXPECT_TRUE(spi.find_writes_to(rampmode_address).empty()) << "Unchanged ramp mode is not rewritten";
+    EXPECT_EQ(queue.completed(), 1U);
+    EXPECT_EQ(queue.pending(), 0U);
+}
+
+TEST_F(MotionQueueTest, LastSegmentCompletesToIdle)
+{
+    MotionQueue queue{axis};
+    ASSERT_TRUE(queue.push_move(1000_steps, 120_rpm));
+    ASSERT_TRUE(queue.poll());
+
+    spi.set_status_byte(position_reached);
+    const auto sent{queue.poll()};
+
+    ASSERT_TRUE(sent);
+    EXPECT_FALSE(*sent);
+    EXPECT_EQ(queue.active(), nullptr);
+    EXPECT_EQ(queue.completed(), 1U);
+}
+
+TEST_F(MotionQueueTest, BlendWindowRetargetsBeforeArrival)
+{
+    MotionQueue queue{axis, 50U};
+    ASSERT_TRUE(queue.push_move(1000_steps, 120_rpm));
+    ASSERT_TRUE(queue.push_move(3000_steps, 120_rpm));
+    ASSERT_TRUE(queue.poll());
+
+    spi.set_register_value(xactual_address, 900U);
+    auto sent{queue.poll()};
+    ASSERT_TRUE(sent);
+    EXPECT_FALSE(*sent) << "100 steps left, outside the window";
+
+    spi.set_register_value(xactual_address, 960U);
+    sent = queue.poll();
+    ASSERT_TRUE(sent);
+    EXPECT_TRUE(*sent);
+    EXPECT_EQ(spi.get_last_written_value(xtarget_address), 3000U);
+}
+
+TEST_F(MotionQueueTest, VelocitySegmentWaitsForVelocityReached)
+{
+    MotionQueue queue{axis};
+    ASSERT_TRUE(queue.push_velocity(-60_rpm));
+    ASSERT_TRUE(queue.push_move(0_steps, 120_rpm));
+    ASSERT_TRUE(queue.poll());
+
+    EXPECT_EQ(spi.get_last_written_value(rampmode_address),
+        static_cast<uint32_t>(chip::tmc5160::RampModeType::VELOCITY_NEG));
+    EXPECT_EQ(spi.get_last_written_value(vmax_address), axis.converter().rpm_to_vmax(60_rpm));
+    EXPECT_TRUE(spi.find_writes_to(xtarget_address).empty());
+
+    spi.set_status_byte(position_reached);
+    auto sent{queue.poll()};
+    ASSERT_TRUE(sent);
+    EXPECT_FALSE(*sent);
+
+    spi.set_status_byte(velocity_reached);
+    sent = queue.poll();
+    ASSERT_TRUE(sent);
+    EXPECT_TRUE(*sent);
+    EXPECT_EQ(spi.get_last_written_value(rampmode_address),
+        static_cast<uint32_t>(chip::tmc5160::RampModeType::POSITIONING));
+    EXPECT_EQ(spi.get_last_written_value(xtarget_address), 0U);
+}
+
+TEST_F(MotionQueueTest, FullQueueRejectsSegment)
+{
+    MotionQueue<driver_t, 2> queue{axis};
+
+    EXPECT_TRUE(queue.push_move(1_steps, 60_rpm));
+    EXPECT_TRUE(queue.push_move(2_steps, 60_rpm));
+    EXPECT_FALSE(queue.push_move(3_steps, 60_rpm));
+}
+
+TEST_F(MotionQueueTest, FailedDispatchIsRetried)
+{
+    MotionQueue queue{axis};
+    ASSERT_TRUE(queue.push_move(1000_steps, 120_rpm));
+
+    spi.set_next_transfer_failure(true);
+    const auto failed{queue.poll()};
+    ASSERT_FALSE(failed);
+    EXPECT_EQ(failed.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(queue.active(), nullptr);
+    EXPECT_EQ(queue.pending(), 1U);
+
+    const auto sent{queue.poll()};
+    ASSERT_TRUE(sent);
+    EXPECT_TRUE(*sent);
+    EXPECT_EQ(spi.get_last_written_value(xtarget_address), 1000U);
+}
+
+TEST_F(MotionQueueTest, StopDropsPendingSegments)
+{
+    MotionQueue queue{axis};
+    ASSERT_TRUE(queue.push_move(1000_steps, 120_rpm));
+    ASSERT_TRUE(queue.push_move(2000_steps, 120_rpm));
+    ASSERT_TRUE(queue.poll());
+
+    ASSERT_TRUE(queue.stop());
+
+    EXPECT_EQ(queue.active(), nullptr);
+    EXPECT_EQ(queue.pending(), 0U);
+    EXPECT_EQ(spi.get_last_written_value(vmax_address), 0U);
+}
+
+} // namespace tmcxx::features::test
@@ -350,6 +350,75 @@ TEST_F(MotionTest, GetActualVelocityHandles24BitSigned)
     EXPECT_GE(velocity->raw(), 0.0f);
 }
 
+TEST_F(MotionTest, MotionSnapshotKeepsSignsInRegisterUnits)
+{
+    spi.set_register_value(XACTUAL::address, static_cast<uint32_t>(-2048));
+    spi.set_register_value(VACTUAL::address, 0xFF'FC00U);
+    spi.set_register_value(RAMP_STAT::address, 0x0200U);
+
+    const auto snapshot{motion.get_motion_snapshot()};
+
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_EQ(snapshot->position, -2048);
+    EXPECT_EQ(snapshot->velocity, -1024);
+    EXPECT_TRUE(snapshot->ramp_flag<RAMP_STAT::position_reached_t>());
+    EXPECT_FALSE(snapshot->ramp_flag<RAMP_STAT::velocity_reached_t>());
+}
+
+TEST_F(MotionTest, MotionSnapshotIsOnePipelinedBurst)
+{
+    spi.set_status_byte(0x20U);
+
+    ASSERT_TRUE(motion.get_motion_snapshot());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 4U);
+    EXPECT_EQ(txs[0].get_address(), XACTUAL::address);
+    EXPECT_EQ(txs[1].get_address(), VACTUAL::address);
+    EXPECT_EQ(txs[2].get_address(), RAMP_STAT::address);
+}
+
+TEST_F(MotionTest, MotionSnapshotCarriesSpiStatus)
+{
+    spi.set_status_byte(0x20U);
+
+    const auto snapshot{motion.get_motion_snapshot()};
+
+    ASSERT_TRUE(snapshot.has_value());
+    EXPECT_TRUE(snapshot->spi_status.position_reached());
+}
+
+TEST_F(MotionTest, MotionSnapshotConvertsVelocityOnDemand)
+{
+    constexpr uint32_t forward_vmax{0x1'0000U};
+    spi.set_register_value(VACTUAL::address, (~forward_vmax + 1U) & 0xFF'FFFFU);
+
+    const auto snapshot{motion.get_motion_snapshot()};
+    ASSERT_TRUE(snapshot.has_value());
+
+    const auto rpm{snapshot->velocity_rpm(converter)};
+    EXPECT_LT(rpm.raw(), 0.0f);
+    EXPECT_FLOAT_EQ(-rpm.raw(), converter.vmax_to_rpm(forward_vmax).raw());
+}
+
+TEST_F(MotionTest, MotionSnapshotReportsFailure)
+{
+    spi.set_next_transfer_failure(true);
+
+    const auto snapshot{motion.get_motion_snapshot()};
+
+    ASSERT_FALSE(snapshot.has_value());
+    EXPECT_EQ(snapshot.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+TEST(SignExtendVactualTest, ExtendsBit23)
+{
+    static_assert(features::sign_extend_vactual(0x7F'FFFFU) == 0x7F'FFFF);
+    static_assert(features::sign_extend_vactual(0x80'0000U) == -0x80'0000);
+    static_assert(features::sign_extend_vactual(0xFF'FFFFU) == -1);
+    EXPECT_EQ(features::sign_extend_vactual(0U), 0);
+}
+
 TEST_F(MotionTest, SetStealthChopEnable)
 {
     EXPECT_TRUE(motion.set_stealth_chop(true));
@@ -0,0 +1,294 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <thread>
+#include <vector>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/features/motion_wait.hpp"
+#include "tmcxx/features/std_wait_policy.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using ::tmcxx::test::MockSpi;
+
+using driver_t = TMC5160<MockSpi>;
+
+constexpr uint8_t stallguard{0x04U};
+constexpr uint8_t standstill{0x08U};
+constexpr uint8_t velocity_reached{0x10U};
+constexpr uint8_t position_reached{0x20U};
+
+static_assert(is_satisfied(WaitCondition::POSITION_REACHED, chip::tmc5160::SpiStatus{position_reached}));
+static_assert(is_satisfied(WaitCondition::VELOCITY_REACHED, chip::tmc5160::SpiStatus{velocity_reached}));
+static_assert(is_satisfied(WaitCondition::STANDSTILL, chip::tmc5160::SpiStatus{standstill}));
+static_assert(is_satisfied(WaitCondition::STALL, chip::tmc5160::SpiStatus{stallguard}));
+static_assert(!is_satisfied(WaitCondition::POSITION_REACHED, chip::tmc5160::SpiStatus{velocity_reached}));
+
+static_assert(Backoff{}.next(100U) == 200U);
+static_assert(Backoff{.initial = 100U, .max = 300U}.next(200U) == 300U);
+
+/**
+ * @brief Manual clock: wait() advances time and may change the mock status after a number of sleeps.
+ */
+struct FakeWaitPolicy
+{
+    MockSpi* spi{};
+    uint32_t ticks{};
+    std::vector<uint32_t> sleeps{};
+    std::size_t status_after_sleeps{0U};
+    uint8_t status_byte{};
+
+    [[nodiscard]] uint32_t now() const noexcept
+    {
+        return ticks;
+    }
+
+    void wait(uint32_t duration)
+    {
+        sleeps.push_back(duration);
+        ticks += duration;
+
+        if (0U != status_after_sleeps && sleeps.size() == status_after_sleeps)
+        {
+            spi->set_status_byte(status_byte);
+        }
+    }
+};
+
+/**
+ * @brief Manual timer service: one pending callback, fired by the test.
+ */
+struct FakeTimerPolicy
+{
+    uint32_t ticks{};
+    std::vector<uint32_t> delays{};
+    wait_callback_t callback{};
+    void* context{};
+
+    [[nodiscard]] uint32_t now() const noexcept
+    {
+        return ticks;
+    }
+
+    void schedule(uint32_t delay, wait_callback_t on_timer, void* timer_context)
+    {
+        delays.push_back(delay);
+        callback = on_timer;
+        context = timer_context;
+    }
+
+    [[nodiscard]] bool fire()
+    {
+        if (nullptr == callback)
+        {
+            return false;
+        }
+
+        ticks += delays.back();
+        const auto pending{std::exchange(callback, nullptr)};
+        pending(context);
+        return true;
+    }
+};
+
+static_assert(WaitPolicy<FakeWaitPolicy>);
+static_assert(AsyncWaitPolicy<FakeTimerPolicy>);
+
+class MotionWaitTest : public ::testing::Test {
+  protected:
+    /**
+     * @brief Minimal eager coroutine used to drive the awaitables.
+     */
+    struct Task
+    {
+        struct promise_type
+        {
+            Task get_return_object() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never initial_suspend() noexcept
+            {
+                return {};
+            }
+
+            std::suspend_never final_suspend() noexcept
+            {
+                return {};
+            }
+
+            void return_void() noexcept
+            {
+            }
+
+            void unhandled_exception() noexcept
+            {
+                std::terminate();
+            }
+        };
+    };
+
+    MockSpi spi;
+    driver_t::Settings settings{};
+    driver_t axis{spi, settings};
+    FakeWaitPolicy waiter{&spi};
+};
+
+TEST_F(MotionWaitTest, SatisfiedConditionReturnsAfterOneDatagram)
+{
+    spi.set_status_byte(position_reached);
+
+    EXPECT_TRUE(axis.wait_for_position(1000U, waiter));
+
+    EXPECT_EQ(spi.get_transaction_count(), 1U);
+    EXPECT_TRUE(waiter.sleeps.empty());
+}
+
+TEST_F(MotionWaitTest, TimeoutReportsTimeoutError)
+{
+    const auto result{axis.wait_for_standstill(1000U, waiter)};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::TIMEOUT);
+    EXPECT_EQ(waiter.sleeps, (std::vector<uint32_t>{100U, 200U, 400U, 300U})) << "Doubling, clipped to the deadline";
+    EXPECT_EQ(spi.get_transaction_count(), 5U);
+}
+
+TEST_F(MotionWaitTest, BackoffIsCappedAtMax)
+{
+    const auto result{axis.wait_until(WaitCondition::STALL, 1000U, waiter, Backoff{.initial = 100U, .max = 250U})};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(waiter.sleeps, (std::vector<uint32_t>{100U, 200U, 250U, 250U, 200U}));
+}
+
+TEST_F(MotionWaitTest, ConditionMetWhileWaiting)
+{
+    waiter.status_after_sleeps = 2U;
+    waiter.status_byte = stallguard;
+
+    EXPECT_TRUE(axis.wait_for_stall(1'000'000U, waiter));
+
+    EXPECT_EQ(waiter.sleeps.size(), 2U);
+    EXPECT_EQ(spi.get_transaction_count(), 3U);
+}
+
+TEST_F(MotionWaitTest, SpiErrorEndsWait)
+{
+    spi.set_next_transfer_failure(true);
+
+    const auto result{axis.wait_for_velocity(1000U, waiter)};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+TEST_F(MotionWaitTest, ZeroTimeoutChecksOnce)
+{
+    const auto result{axis.wait_for_position(0U, waiter)};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::TIMEOUT);
+    EXPECT_EQ(spi.get_transaction_count(), 1U);
+}
+
+TEST_F(MotionWaitTest, AwaitDoesNotSuspendWhenSatisfied)
+{
+    FakeTimerPolicy timers{};
+    spi.set_status_byte(standstill);
+
+    helpers::result_t<void> result{tl::unexpected(helpers::ErrorCode::UNKNOWN_ERROR)};
+    bool finished{false};
+
+    auto task{[&]() -> Task {
+        result = co_await axis.async_wait_until(WaitCondition::STANDSTILL, 1000U, timers);
+        finished = true;
+    }};
+    task();
+
+    EXPECT_TRUE(finished);
+    EXPECT_TRUE(result);
+    EXPECT_TRUE(timers.delays.empty());
+}
+
+TEST_F(MotionWaitTest, AwaitResumesFromTimerWhenConditionHolds)
+{
+    FakeTimerPolicy timers{};
+
+    helpers::result_t<void> result{tl::unexpected(helpers::ErrorCode::UNKNOWN_ERROR)};
+    bool finished{false};
+
+    auto task{[&]() -> Task {
+        result = co_await axis.async_wait_until(WaitCondition::POSITION_REACHED, 10'000U, timers);
+        finished = true;
+    }};
+    task();
+
+    EXPECT_FALSE(finished);
+    ASSERT_TRUE(timers.fire());
+    EXPECT_FALSE(finished);
+
+    spi.set_status_byte(position_reached);
+    ASSERT_TRUE(timers.fire());
+
+    EXPECT_TRUE(finished);
+    EXPECT_TRUE(result);
+    EXPECT_EQ(timers.delays, (std::vector<uint32_t>{100U, 200U}));
+}
+
+TEST_F(MotionWaitTest, AwaitTimesOut)
+{
+    FakeTimerPolicy timers{};
+
+    helpers::result_t<void> result{};
+    bool finished{false};
+
+    auto task{[&]() -> Task {
+        result = co_await axis.async_wait_until(WaitCondition::VELOCITY_REACHED, 500U, timers);
+        finished = true;
+    }};
+    task();
+
+    while (!finished && timers.fire())
+    {
+    }
+
+    EXPECT_TRUE(finished);
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::TIMEOUT);
+    EXPECT_EQ(timers.delays, (std::vector<uint32_t>{100U, 200U, 200U}));
+}
+
+TEST(StdWaitPolicyTest, NotifyWakesWaitEarly)
+{
+    StdWaitPolicy policy{};
+
+    std::thread diag{[&policy] {
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+        policy.notify();
+    }};
+
+    const auto start{std::chrono::steady_clock::now()};
+    policy.wait(10'000'000U);
+    const auto waited{std::chrono::steady_clock::now() - start};
+    diag.join();
+
+    EXPECT_LT(waited, std::chrono::seconds{5});
+}
+
+TEST(StdWaitPolicyTest, WaitSleepsForTicks)
+{
+    StdWaitPolicy policy{};
+
+    const uint32_t start{policy.now()};
+    policy.wait(2'000U);
+
+    EXPECT_GE(policy.now() - start, 2'000U);
+}
+
+} // namespace tmcxx::features::test
@@ -0,0 +1,238 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <iterator>
+#include <vector>
+
+#include "mocks/recording_spi.hpp"
+#include "mocks/tmc5160_emulator.hpp"
+#include "tmcxx/builder/tmc_register_builder.hpp"
+#include "tmcxx/features/persistent_image.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace units::literals;
+using ::tmcxx::test::RecordingBatchSpi;
+using ::tmcxx::test::RecordingSpi;
+using ::tmcxx::test::TMC5160Emulator;
+
+namespace regs = chip::tmc5160;
+
+constexpr regs::Settings motor_settings{
+    .run_current = 1.2_A,
+    .hold_current = 0.4_A,
+    .hold_delay = 6U,
+    .power_down_delay = 10U,
+    .v_stop = 10_rpm,
+    .v_1 = 100_rpm,
+    .v_max = 300_rpm,
+    .a_1 = 1000_pps2,
+    .a_max = 2000_pps2,
+    .d_max = 2000_pps2,
+    .d_1 = 1000_pps2,
+    .toff = 3U,
+    .hstrt = 4U,
+    .hend = -2,
+    .tbl = 2U,
+};
+
+constexpr auto motor_image{make_register_image<motor_settings>()};
+constexpr auto motor_blob{encode_register_image(motor_image)};
+
+/**
+ * @brief motor_image without XACTUAL and XTARGET, the entries a persistent image keeps.
+ */
+std::vector<RegisterWrite> restorable_entries()
+{
+    std::vector<RegisterWrite> entries{};
+    std::ranges::copy_if(motor_image, std::back_inserter(entries),
+        [](const RegisterWrite& write) { return regs::ShadowLayout::is_restorable(write.address); });
+    return entries;
+}
+
+constexpr std::array<uint8_t, 9> check_string{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+static_assert(image_format::crc32(check_string) == 0xCBF43926U, "CRC-32/IEEE check value");
+static_assert(motor_blob.size() == image_format::image_size(settings_register_count));
+static_assert(RegisterImageView::parse(motor_blob).has_value(), "Images are validated at compile time too");
+static_assert(RegisterImageView::parse(motor_blob).value().size() == motor_image.size() - 2U, "No XACTUAL, XTARGET");
+
+std::vector<uint8_t> corrupted(std::size_t offset, uint8_t value)
+{
+    std::vector<uint8_t> bytes{motor_blob.begin(), motor_blob.end()};
+    bytes[offset] = value;
+    return bytes;
+}
+
+TEST(PersistentImageTest, ViewDecodesEntriesInPlace)
+{
+    const auto view{RegisterImageView::parse(motor_blob)};
+
+    ASSERT_TRUE(view);
+    const auto expected{restorable_entries()};
+    std::size_t idx{};
+    for (const auto write: *view)
+    {
+        EXPECT_EQ(write, expected[idx++]);
+    }
+    EXPECT_EQ(idx, expected.size());
+}
+
+TEST(PersistentImageTest, CorruptImagesAreRejected)
+{
+    EXPECT_EQ(RegisterImageView::parse(corrupted(0U, 'X')).error(), helpers::ErrorCode::INVALID_PARAMETER);
+    EXPECT_EQ(RegisterImageView::parse(corrupted(image_format::version_offset, 2U)).error(),
+        helpers::ErrorCode::NOT_IMPLEMENTED);
+    constexpr std::size_t used{image_format::image_size(RegisterImageView::parse(motor_blob).value().size())};
+
+    EXPECT_EQ(RegisterImageView::parse(corrupted(used - 1U, motor_blob[used - 1U] ^ 0x01U)).error(),
+        helpers::ErrorCode::INVALID_PARAMETER)
+        << "Flipped bit in the last register word";
+    EXPECT_EQ(RegisterImageView::parse(std::span{motor_blob}.first(used - 1U)).error(),
+        helpers::ErrorCode::INVALID_PARAMETER)
+        << "Truncated";
+    EXPECT_FALSE(RegisterImageView::parse(std::span<const uint8_t>{}));
+}
+
+TEST(PersistentImageTest, TrailingPaddingIsIgnored)
+{
+    std::vector<uint8_t> page(256U, 0xFFU);
+    std::ranges::copy(motor_blob, page.begin());
+
+    const auto view{RegisterImageView::parse(page)};
+
+    ASSERT_TRUE(view);
+    EXPECT_EQ(view->size(), restorable_entries().size());
+}
+
+TEST(PersistentImageTest, WriterValidatesEntries)
+{
+    std::array<uint8_t, 64> out{};
+    const std::array<RegisterWrite, 2> unsorted{{{regs::VMAX::address, 1U}, {regs::AMAX::address, 2U}}};
+    const std::array<RegisterWrite, 1> read_only{{{regs::DRV_STATUS::address, 1U}}};
+
+    EXPECT_EQ(write_register_image(unsorted, out).error(), helpers::ErrorCode::INVALID_PARAMETER);
+    EXPECT_EQ(write_register_image(read_only, out).error(), helpers::ErrorCode::REGISTER_ACCESS_FAILED);
+    EXPECT_EQ(write_register_image(motor_image, out).error(), helpers::ErrorCode::INVALID_PARAMETER) << "Too small";
+}
+
+/**
+ * @brief Well-formed one-entry image, bypassing the writer's address check.
+ */
+std::array<uint8_t, image_format::image_size(1U)> forged(uint8_t address, uint32_t value)
+{
+    std::array<uint8_t, image_format::image_size(1U)> image{'T', 'M', 'C', 'I', image_format::version, 0U, 0U, 1U};
+    image[image_format::header_size] = address;
+    image_format::store_be32(std::span{image}.subspan(image_format::header_size + 1U), value);
+    image_format::store_be32(std::span{image}.subspan(image_format::crc_offset), image_format::image_crc(image));
+    return image;
+}
+
+TEST(PersistentImageTest, OnlyRestorableRegistersAreAccepted)
+{
+    std::array<uint8_t, 64> out{};
+
+    for (const uint8_t address: {regs::XTARGET::address, regs::XACTUAL::address, regs::RAMP_STAT::address})
+    {
+        const std::array<RegisterWrite, 1> write{{{address, 1000U}}};
+
+        EXPECT_EQ(write_register_image(write, out).error(), helpers::ErrorCode::REGISTER_ACCESS_FAILED) << +address;
+        EXPECT_EQ(RegisterImageView::parse(forged(address, 1000U)).error(), helpers::ErrorCode::REGISTER_ACCESS_FAILED)
+            << +address;
+    }
+
+    EXPECT_TRUE(RegisterImageView::parse(forged(regs::VMAX::address, 1000U))) << "Forged image is well-formed";
+}
+
+TEST(PersistentImageTest, ApplyIsOneBurstAndPrimesShadow)
+{
+    RecordingBatchSpi<> spi;
+    TMC5160<RecordingBatchSpi<>> motor{spi, motor_settings};
+
+    ASSERT_TRUE(motor.apply_image(*RegisterImageView::parse(motor_blob)));
+
+    const auto expected{restorable_entries()};
+    EXPECT_EQ(spi.get_batch_count(), 1U);
+    EXPECT_EQ(spi.get_datagram_count(), expected.size());
+    for (const auto& [address, value]: expected)
+    {
+        EXPECT_EQ(spi.get_last_written_value(address), value) << static_cast<int>(address);
+    }
+
+    spi.clear_transactions();
+    ASSERT_TRUE(motor.apply_profile(compute_profile(motor_settings)));
+    EXPECT_EQ(spi.get_datagram_count(), 0U) << "Shadow already holds the profile";
+}
+
+TEST(PersistentImageTest, MatchesApplySettingsConfiguration)
+{
+    RecordingSpi<> reference_spi;
+    RecordingSpi<> image_spi;
+    TMC5160<RecordingSpi<>> reference{reference_spi, motor_settings};
+    TMC5160<RecordingSpi<>> motor{image_spi, motor_settings};
+
+    ASSERT_TRUE(reference.apply_settings());
+    ASSERT_TRUE(motor.apply_image(*RegisterImageView::parse(motor_blob)));
+
+    std::size_t image_idx{};
+    for (std::size_t idx{}; idx < reference_spi.get_record_count(); ++idx)
+    {
+        const auto& bytes{reference_spi.get_record(idx).bytes};
+        if (!regs::ShadowLayout::is_restorable(static_cast<uint8_t>(bytes[0] & 0x7FU)))
+        {
+            continue; // XACTUAL, XTARGET
+        }
+
+        ASSERT_LT(image_idx, image_spi.get_record_count());
+        EXPECT_EQ(image_spi.get_record(image_idx++).bytes, bytes) << idx;
+    }
+    EXPECT_EQ(image_idx, image_spi.get_record_count());
+    EXPECT_EQ(image_spi.get_datagram_count(), reference_spi.get_datagram_count() - 2U);
+}
+
+TEST(PersistentImageTest, ShadowDumpRecreatesConfiguration)
+{
+    TMC5160Emulator source_chip;
+    TMC5160<TMC5160Emulator> source{source_chip, motor_settings};
+    ASSERT_TRUE(source.apply_settings());
+    ASSERT_TRUE(source.set_irun(0.8_A));
+
+    std::array<uint8_t, image_format::image_size(image_format::max_entries)> blob{};
+    const auto size{source.dump_image(blob)};
+    ASSERT_TRUE(size);
+
+    const auto view{RegisterImageView::parse(std::span{blob}.first(*size))};
+    ASSERT_TRUE(view);
+
+    TMC5160Emulator target_chip;
+    TMC5160<TMC5160Emulator> target{target_chip, motor_settings};
+    ASSERT_TRUE(target.apply_image(*view));
+
+    for (const auto [address, value]: *view)
+    {
+        EXPECT_EQ(target_chip.peek(static_cast<regs::RegAddress>(address)),
+            source_chip.peek(static_cast<regs::RegAddress>(address)))
+            << static_cast<int>(address);
+    }
+
+    std::array<uint8_t, image_format::image_size(image_format::max_entries)> round_trip{};
+    EXPECT_EQ(target.dump_image(round_trip), size);
+    EXPECT_EQ(round_trip, blob) << "Applying primed the target's shadow with the same configuration";
+}
+
+TEST(PersistentImageTest, BuilderImageMatchesRegisterImage)
+{
+    RecordingSpi<> spi;
+    const auto blob{helpers::builder::TMC5160Builder{spi, motor_settings}.build_image()};
+
+    EXPECT_EQ(blob, motor_blob);
+
+    std::array<uint8_t, 8> too_small{};
+    TMC5160<RecordingSpi<>> motor{spi, motor_settings};
+    ASSERT_TRUE(motor.apply_settings());
+    EXPECT_EQ(motor.dump_image(too_small).error(), helpers::ErrorCode::INVALID_PARAMETER);
+}
+
+} // namespace tmcxx::features::test
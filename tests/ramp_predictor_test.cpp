@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+
+#include "mocks/tmc5160_emulator.hpp"
+#include "tmcxx/features/motion_profile.hpp"
+#include "tmcxx/features/ramp_predictor.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::test {
+
+using namespace units::literals;
+
+namespace regs = chip::tmc5160;
+using features::predict_move;
+using features::RampRegisters;
+
+constexpr features::Converter converter{12.0_MHz, 200_steps, 75.0_mOhm};
+
+// VMAX 51200 microsteps/s, AMAX/DMAX 2^41 / 12e6^2 * 512 = 7820 -> 512'000 microsteps/s^2 (rounded down).
+constexpr RampRegisters trapezoid{.a_max = 7'820U, .v_max = 71'582U, .d_max = 7'820U};
+
+constexpr double vmax_pps{71'582.0 * 12'000'000.0 / 16'777'216.0};
+constexpr double amax_pps2{7'820.0 * 12'000'000.0 * 12'000'000.0 / 2'199'023'255'552.0};
+
+static_assert(predict_move(trapezoid, converter, 0_steps).duration().raw() == 0.0F);
+static_assert(predict_move(RampRegisters{}, converter, 1000_steps).phases().empty(), "VMAX 0 never moves");
+static_assert(predict_move(trapezoid, converter, 204'800_steps).reaches_vmax());
+static_assert(!predict_move(trapezoid, converter, 1'000_steps).reaches_vmax());
+static_assert(predict_move(trapezoid, converter, 204'800_steps).phases().size() == 3U);
+static_assert(predict_move(trapezoid, converter, -204'800_steps).position_at(10_s) == -204'800_steps);
+
+TEST(RampPredictorTest, ConverterInvertsRegisterScaling)
+{
+    EXPECT_NEAR(converter.vmax_to_pps(71'582U).raw(), vmax_pps, 0.01);
+    EXPECT_NEAR(converter.register_to_accel(7'820U).raw(), amax_pps2, 1.0);
+    EXPECT_EQ(converter.accel_to_register(converter.register_to_accel(7'820U)), 7'820U);
+}
+
+TEST(RampPredictorTest, TrapezoidDurationAndPeak)
+{
+    constexpr auto move{predict_move(trapezoid, converter, 204'800_steps)};
+
+    EXPECT_NEAR(move.duration().raw(), (204'800.0 / vmax_pps) + (vmax_pps / amax_pps2), 1e-4);
+    EXPECT_NEAR(move.peak_velocity().raw(), vmax_pps, 0.01);
+    EXPECT_EQ(move.distance(), 204'800_steps);
+    EXPECT_EQ(move.position_at(move.duration()), 204'800_steps);
+    EXPECT_NEAR(move.velocity_at(1_s).raw(), vmax_pps, 0.01);
+}
+
+TEST(RampPredictorTest, ShortMovePeaksBelowVmax)
+{
+    constexpr auto move{predict_move(trapezoid, converter, 1'000_steps)};
+
+    EXPECT_NEAR(move.peak_velocity().raw(), std::sqrt(amax_pps2 * 1'000.0), 1.0);
+    EXPECT_NEAR(move.duration().raw(), 2.0 * std::sqrt(1'000.0 / amax_pps2), 1e-5);
+    EXPECT_EQ(move.phases().size(), 2U);
+}
+
+TEST(RampPredictorTest, NegativeDistanceMirrorsPositive)
+{
+    constexpr auto forward{predict_move(trapezoid, converter, 50'000_steps)};
+    constexpr auto backward{predict_move(trapezoid, converter, -50'000_steps)};
+
+    EXPECT_EQ(forward.duration(), backward.duration());
+    EXPECT_EQ(backward.position_at(50_ms), -forward.position_at(50_ms));
+    EXPECT_EQ(backward.velocity_at(50_ms), -forward.velocity_at(50_ms));
+    EXPECT_EQ(backward.time_at(-25'000_steps), forward.time_at(25'000_steps));
+}
+
+TEST(RampPredictorTest, TimeAtInvertsPositionAt)
+{
+    constexpr RampRegisters six_point{
+        .v_start = 100U, .a_1 = 2'000U, .v_1 = 20'000U, .a_max = 7'820U, .v_max = 71'582U, .d_max = 7'820U,
+        .d_1 = 2'000U, .v_stop = 200U};
+    constexpr auto move{predict_move(six_point, converter, 300'000_steps)};
+
+    ASSERT_EQ(move.phases().size(), 5U);
+    for (int32_t steps{1'000}; steps < 300'000; steps += 29'000)
+    {
+        const auto time{move.time_at(units::microsteps_t{steps})};
+        EXPECT_NEAR(move.position_at(time).raw(), steps, 1) << steps;
+    }
+    EXPECT_EQ(move.time_at(400'000_steps), move.duration()) << "Clamped to the move";
+}
+
+TEST(RampPredictorTest, TargetInsideBrakingDistanceBrakesFromVstart)
+{
+    constexpr RampRegisters fast_start{.v_start = 30'000U, .a_max = 100U, .v_max = 71'582U, .d_max = 100U};
+    constexpr auto move{predict_move(fast_start, converter, 100_steps)};
+
+    ASSERT_EQ(move.phases().size(), 1U);
+    EXPECT_NEAR(move.peak_velocity().raw(), converter.vmax_to_pps(30'000U).raw(), 0.01);
+    EXPECT_LT(move.phases()[0].acceleration, 0.0);
+    EXPECT_EQ(move.position_at(move.duration()), 100_steps);
+}
+
+TEST(RampPredictorTest, ProfileRegistersMatchSettings)
+{
+    constexpr regs::Settings settings{.v_max = 300_rpm, .a_max = 512000_pps2, .d_max = 512000_pps2};
+    constexpr auto ramp{RampRegisters::from_profile(features::compute_profile(settings))};
+
+    EXPECT_EQ(ramp.v_max, converter.rpm_to_vmax(300_rpm));
+    EXPECT_EQ(ramp.a_max, converter.accel_to_register(512000_pps2));
+    EXPECT_EQ(ramp.d_max, ramp.a_max);
+}
+
+TEST(RampPredictorTest, DriverPredictionMatchesEmulatedMove)
+{
+    constexpr regs::Settings settings{
+        .v_stop = 1_rpm,
+        .v_1 = 100_rpm,
+        .v_max = 300_rpm,
+        .a_1 = 128000_pps2,
+        .a_max = 512000_pps2,
+        .d_max = 512000_pps2,
+        .d_1 = 128000_pps2,
+    };
+
+    TMC5160Emulator chip;
+    TMC5160<TMC5160Emulator> axis{chip, settings};
+    ASSERT_TRUE(axis.apply_settings());
+
+    int32_t position{};
+    for (const int32_t distance: {400'000, 5'000, -120'000})
+    {
+        const int32_t target{position + distance};
+        const auto start{chip.now()};
+
+        axis.begin_transaction();
+        (void)axis.write_register<regs::RAMPMODE>(static_cast<uint32_t>(regs::RampModeType::POSITIONING));
+        (void)axis.write_register<regs::XTARGET>(static_cast<uint32_t>(target));
+        ASSERT_TRUE(axis.commit());
+
+        const auto move{axis.predict_move(units::microsteps_t{distance})};
+        const auto half{move.duration() / 2.0F};
+        chip.advance(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::duration<float>{half.raw()}));
+        EXPECT_NEAR(chip.position() - position, move.position_at(half).raw(), std::abs(distance) / 100.0);
+
+        while (chip.velocity() != 0.0 || chip.position() != target)
+        {
+            chip.advance(std::chrono::microseconds{100});
+        }
+
+        const double elapsed{std::chrono::duration<double>{chip.now() - start}.count()};
+        EXPECT_NEAR(elapsed, move.duration().raw(), 0.005) << distance;
+        position = target;
+    }
+}
+
+} // namespace tmcxx::test
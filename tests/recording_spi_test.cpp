@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include "mocks/recording_spi.hpp"
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/detail/tmc5160_bus.hpp"
+#include "tmcxx/features/daisy_chain.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::test {
+
+using namespace chip::tmc5160;
+
+TEST(RecordingSpiTest, RepliesLikeMockSpi)
+{
+    RecordingSpi<> spi;
+    TMC5160<RecordingSpi<>> driver{spi, {}};
+    spi.set_register_value(XACTUAL::address, static_cast<uint32_t>(-42));
+    spi.set_status_byte(0x20U);
+
+    const auto position{driver.get_actual_motor_position()};
+
+    ASSERT_TRUE(position);
+    EXPECT_EQ(*position, -42);
+    EXPECT_TRUE(driver.last_status().position_reached());
+    EXPECT_EQ(spi.get_datagram_count(), 2U);
+    EXPECT_EQ(spi.get_read_count(XACTUAL::address), 1U);
+    EXPECT_EQ(spi.get_select_count(), spi.get_deselect_count());
+}
+
+TEST(RecordingSpiTest, RingKeepsNewestRecords)
+{
+    RecordingSpi<8U> spi;
+    detail::TMC5160Bus<RecordingSpi<8U>> bus{spi};
+
+    for (uint32_t value{1U}; value <= 20U; ++value)
+    {
+        ASSERT_TRUE(bus.write<VMAX>(value));
+    }
+
+    EXPECT_EQ(spi.get_datagram_count(), 20U);
+    EXPECT_EQ(spi.get_record_count(), 8U);
+    EXPECT_EQ(spi.get_record(0).get_write_value(), 13U);
+    EXPECT_EQ(spi.get_last_record().get_write_value(), 20U);
+    EXPECT_TRUE(spi.get_last_record().is_write_operation());
+    EXPECT_EQ(spi.get_last_record().get_address(), VMAX::address);
+}
+
+TEST(RecordingSpiTest, LastWriteOutlivesTheRing)
+{
+    RecordingSpi<4U> spi;
+    detail::TMC5160Bus<RecordingSpi<4U>> bus{spi};
+
+    ASSERT_TRUE(bus.write<AMAX>(500U));
+    for (uint32_t value{}; value < 10U; ++value)
+    {
+        ASSERT_TRUE(bus.write<VMAX>(value));
+    }
+
+    EXPECT_EQ(spi.get_last_written_value(AMAX::address), 500U);
+    EXPECT_EQ(spi.get_last_written_value(VMAX::address), 9U);
+    EXPECT_EQ(spi.get_write_count(VMAX::address), 10U);
+    EXPECT_FALSE(spi.get_last_written_value(DMAX::address).has_value());
+}
+
+TEST(RecordingSpiTest, FailedTransferIsNotRecorded)
+{
+    RecordingSpi<> spi;
+    detail::TMC5160Bus<RecordingSpi<>> bus{spi};
+    spi.set_transfer_failure_after(1U);
+
+    EXPECT_TRUE(bus.write<VMAX>(1U));
+    EXPECT_FALSE(bus.write<VMAX>(2U));
+
+    EXPECT_EQ(spi.get_datagram_count(), 1U);
+    EXPECT_EQ(spi.get_last_written_value(VMAX::address), 1U);
+}
+
+TEST(RecordingSpiTest, ClearKeepsRegisterValues)
+{
+    RecordingSpi<> spi;
+    detail::TMC5160Bus<RecordingSpi<>> bus{spi};
+    spi.set_register_value(XACTUAL::address, 7U);
+    ASSERT_TRUE(bus.write<VMAX>(1U));
+
+    spi.clear_transactions();
+
+    EXPECT_EQ(spi.get_datagram_count(), 0U);
+    EXPECT_EQ(spi.get_write_count(VMAX::address), 0U);
+    EXPECT_EQ(bus.read<XACTUAL>().value(), 7U);
+}
+
+TEST(RecordingSpiSoakTest, PipelinedBursts)
+{
+    constexpr std::size_t bursts{100'000U};
+
+    RecordingSpi<> spi;
+    TMC5160<RecordingSpi<>> driver{spi, {}};
+    spi.set_register_value(XACTUAL::address, 1U);
+    spi.set_register_value(VACTUAL::address, 2U);
+    spi.set_register_value(DRV_STATUS::address, 3U);
+
+    for (std::size_t idx{}; idx < bursts; ++idx)
+    {
+        const auto values{driver.read_registers<XACTUAL, VACTUAL, DRV_STATUS>()};
+        ASSERT_TRUE(values);
+        ASSERT_EQ(*values, (std::array<uint32_t, 3>{1U, 2U, 3U}));
+    }
+
+    EXPECT_EQ(spi.get_datagram_count(), bursts * 4U);
+    EXPECT_EQ(spi.get_read_count(XACTUAL::address), bursts);
+    EXPECT_EQ(spi.get_read_count(DRV_STATUS::address), bursts);
+}
+
+TEST(RecordingSpiSoakTest, BatchedBursts)
+{
+    constexpr std::size_t bursts{50'000U};
+
+    RecordingBatchSpi<> spi;
+    TMC5160<RecordingBatchSpi<>> driver{spi, {}};
+
+    for (std::size_t idx{}; idx < bursts; ++idx)
+    {
+        ASSERT_TRUE((driver.read_registers<XACTUAL, RAMP_STAT, DRV_STATUS>()));
+    }
+
+    EXPECT_EQ(spi.get_batch_count(), bursts);
+    EXPECT_EQ(spi.get_transfer_count(), bursts * 4U);
+}
+
+TEST(RecordingSpiSoakTest, DaisyChainFrames)
+{
+    constexpr uint32_t frames{50'000U};
+
+    using chain_t = features::DaisyChain<RecordingSpi<>, 3>;
+    using chain_bus_t = detail::TMC5160Bus<chain_t::Channel>;
+
+    RecordingSpi<> spi;
+    chain_t chain{spi};
+    chain_bus_t bus0{chain.channel(0)};
+    chain_bus_t bus1{chain.channel(1)};
+    chain_bus_t bus2{chain.channel(2)};
+
+    for (uint32_t idx{1U}; idx <= frames; ++idx)
+    {
+        chain.begin_frame();
+        ASSERT_TRUE(bus0.write<XTARGET>(idx));
+        ASSERT_TRUE(bus1.write<XTARGET>(idx * 2U));
+        ASSERT_TRUE(bus2.write<XTARGET>(idx * 3U));
+        ASSERT_TRUE(chain.end_frame());
+    }
+
+    EXPECT_EQ(spi.get_transfer_count(), frames);
+    EXPECT_EQ(spi.get_write_count(XTARGET::address), frames * 3U);
+    EXPECT_EQ(spi.get_record(spi.get_record_count() - 3U).get_write_value(), frames * 3U) << "Chip 2 first";
+    EXPECT_EQ(spi.get_last_record().get_write_value(), frames) << "Chip 0 last";
+
+    spi.set_register_value(XACTUAL::address, 0xABCDU);
+    EXPECT_EQ(bus1.read<XACTUAL>().value(), 0xABCDU) << "Every chain position answers its own request";
+}
+
+} // namespace tmcxx::test
@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+
+#include "mocks/mock_spi.hpp"
+#include "mocks/recording_spi.hpp"
+#include "tmcxx/features/register_image.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace units::literals;
+using ::tmcxx::test::MockSpi;
+using ::tmcxx::test::RecordingBatchSpi;
+
+constexpr chip::tmc5160::Settings motor_settings{
+    .run_current = 1.2_A,
+    .hold_current = 0.4_A,
+    .hold_delay = 6U,
+    .power_down_delay = 10U,
+    .v_start = 5_rpm,
+    .v_stop = 10_rpm,
+    .v_1 = 100_rpm,
+    .v_max = 300_rpm,
+    .a_1 = 1000_pps2,
+    .a_max = 2000_pps2,
+    .d_max = 2000_pps2,
+    .d_1 = 1000_pps2,
+    .stealth_chop_enabled = true,
+    .toff = 3U,
+    .hstrt = 4U,
+    .hend = -2,
+    .tbl = 2U,
+};
+
+constexpr auto motor_image{make_register_image<motor_settings>()};
+
+static_assert(motor_image.front().address == chip::tmc5160::IHOLD_IRUN::address);
+static_assert(motor_image.back().address == chip::tmc5160::XACTUAL::address, "Position registers last");
+static_assert(motor_image[1].value == 10U, "TPOWERDOWN is copied verbatim");
+
+class RegisterImageTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        spi.reset();
+    }
+
+    MockSpi spi;
+};
+
+TEST_F(RegisterImageTest, MatchesRuntimeApplySettings)
+{
+    TMC5160 driver{spi, motor_settings};
+
+    ASSERT_TRUE(driver.apply_settings());
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), motor_image.size());
+
+    for (std::size_t idx{}; idx < txs.size(); ++idx)
+    {
+        EXPECT_TRUE(txs[idx].is_write_operation());
+        EXPECT_EQ(txs[idx].get_address(), motor_image[idx].address) << "entry " << idx;
+        EXPECT_EQ(txs[idx].get_write_value(), motor_image[idx].value) << "entry " << idx;
+    }
+}
+
+TEST_F(RegisterImageTest, ApplyRegisterImageStreamsTable)
+{
+    TMC5160 driver{spi, motor_settings};
+
+    ASSERT_TRUE(driver.apply_register_image(motor_image));
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), motor_image.size());
+
+    for (std::size_t idx{}; idx < txs.size(); ++idx)
+    {
+        EXPECT_EQ(txs[idx].get_address(), motor_image[idx].address);
+        EXPECT_EQ(txs[idx].get_write_value(), motor_image[idx].value);
+    }
+}
+
+TEST_F(RegisterImageTest, ApplyRegisterImageIsOneCommit)
+{
+    RecordingBatchSpi<> batch_spi;
+    TMC5160 driver{batch_spi, motor_settings};
+
+    ASSERT_TRUE(driver.apply_register_image(motor_image));
+
+    EXPECT_EQ(batch_spi.get_batch_count(), 1U) << "Configuration commit; XTARGET and XACTUAL follow unbatched";
+    EXPECT_EQ(batch_spi.get_datagram_count(), motor_image.size());
+}
+
+TEST_F(RegisterImageTest, ApplyRegisterImageUpdatesShadow)
+{
+    TMC5160 driver{spi, motor_settings};
+
+    ASSERT_TRUE(driver.apply_register_image(motor_image));
+
+    const auto chopconf{driver.get_register_value(chip::tmc5160::RegAddress::CHOPCONF)};
+    ASSERT_TRUE(chopconf);
+    EXPECT_EQ(*chopconf, motor_image[motor_image.size() - 3U].value);
+}
+
+TEST_F(RegisterImageTest, ApplyRegisterImageStopsAtFirstFailure)
+{
+    TMC5160 driver{spi, motor_settings};
+    spi.set_next_transfer_failure(true);
+
+    const auto result{driver.apply_register_image(motor_image)};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+}
+
+TEST_F(RegisterImageTest, ZeroSettingsKeepMotionClamps)
+{
+    constexpr auto image{make_register_image<chip::tmc5160::Settings{}>()};
+
+    const auto value_of{[&image](uint8_t address) {
+        for (const auto& entry: image)
+        {
+            if (entry.address == address)
+            {
+                return entry.value;
+            }
+        }
+        return uint32_t{0xFFFF'FFFFU};
+    }};
+
+    EXPECT_EQ(value_of(chip::tmc5160::VSTOP::address), 1U);
+    EXPECT_EQ(value_of(chip::tmc5160::D1::address), 1U);
+    EXPECT_EQ(value_of(chip::tmc5160::VMAX::address), 0U);
+}
+
+} // namespace tmcxx::features::test
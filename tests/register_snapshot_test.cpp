@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/features/register_snapshot.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using ::tmcxx::test::MockSpi;
+using chip::tmc5160::RegAddress;
+
+constexpr RegisterMask motion_mask{RegAddress::XACTUAL, RegAddress::VACTUAL, RegAddress::VMAX};
+
+static_assert(motion_mask.count() == 3U);
+static_assert(motion_mask.test(static_cast<uint8_t>(RegAddress::VACTUAL)));
+static_assert(!motion_mask.test(static_cast<uint8_t>(RegAddress::GCONF)));
+
+class RegisterSnapshotTest : public ::testing::Test {
+  protected:
+    void SetUp() override
+    {
+        spi.reset();
+        spi.set_register_value(chip::tmc5160::GSTAT::address, 0x01U);
+        spi.set_register_value(chip::tmc5160::XACTUAL::address, 1000U);
+        spi.set_register_value(chip::tmc5160::VACTUAL::address, 2000U);
+        spi.set_register_value(chip::tmc5160::DRV_STATUS::address, 0x8000'0000U);
+    }
+
+    MockSpi spi;
+    TMC5160<MockSpi>::Settings settings{};
+    TMC5160<MockSpi> driver{spi, settings};
+};
+
+TEST_F(RegisterSnapshotTest, ValuesAreIndexedByAddress)
+{
+    const auto snap{driver.snapshot()};
+
+    ASSERT_TRUE(snap.complete());
+    EXPECT_EQ(snap.values[chip::tmc5160::XACTUAL::address], 1000U);
+    EXPECT_EQ(snap.values[chip::tmc5160::VACTUAL::address], 2000U);
+    EXPECT_EQ(snap.get(RegAddress::DRV_STATUS).value(), 0x8000'0000U);
+    EXPECT_EQ(snap.get(RegAddress::GSTAT).value(), 0x01U);
+}
+
+TEST_F(RegisterSnapshotTest, HardwareRegistersShareOneBurst)
+{
+    ASSERT_TRUE(driver.snapshot().complete());
+
+    EXPECT_EQ(spi.get_transaction_count(), 6U) << "GSTAT, XACTUAL, VACTUAL, RAMP_STAT, DRV_STATUS + trailer";
+
+    for (const auto& tx: spi.get_transactions())
+    {
+        EXPECT_FALSE(tx.is_write_operation());
+    }
+}
+
+TEST_F(RegisterSnapshotTest, ShadowRegistersCostNoTraffic)
+{
+    ASSERT_TRUE(driver.set_register_value(RegAddress::VMAX, 4321U));
+    spi.clear_transactions();
+
+    const auto snap{driver.snapshot<RegisterMask{RegAddress::VMAX, RegAddress::CHOPCONF}>()};
+
+    ASSERT_TRUE(snap.complete());
+    EXPECT_EQ(snap.get(RegAddress::VMAX).value(), 4321U);
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+}
+
+TEST_F(RegisterSnapshotTest, CompileTimeMaskReadsOnlySelection)
+{
+    const auto snap{driver.snapshot<motion_mask>()};
+
+    ASSERT_TRUE(snap.status());
+    EXPECT_EQ(snap.get(RegAddress::XACTUAL).value(), 1000U);
+    EXPECT_EQ(snap.get(RegAddress::VACTUAL).value(), 2000U);
+    EXPECT_EQ(spi.get_transaction_count(), 3U);
+}
+
+TEST_F(RegisterSnapshotTest, RuntimeMaskMatchesCompileTimeMask)
+{
+    const auto compile_time{driver.snapshot<motion_mask>()};
+    const auto runtime{driver.snapshot(motion_mask)};
+
+    EXPECT_EQ(runtime.values, compile_time.values);
+    EXPECT_EQ(runtime.errors, compile_time.errors);
+}
+
+TEST_F(RegisterSnapshotTest, UnrequestedRegisterIsInvalid)
+{
+    const auto snap{driver.snapshot<motion_mask>()};
+
+    const auto gconf{snap.get(RegAddress::GCONF)};
+    ASSERT_FALSE(gconf);
+    EXPECT_EQ(gconf.error(), helpers::ErrorCode::INVALID_PARAMETER);
+}
+
+TEST_F(RegisterSnapshotTest, UnmappedAddressInRuntimeMaskIsReported)
+{
+    const RegisterMask mask{RegAddress::XACTUAL, RegAddress::MSCNT};
+
+    const auto snap{driver.snapshot(mask)};
+
+    EXPECT_EQ(snap.failed_count(), 1U);
+    EXPECT_EQ(snap.get(RegAddress::MSCNT).error(), helpers::ErrorCode::INVALID_PARAMETER);
+    EXPECT_EQ(snap.get(RegAddress::XACTUAL).value(), 1000U);
+}
+
+TEST_F(RegisterSnapshotTest, FailedTransferOnlyFailsOneRegister)
+{
+    spi.set_transfer_failure_after(2U);
+
+    const auto snap{driver.snapshot()};
+
+    EXPECT_EQ(snap.failed_count(), 1U);
+    EXPECT_EQ(snap.get(RegAddress::XACTUAL).error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(snap.get(RegAddress::VACTUAL).value(), 2000U);
+    EXPECT_EQ(snap.get(RegAddress::DRV_STATUS).value(), 0x8000'0000U);
+    EXPECT_EQ(snap.status().error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+TEST_F(RegisterSnapshotTest, GetAllRegistersIsAddressIndexed)
+{
+    ASSERT_TRUE(driver.set_register_value(RegAddress::CHOPCONF, 0x1234U));
+
+    const auto registers{driver.get_all_registers()};
+
+    ASSERT_TRUE(registers);
+    EXPECT_EQ((*registers)[chip::tmc5160::CHOPCONF::address], 0x1234U);
+    EXPECT_EQ((*registers)[chip::tmc5160::VACTUAL::address], 2000U);
+}
+
+TEST_F(RegisterSnapshotTest, GetAllRegistersReportsFailure)
+{
+    spi.set_transfer_failure_after(1U);
+
+    const auto registers{driver.get_all_registers()};
+
+    ASSERT_FALSE(registers);
+    EXPECT_EQ(registers.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+} // namespace tmcxx::features::test
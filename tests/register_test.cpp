@@ -204,6 +204,20 @@ TEST(VolatileTest, ChopconfIsRW)
     EXPECT_EQ(CHOPCONF::access, core::Access::RW);
 }
 
+TEST(RestorableTest, XtargetIsTriggerNotRestorable)
+{
+    EXPECT_TRUE(core::concepts::TriggerRegister<XTARGET>);
+    EXPECT_FALSE(core::concepts::RestorableRegister<XTARGET>);
+}
+
+TEST(RestorableTest, VolatileAndReadOnlyAreNotRestorable)
+{
+    EXPECT_FALSE(core::concepts::RestorableRegister<XACTUAL>);
+    EXPECT_FALSE(core::concepts::RestorableRegister<GSTAT>);
+    EXPECT_TRUE(core::concepts::RestorableRegister<CHOPCONF>);
+    EXPECT_TRUE(core::concepts::RestorableRegister<TWPOWER_DOWN>);
+}
+
 TEST(RampModeTest, PositioningValue)
 {
     EXPECT_EQ(static_cast<uint32_t>(RampModeType::POSITIONING), 0U);
@@ -0,0 +1,229 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/features/sensorless_homing.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace units::literals;
+using ::tmcxx::test::MockBatchSpi;
+using ::tmcxx::test::MockSpi;
+
+namespace regs = chip::tmc5160;
+
+using driver_t = TMC5160<MockSpi>;
+using homing_t = SensorlessHoming<driver_t>;
+
+constexpr uint32_t event_stop_sg{regs::RAMP_STAT::event_stop_sg_t{1U}.value};
+
+/**
+ * @brief Raises the StallGuard2 stop event after a number of samples.
+ */
+struct StallAfter
+{
+    MockSpi* spi{};
+    uint32_t samples{};
+    std::vector<uint16_t> sg_results{};
+
+    static void on_sample(void* context, uint16_t sg_result, int32_t)
+    {
+        auto* self{static_cast<StallAfter*>(context)};
+        self->sg_results.push_back(sg_result);
+
+        if (self->sg_results.size() == self->samples)
+        {
+            self->spi->set_register_value(regs::RAMP_STAT::address, event_stop_sg);
+        }
+    }
+};
+
+class SensorlessHomingTest : public ::testing::Test {
+  protected:
+    MockSpi spi;
+    driver_t axis{spi, {}};
+};
+
+TEST_F(SensorlessHomingTest, StartArmsStallGuardBeforeMoving)
+{
+    homing_t homing{axis, {.velocity = -60_rpm, .sgt = -5, .filter = true, .tcoolthrs = 500U}};
+
+    ASSERT_TRUE(homing.start());
+    EXPECT_EQ(homing.state(), homing_t::State::SEEKING);
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 6U);
+    EXPECT_EQ(txs[0].get_address(), regs::TCOOLTHRS::address);
+    EXPECT_EQ(txs[0].get_write_value(), 500U);
+    EXPECT_EQ(txs[1].get_address(), regs::SW_MODE::address);
+    EXPECT_EQ(txs[1].get_write_value(), regs::SW_MODE::sg_stop_t{1U}.value);
+    EXPECT_EQ(txs[2].get_address(), regs::COOLCONF::address);
+    EXPECT_EQ(txs[2].get_write_value(), (0x7BU << 16U) | (1U << 24U)) << "sgt = -5 in two's complement";
+    EXPECT_EQ(txs[3].get_address(), regs::RAMP_STAT::address);
+    EXPECT_EQ(txs[3].get_write_value(), event_stop_sg) << "Stale stop event cleared before moving";
+    EXPECT_EQ(txs[4].get_address(), regs::RAMPMODE::address);
+    EXPECT_EQ(txs[4].get_write_value(), static_cast<uint32_t>(regs::RampModeType::VELOCITY_NEG));
+    EXPECT_EQ(txs[5].get_address(), regs::VMAX::address);
+    EXPECT_EQ(txs[5].get_write_value(), axis.converter().rpm_to_vmax(60_rpm));
+}
+
+TEST_F(SensorlessHomingTest, DefaultThresholdArmsAboveEightyPercent)
+{
+    homing_t homing{axis, {.velocity = 60_rpm}};
+
+    ASSERT_TRUE(homing.start());
+
+    const uint32_t vmax{axis.converter().rpm_to_vmax(60_rpm)};
+    const uint32_t expected{static_cast<uint32_t>((uint64_t{1U} << 24U) * 5U / (uint64_t{vmax} * 4U))};
+    EXPECT_EQ(spi.get_last_written_value(regs::TCOOLTHRS::address), expected);
+}
+
+TEST_F(SensorlessHomingTest, ZeroVelocityIsRejected)
+{
+    homing_t homing{axis, {}};
+
+    const auto res{homing.start()};
+
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error(), helpers::ErrorCode::INVALID_PARAMETER);
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+}
+
+TEST_F(SensorlessHomingTest, SampleIsOneBurst)
+{
+    homing_t homing{axis, {.velocity = 60_rpm}};
+    ASSERT_TRUE(homing.start());
+    spi.clear_transactions();
+    spi.set_register_value(regs::DRV_STATUS::address, 0x0123U);
+
+    const auto homed{homing.poll()};
+
+    ASSERT_TRUE(homed);
+    EXPECT_FALSE(*homed);
+    EXPECT_EQ(spi.get_transaction_count(), 4U);
+    EXPECT_EQ(homing.last_sg_result(), 0x0123U);
+    EXPECT_EQ(homing.samples(), 1U);
+}
+
+TEST_F(SensorlessHomingTest, StallLatchesAndZeroesAxis)
+{
+    homing_t homing{axis, {.velocity = -60_rpm, .home_position = 10}};
+    ASSERT_TRUE(homing.start());
+    spi.set_register_value(regs::XACTUAL::address, static_cast<uint32_t>(-12'345));
+    spi.set_register_value(regs::RAMP_STAT::address, event_stop_sg);
+    spi.clear_transactions();
+
+    const auto homed{homing.poll()};
+
+    ASSERT_TRUE(homed);
+    EXPECT_TRUE(*homed);
+    EXPECT_EQ(homing.state(), homing_t::State::HOMED);
+    EXPECT_EQ(homing.latched_position(), -12'345);
+
+    const auto& txs{spi.get_transactions()};
+    ASSERT_EQ(txs.size(), 10U);
+    EXPECT_EQ(txs[4].get_address(), regs::RAMPMODE::address);
+    EXPECT_EQ(txs[4].get_write_value(), static_cast<uint32_t>(regs::RampModeType::POSITIONING));
+    EXPECT_EQ(txs[5].get_address(), regs::XACTUAL::address);
+    EXPECT_EQ(txs[5].get_write_value(), 10U);
+    EXPECT_EQ(txs[6].get_address(), regs::VMAX::address);
+    EXPECT_EQ(txs[6].get_write_value(), 0U);
+    EXPECT_EQ(txs[7].get_address(), regs::XTARGET::address);
+    EXPECT_EQ(txs[7].get_write_value(), 10U);
+    EXPECT_EQ(txs[8].get_address(), regs::SW_MODE::address);
+    EXPECT_EQ(txs[8].get_write_value(), 0U);
+    EXPECT_EQ(txs[9].get_address(), regs::RAMP_STAT::address) << "Stop event released last";
+}
+
+TEST_F(SensorlessHomingTest, SampleLimitStopsWithTimeout)
+{
+    homing_t homing{axis, {.velocity = 60_rpm, .max_samples = 3U}};
+    ASSERT_TRUE(homing.start());
+
+    EXPECT_TRUE(homing.poll());
+    EXPECT_TRUE(homing.poll());
+    const auto res{homing.poll()};
+
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error(), helpers::ErrorCode::TIMEOUT);
+    EXPECT_EQ(homing.state(), homing_t::State::FAILED);
+    EXPECT_EQ(spi.get_last_written_value(regs::VMAX::address), 0U);
+    EXPECT_EQ(spi.get_last_written_value(regs::SW_MODE::address), 0U) << "sg_stop disarmed";
+    EXPECT_EQ(spi.get_transactions().back().get_address(), regs::RAMP_STAT::address) << "Stop event cleared";
+}
+
+TEST_F(SensorlessHomingTest, SpiErrorFailsRun)
+{
+    homing_t homing{axis, {.velocity = 60_rpm}};
+    ASSERT_TRUE(homing.start());
+    spi.set_next_transfer_failure(true);
+
+    const auto res{homing.poll()};
+
+    ASSERT_FALSE(res);
+    EXPECT_EQ(homing.state(), homing_t::State::FAILED);
+    EXPECT_EQ(spi.get_last_written_value(regs::VMAX::address), 0U);
+    EXPECT_EQ(spi.get_last_written_value(regs::SW_MODE::address), 0U) << "sg_stop disarmed";
+    EXPECT_EQ(spi.get_transactions().back().get_address(), regs::RAMP_STAT::address) << "Stop event cleared";
+}
+
+TEST(SensorlessHomingGroupTest, HomesAxesConcurrently)
+{
+    MockSpi x_spi;
+    MockSpi y_spi;
+    driver_t x_axis{x_spi, {}};
+    driver_t y_axis{y_spi, {}};
+
+    homing_t x_home{x_axis, {.velocity = -60_rpm, .max_samples = 100U}};
+    homing_t y_home{y_axis, {.velocity = 60_rpm, .max_samples = 100U}};
+
+    StallAfter x_stall{&x_spi, 3U};
+    StallAfter y_stall{&y_spi, 7U};
+    x_home.set_sample_hook(&StallAfter::on_sample, &x_stall);
+    y_home.set_sample_hook(&StallAfter::on_sample, &y_stall);
+
+    ASSERT_TRUE(home_all(std::array{&x_home, &y_home}));
+
+    EXPECT_EQ(x_home.state(), homing_t::State::HOMED);
+    EXPECT_EQ(y_home.state(), homing_t::State::HOMED);
+    EXPECT_EQ(x_home.samples(), 4U) << "Event visible on the sample after it was raised";
+    EXPECT_EQ(y_home.samples(), 8U);
+}
+
+TEST(SensorlessHomingGroupTest, ReportsFirstErrorAfterAllFinish)
+{
+    MockSpi x_spi;
+    MockSpi y_spi;
+    driver_t x_axis{x_spi, {}};
+    driver_t y_axis{y_spi, {}};
+
+    homing_t x_home{x_axis, {.velocity = -60_rpm, .max_samples = 2U}};
+    homing_t y_home{y_axis, {.velocity = 60_rpm, .max_samples = 100U}};
+
+    StallAfter y_stall{&y_spi, 5U};
+    y_home.set_sample_hook(&StallAfter::on_sample, &y_stall);
+
+    const auto res{home_all(std::array{&x_home, &y_home})};
+
+    ASSERT_FALSE(res);
+    EXPECT_EQ(res.error(), helpers::ErrorCode::TIMEOUT);
+    EXPECT_EQ(x_home.state(), homing_t::State::FAILED);
+    EXPECT_EQ(y_home.state(), homing_t::State::HOMED);
+}
+
+TEST(SensorlessHomingBatchTest, SampleIsOneBatch)
+{
+    MockBatchSpi spi;
+    TMC5160<MockBatchSpi> axis{spi, {}};
+    SensorlessHoming homing{axis, {.velocity = 60_rpm}};
+    ASSERT_TRUE(homing.start());
+
+    ASSERT_TRUE(homing.poll());
+
+    EXPECT_EQ(spi.get_batch_sizes().back(), 4U);
+}
+
+} // namespace tmcxx::features::test
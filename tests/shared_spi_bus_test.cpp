@@ -0,0 +1,222 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/features/shared_spi_bus.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace units::literals;
+using ::tmcxx::test::MockSpi;
+
+constexpr uint8_t xtarget_address{0x2DU};
+
+/**
+ * @brief Chip select that counts its pulses and flags two lines asserted at once.
+ */
+struct RecordingChipSelect
+{
+    std::atomic<int>* asserted_lines{};
+    std::atomic<bool>* overlap{};
+    std::size_t pulses{};
+
+    void select()
+    {
+        if (asserted_lines->fetch_add(1) != 0)
+        {
+            overlap->store(true);
+        }
+        ++pulses;
+    }
+
+    void deselect()
+    {
+        asserted_lines->fetch_sub(1);
+    }
+};
+
+/**
+ * @brief Mutex that holds every locker until the test opens the gate, to make posted datagrams pile up.
+ */
+struct GatedMutex
+{
+    inline static std::mutex gate_mutex{};
+    inline static std::condition_variable gate_changed{};
+    inline static bool gate_open{true};
+    inline static int waiting{};
+
+    std::mutex inner{};
+
+    void lock()
+    {
+        {
+            std::unique_lock gate{gate_mutex};
+            ++waiting;
+            gate_changed.notify_all();
+            gate_changed.wait(gate, [] {
+                return gate_open;
+            });
+            --waiting;
+        }
+        inner.lock();
+    }
+
+    void unlock()
+    {
+        inner.unlock();
+    }
+
+    static void close()
+    {
+        const std::lock_guard gate{gate_mutex};
+        gate_open = false;
+    }
+
+    static void open_when_waiting(int lockers)
+    {
+        std::unique_lock gate{gate_mutex};
+        gate_changed.wait(gate, [lockers] {
+            return waiting >= lockers;
+        });
+        gate_open = true;
+        gate_changed.notify_all();
+    }
+};
+
+using bus_t = SharedSpiBus<MockSpi, RecordingChipSelect, std::mutex>;
+using driver_t = TMC5160<bus_t::Device>;
+
+static_assert(core::concepts::SpiDevice<bus_t::Device>, "Device must satisfy SpiDevice concept");
+
+class SharedSpiBusTest : public ::testing::Test {
+  protected:
+    std::atomic<int> asserted_lines{};
+    std::atomic<bool> overlap{};
+
+    MockSpi spi;
+    bus_t bus{spi};
+
+    RecordingChipSelect x_cs{&asserted_lines, &overlap};
+    RecordingChipSelect y_cs{&asserted_lines, &overlap};
+    bus_t::Device x_spi{bus, x_cs};
+    bus_t::Device y_spi{bus, y_cs};
+
+    driver_t::Settings settings{};
+    driver_t x_axis{x_spi, settings};
+    driver_t y_axis{y_spi, settings};
+};
+
+TEST_F(SharedSpiBusTest, EachDatagramPulsesItsOwnChipSelect)
+{
+    ASSERT_TRUE(x_axis.move_to(100_steps, 60_rpm));
+    const std::size_t x_datagrams{spi.get_transaction_count()};
+
+    ASSERT_TRUE(y_axis.move_to(200_steps, 60_rpm));
+
+    EXPECT_EQ(x_cs.pulses, x_datagrams);
+    EXPECT_EQ(y_cs.pulses, spi.get_transaction_count() - x_datagrams);
+    EXPECT_FALSE(overlap.load());
+    EXPECT_EQ(spi.get_last_written_value(xtarget_address), 200U);
+}
+
+TEST_F(SharedSpiBusTest, UncontendedDatagramsAreSingleBatches)
+{
+    ASSERT_TRUE(x_axis.move_to(100_steps, 60_rpm));
+
+    EXPECT_EQ(bus.transfer_count(), spi.get_transaction_count());
+    EXPECT_EQ(bus.batch_count(), bus.transfer_count());
+    EXPECT_EQ(spi.get_select_count(), bus.batch_count()) << "Peripheral is claimed once per batch";
+}
+
+TEST_F(SharedSpiBusTest, PipelinedReadReturnsRegisterValue)
+{
+    spi.set_register_value(0x21U, 1234U);
+
+    const auto position{x_axis.get_actual_motor_position()};
+
+    ASSERT_TRUE(position);
+    EXPECT_EQ(*position, 1234);
+}
+
+TEST_F(SharedSpiBusTest, FailedTransferOnlyFailsItsDevice)
+{
+    spi.set_next_transfer_failure(true);
+
+    const auto failed{x_axis.stop()};
+    ASSERT_FALSE(failed);
+    EXPECT_EQ(failed.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+
+    EXPECT_TRUE(y_axis.stop());
+}
+
+TEST_F(SharedSpiBusTest, ConcurrentDriversNeverOverlap)
+{
+    constexpr int moves{200};
+
+    const auto run{[](driver_t& axis, int base, std::atomic<int>& failures) {
+        for (int idx{}; idx < moves; ++idx)
+        {
+            if (!axis.move_to(units::microsteps_t{base + idx}, 60_rpm))
+            {
+                failures.fetch_add(1);
+            }
+            std::this_thread::yield();
+        }
+    }};
+
+    std::atomic<int> failures{};
+    std::thread x_thread{run, std::ref(x_axis), 0, std::ref(failures)};
+    std::thread y_thread{run, std::ref(y_axis), 10000, std::ref(failures)};
+    x_thread.join();
+    y_thread.join();
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_FALSE(overlap.load());
+    EXPECT_EQ(bus.transfer_count(), spi.get_transaction_count());
+    EXPECT_EQ(x_cs.pulses + y_cs.pulses, spi.get_transaction_count());
+    EXPECT_EQ(spi.find_writes_to(xtarget_address).size(), 2U * moves);
+}
+
+TEST(SharedSpiBusCombiningTest, LockHolderSendsAllPostedDatagrams)
+{
+    using gated_bus_t = SharedSpiBus<MockSpi, RecordingChipSelect, GatedMutex>;
+    using gated_driver_t = TMC5160<gated_bus_t::Device>;
+
+    std::atomic<int> asserted_lines{};
+    std::atomic<bool> overlap{};
+    MockSpi spi{};
+    gated_bus_t bus{spi};
+
+    RecordingChipSelect x_cs{&asserted_lines, &overlap};
+    RecordingChipSelect y_cs{&asserted_lines, &overlap};
+    gated_bus_t::Device x_spi{bus, x_cs};
+    gated_bus_t::Device y_spi{bus, y_cs};
+
+    gated_driver_t::Settings settings{};
+    gated_driver_t x_axis{x_spi, settings};
+    gated_driver_t y_axis{y_spi, settings};
+
+    GatedMutex::close();
+    std::thread x_thread{[&x_axis] {
+        EXPECT_TRUE(x_axis.stop());
+    }};
+    std::thread y_thread{[&y_axis] {
+        EXPECT_TRUE(y_axis.stop());
+    }};
+    GatedMutex::open_when_waiting(2);
+    x_thread.join();
+    y_thread.join();
+
+    EXPECT_EQ(bus.transfer_count(), 2U);
+    EXPECT_EQ(bus.batch_count(), 1U) << "First lock holder must send the other posted datagram too";
+    EXPECT_EQ(x_cs.pulses, 1U);
+    EXPECT_EQ(y_cs.pulses, 1U);
+    EXPECT_FALSE(overlap.load());
+}
+
+} // namespace tmcxx::features::test
@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <concepts>
+#include <cstdint>
+
+#include "mocks/recording_spi.hpp"
+#include "mocks/tmc5160_emulator.hpp"
+#include "tmcxx/features/spi_transport.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace std::chrono_literals;
+using namespace units::literals;
+using ::tmcxx::test::RecordingBatchSpi;
+using ::tmcxx::test::RecordingSpi;
+using ::tmcxx::test::TMC5160Emulator;
+
+namespace regs = chip::tmc5160;
+
+constexpr regs::Settings motor_settings{
+    .run_current = 1.0_A,
+    .hold_current = 0.5_A,
+    .v_stop = 1_rpm,
+    .v_max = 300_rpm,
+    .a_max = 512000_pps2,
+    .d_max = 512000_pps2,
+};
+
+static_assert(TransportBackend<TMC5160Emulator>);
+static_assert(!TransportBackend<SpiTransport>, "A transport is copied, not wrapped");
+static_assert(!TransportBackend<BatchSpiTransport>);
+static_assert(!std::constructible_from<BatchSpiTransport, TMC5160Emulator&>, "Needs transfer_frames()");
+static_assert(std::same_as<ThinTMC5160<>, TMC5160<SpiTransport>>);
+
+TEST(SpiTransportTest, ForwardsTransfersAndChipSelect)
+{
+    RecordingSpi<> spi;
+    SpiTransport transport{spi};
+    const std::array<uint8_t, 5> tx{0x21U, 0x00U, 0x00U, 0x00U, 0x00U};
+    std::array<uint8_t, 5> rx{};
+
+    transport.select();
+    EXPECT_TRUE(transport.transfer(tx, rx, 10U));
+    transport.deselect();
+
+    EXPECT_EQ(spi.get_select_count(), 1U);
+    EXPECT_EQ(spi.get_transfer_count(), 1U);
+    EXPECT_EQ(spi.get_read_count(0x21U), 1U);
+}
+
+TEST(SpiTransportTest, ThinDriverMatchesTemplatedDriver)
+{
+    TMC5160Emulator full_chip;
+    TMC5160Emulator thin_chip;
+    SpiTransport transport{thin_chip};
+    TMC5160<TMC5160Emulator> full_axis{full_chip, motor_settings};
+    ThinTMC5160<> thin_axis{transport, motor_settings};
+
+    ASSERT_TRUE(full_axis.apply_settings());
+    ASSERT_TRUE(thin_axis.apply_settings());
+    ASSERT_TRUE(full_axis.move_to(12'800_steps, 300_rpm));
+    ASSERT_TRUE(thin_axis.move_to(12'800_steps, 300_rpm));
+
+    full_chip.advance(50ms);
+    thin_chip.advance(50ms);
+
+    const auto full_position{full_axis.get_actual_motor_position()};
+    const auto thin_position{thin_axis.get_actual_motor_position()};
+    ASSERT_TRUE(full_position);
+    ASSERT_TRUE(thin_position);
+    EXPECT_GT(*thin_position, 0);
+    EXPECT_EQ(*thin_position, *full_position);
+    EXPECT_EQ(thin_chip.datagrams(), full_chip.datagrams());
+}
+
+TEST(SpiTransportTest, BackendsShareOneDriverType)
+{
+    TMC5160Emulator emulator;
+    RecordingSpi<> recorder;
+    SpiTransport emulator_spi{emulator};
+    SpiTransport recorder_spi{recorder};
+
+    ThinTMC5160<> x_axis{emulator_spi, motor_settings};
+    ThinTMC5160<> y_axis{recorder_spi, motor_settings};
+
+    ASSERT_TRUE(x_axis.apply_settings());
+    ASSERT_TRUE(y_axis.apply_settings());
+    EXPECT_GT(emulator.datagrams(), 0U);
+    EXPECT_EQ(recorder.get_datagram_count(), emulator.datagrams());
+}
+
+TEST(BatchSpiTransportTest, KeepsFrameBatching)
+{
+    RecordingBatchSpi<> spi;
+    BatchSpiTransport transport{spi};
+    ThinTMC5160<Converter, NoInstrumentation, BatchSpiTransport> axis{transport, motor_settings};
+
+    const auto values{axis.read_registers<regs::XACTUAL, regs::VACTUAL, regs::DRV_STATUS>()};
+    ASSERT_TRUE(values);
+
+    EXPECT_EQ(spi.get_batch_count(), 1U);
+    EXPECT_EQ(spi.get_datagram_count(), 4U);
+}
+
+} // namespace tmcxx::features::test
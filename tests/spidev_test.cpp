@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "tmcxx/adapters/spidev/spi_driver.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::adapters::spidev::test {
+
+static_assert(core::concepts::SpiDevice<SpiDriver>, "SpiDriver must satisfy SpiDevice concept");
+static_assert(core::concepts::BatchSpiDevice<SpiDriver>, "SpiDriver must satisfy BatchSpiDevice concept");
+
+TEST(SpidevDriverTest, OpenReportsMissingNode)
+{
+    SpiDriver spi{};
+
+    const auto result{spi.open("/dev/tmcxx-no-such-spidev")};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_FALSE(spi.is_open());
+}
+
+TEST(SpidevDriverTest, ClosedDeviceRejectsTransfers)
+{
+    SpiDriver spi{};
+    constexpr std::array<uint8_t, 10> tx_data{};
+    std::array<uint8_t, 10> rx_data{};
+
+    EXPECT_FALSE(spi.transfer(tx_data, rx_data, 0U));
+    EXPECT_FALSE(spi.transfer_frames(tx_data, rx_data, 5U, 0U));
+}
+
+TEST(SpidevDriverTest, MessagesAreChunkedAtTheTransferLimit)
+{
+    constexpr std::size_t frame_size{5U};
+    constexpr std::size_t frames{SpiDriver::max_frames_per_message + 1U};
+    std::array<uint8_t, frames * frame_size> tx_data{};
+    std::array<uint8_t, frames * frame_size> rx_data{};
+    std::array<spi_ioc_transfer, SpiDriver::max_frames_per_message> messages{};
+
+    ASSERT_EQ(SpiDriver::build_message(tx_data, rx_data, frame_size, 0U, 1'000'000U, messages),
+        SpiDriver::max_frames_per_message);
+
+    for (std::size_t idx{}; idx < messages.size(); ++idx)
+    {
+        EXPECT_EQ(messages[idx].tx_buf, reinterpret_cast<std::uintptr_t>(&tx_data[idx * frame_size])) << idx;
+        EXPECT_EQ(messages[idx].rx_buf, reinterpret_cast<std::uintptr_t>(&rx_data[idx * frame_size])) << idx;
+        EXPECT_EQ(messages[idx].len, frame_size) << idx;
+        EXPECT_EQ(messages[idx].speed_hz, 1'000'000U) << idx;
+        EXPECT_EQ(messages[idx].bits_per_word, 8U) << idx;
+        EXPECT_EQ(messages[idx].cs_change, (idx + 1U < messages.size()) ? 1U : 0U) << idx;
+    }
+
+    constexpr std::size_t second{SpiDriver::max_frames_per_message};
+    ASSERT_EQ(SpiDriver::build_message(tx_data, rx_data, frame_size, second, 1'000'000U, messages), 1U);
+    EXPECT_EQ(messages[0].tx_buf, reinterpret_cast<std::uintptr_t>(&tx_data[(frames - 1U) * frame_size]));
+    EXPECT_EQ(messages[0].cs_change, 0U) << "Last frame of the burst";
+
+    EXPECT_EQ(SpiDriver::build_message(tx_data, rx_data, frame_size, frames, 1'000'000U, messages), 0U);
+}
+
+TEST(SpidevDriverTest, SingleDatagramIsOneTransfer)
+{
+    constexpr std::array<uint8_t, 5> tx_data{0xA1U, 0x00U, 0x00U, 0x00U, 0x2AU};
+    std::array<uint8_t, 5> rx_data{};
+    std::array<spi_ioc_transfer, SpiDriver::max_frames_per_message> messages{};
+
+    ASSERT_EQ(SpiDriver::build_message(tx_data, rx_data, tx_data.size(), 0U, SpiDriver::default_speed_hz, messages),
+        1U);
+    EXPECT_EQ(messages[0].len, 5U);
+    EXPECT_EQ(messages[0].speed_hz, SpiDriver::default_speed_hz);
+    EXPECT_EQ(messages[0].cs_change, 0U);
+}
+
+TEST(SpidevDriverTest, MessageRequestMatchesKernelMacro)
+{
+    EXPECT_EQ(SpiDriver::message_request(1U), SPI_IOC_MESSAGE(1));
+    EXPECT_EQ(SpiDriver::message_request(2U), SPI_IOC_MESSAGE(2));
+    EXPECT_EQ(SpiDriver::message_request(SpiDriver::max_frames_per_message),
+        SPI_IOC_MESSAGE(SpiDriver::max_frames_per_message));
+    EXPECT_EQ(_IOC_SIZE(SpiDriver::message_request(3U)), 3U * sizeof(spi_ioc_transfer));
+}
+
+TEST(SpidevDriverTest, DriverOnClosedDeviceReportsTransferError)
+{
+    SpiDriver spi{};
+    TMC5160<SpiDriver>::Settings settings{};
+    TMC5160<SpiDriver> driver{spi, settings};
+
+    const auto position{driver.get_actual_motor_position()};
+
+    ASSERT_FALSE(position);
+    EXPECT_EQ(position.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+}
+
+} // namespace tmcxx::adapters::spidev::test
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+#include "mocks/mock_spi.hpp"
+#include "tmcxx/features/spsc_ring.hpp"
+#include "tmcxx/features/telemetry_sampler.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using ::tmcxx::test::MockSpi;
+
+TEST(SpscRingTest, PopsInPushOrder)
+{
+    SpscRing<uint32_t, 4> ring{};
+
+    EXPECT_TRUE(ring.try_push(1U));
+    EXPECT_TRUE(ring.try_push(2U));
+
+    uint32_t value{};
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 1U);
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 2U);
+    EXPECT_FALSE(ring.try_pop(value));
+    EXPECT_TRUE(ring.empty());
+}
+
+TEST(SpscRingTest, UsesEverySlotAndRefusesWhenFull)
+{
+    SpscRing<uint32_t, 4> ring{};
+
+    for (uint32_t idx{}; idx < 4U; ++idx)
+    {
+        EXPECT_TRUE(ring.try_push(idx));
+    }
+
+    EXPECT_FALSE(ring.try_push(99U));
+    EXPECT_EQ(ring.size(), 4U);
+
+    uint32_t value{};
+    ASSERT_TRUE(ring.try_pop(value));
+    EXPECT_EQ(value, 0U);
+    EXPECT_TRUE(ring.try_push(4U)) << "A freed slot is reusable";
+}
+
+TEST(SpscRingTest, WrapsAroundManyTimes)
+{
+    SpscRing<uint32_t, 2> ring{};
+    uint32_t value{};
+
+    for (uint32_t idx{}; idx < 1000U; ++idx)
+    {
+        ASSERT_TRUE(ring.try_push(idx));
+        ASSERT_TRUE(ring.try_pop(value));
+        ASSERT_EQ(value, idx);
+    }
+}
+
+TEST(SpscRingTest, TransfersEveryElementAcrossThreads)
+{
+    constexpr uint32_t item_count{200'000U};
+    SpscRing<uint32_t, 64> ring{};
+
+    std::thread producer{[&ring] {
+        for (uint32_t idx{}; idx < item_count;)
+        {
+            if (ring.try_push(idx))
+            {
+                ++idx;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+    }};
+
+    uint32_t expected{};
+    bool in_order{true};
+    while (expected < item_count)
+    {
+        uint32_t value{};
+        if (ring.try_pop(value))
+        {
+            in_order = in_order && (value == expected);
+            ++expected;
+        }
+    }
+
+    producer.join();
+
+    EXPECT_TRUE(in_order);
+    EXPECT_TRUE(ring.empty());
+}
+
+class TelemetrySamplerTest : public ::testing::Test {
+  protected:
+    using driver_t = TMC5160<MockSpi>;
+    using sampler_t = TelemetrySampler<driver_t, 4>;
+
+    void SetUp() override
+    {
+        spi.reset();
+        spi.set_register_value(chip::tmc5160::XACTUAL::address, 123U);
+        spi.set_register_value(chip::tmc5160::VACTUAL::address, 0xFF'FFFFU);
+        spi.set_register_value(chip::tmc5160::DRV_STATUS::address, 0x8000'0000U);
+    }
+
+    MockSpi spi;
+    driver_t::Settings settings{};
+    driver_t driver{spi, settings};
+    sampler_t::ring_t ring{};
+    sampler_t sampler{driver, ring, 10U};
+};
+
+TEST_F(TelemetrySamplerTest, SampleIsOneBurst)
+{
+    const auto pushed{sampler.poll(0U)};
+
+    ASSERT_TRUE(pushed);
+    EXPECT_TRUE(*pushed);
+    EXPECT_EQ(spi.get_transaction_count(), 5U);
+
+    TelemetrySample sample{};
+    ASSERT_TRUE(ring.try_pop(sample));
+    EXPECT_EQ(sample.motion.position, 123);
+    EXPECT_EQ(sample.motion.velocity, -1);
+    EXPECT_EQ(sample.drv_status, 0x8000'0000U);
+}
+
+TEST_F(TelemetrySamplerTest, PollHonoursPeriod)
+{
+    ASSERT_TRUE(sampler.poll(100U).value());
+    EXPECT_FALSE(sampler.poll(105U).value());
+    EXPECT_TRUE(sampler.poll(110U).value());
+
+    EXPECT_EQ(ring.size(), 2U);
+    EXPECT_EQ(spi.get_transaction_count(), 10U) << "A poll that is not due costs no SPI traffic";
+}
+
+TEST_F(TelemetrySamplerTest, PeriodSurvivesTickWrapAround)
+{
+    ASSERT_TRUE(sampler.poll(0xFFFF'FFFAU).value());
+
+    EXPECT_FALSE(sampler.poll(0xFFFF'FFFFU).value());
+    EXPECT_TRUE(sampler.poll(4U).value());
+}
+
+TEST_F(TelemetrySamplerTest, TimestampsComeFromCaller)
+{
+    ASSERT_TRUE(sampler.poll(42U).value());
+
+    TelemetrySample sample{};
+    ASSERT_TRUE(ring.try_pop(sample));
+    EXPECT_EQ(sample.timestamp, 42U);
+}
+
+TEST_F(TelemetrySamplerTest, FullRingDropsNewSamples)
+{
+    for (uint32_t tick{}; tick < 6U; ++tick)
+    {
+        ASSERT_TRUE(sampler.sample(tick));
+    }
+
+    EXPECT_EQ(ring.size(), 4U);
+    EXPECT_EQ(sampler.dropped(), 2U);
+
+    TelemetrySample sample{};
+    ASSERT_TRUE(ring.try_pop(sample));
+    EXPECT_EQ(sample.timestamp, 0U) << "Oldest samples are kept";
+}
+
+TEST_F(TelemetrySamplerTest, ReadErrorIsCountedAndReported)
+{
+    spi.set_next_transfer_failure(true);
+
+    const auto result{sampler.poll(0U)};
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), helpers::ErrorCode::SPI_TRANSFER_FAILED);
+    EXPECT_EQ(sampler.read_errors(), 1U);
+    EXPECT_TRUE(ring.empty());
+}
+
+} // namespace tmcxx::features::test
@@ -0,0 +1,334 @@
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "mocks/tmc5160_emulator.hpp"
+#include "tmcxx/features/sensorless_homing.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::test {
+
+using namespace std::chrono_literals;
+using namespace units::literals;
+
+namespace regs = chip::tmc5160;
+using regs::RegAddress;
+
+using driver_t = TMC5160<TMC5160Emulator>;
+
+constexpr regs::Settings ramp_settings{
+    .run_current = 1.0_A,
+    .hold_current = 0.5_A,
+    .v_stop = 1_rpm,
+    .v_max = 300_rpm,
+    .a_max = 512000_pps2,
+    .d_max = 512000_pps2,
+};
+
+/**
+ * @brief Wait policy on the emulator's simulated clock (1 us ticks): waiting runs the ramp generator.
+ */
+struct SimulatedClock
+{
+    TMC5160Emulator* chip{};
+
+    [[nodiscard]] uint32_t now() const noexcept
+    {
+        return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(chip->now()).count());
+    }
+
+    void wait(uint32_t ticks) const noexcept
+    {
+        chip->advance(std::chrono::microseconds{ticks});
+    }
+};
+
+/**
+ * @brief Raw 40-bit datagram exchange, bypassing the driver.
+ */
+std::array<uint8_t, 5> exchange(TMC5160Emulator& chip, uint8_t address_byte, uint32_t value = 0U)
+{
+    const std::array<uint8_t, 5> tx{address_byte, static_cast<uint8_t>(value >> 24U),
+        static_cast<uint8_t>(value >> 16U), static_cast<uint8_t>(value >> 8U), static_cast<uint8_t>(value)};
+    std::array<uint8_t, 5> rx{};
+
+    chip.select();
+    EXPECT_TRUE(chip.transfer(tx, rx, 0U));
+    chip.deselect();
+
+    return rx;
+}
+
+uint32_t data_of(const std::array<uint8_t, 5>& rx)
+{
+    return (static_cast<uint32_t>(rx[1]) << 24U) | (static_cast<uint32_t>(rx[2]) << 16U) |
+           (static_cast<uint32_t>(rx[3]) << 8U) | static_cast<uint32_t>(rx[4]);
+}
+
+double vmax_of(const TMC5160Emulator& chip)
+{
+    return static_cast<double>(chip.peek(RegAddress::VMAX)) * 12'000'000.0 / static_cast<double>(1ULL << 24U);
+}
+
+double amax_of(const TMC5160Emulator& chip)
+{
+    return static_cast<double>(chip.peek(RegAddress::AMAX)) * 12'000'000.0 * 12'000'000.0 /
+           static_cast<double>(1ULL << 41U);
+}
+
+void start_move(driver_t& axis, int32_t target)
+{
+    axis.begin_transaction();
+    (void)axis.write_register<regs::RAMPMODE>(static_cast<uint32_t>(regs::RampModeType::POSITIONING));
+    (void)axis.write_register<regs::XTARGET>(static_cast<uint32_t>(target));
+    ASSERT_TRUE(axis.commit());
+}
+
+class TMC5160EmulatorTest : public ::testing::Test {
+  protected:
+    TMC5160Emulator chip;
+    driver_t axis{chip, ramp_settings};
+    SimulatedClock clock{&chip};
+};
+
+TEST_F(TMC5160EmulatorTest, ReplyCarriesPreviousReadRequest)
+{
+    constexpr uint8_t write_bit{0x80U};
+    (void)exchange(chip, write_bit | 0x21U, 1234U);
+
+    EXPECT_EQ(data_of(exchange(chip, 0x21U)), 0U) << "First reply belongs to no read yet";
+    (void)exchange(chip, write_bit | 0x21U, 99U);
+    EXPECT_EQ(data_of(exchange(chip, 0x00U)), 1234U) << "Write datagrams keep the latched data";
+}
+
+TEST_F(TMC5160EmulatorTest, DriverReadsAndWritesThroughLag)
+{
+    ASSERT_TRUE(axis.set_actual_motor_position(-5000_steps));
+
+    const auto position{axis.get_actual_motor_position()};
+
+    ASSERT_TRUE(position);
+    EXPECT_EQ(*position, -5000);
+    EXPECT_EQ(chip.framing_errors(), 0U);
+}
+
+TEST_F(TMC5160EmulatorTest, WriteOnlyRegistersReadZero)
+{
+    ASSERT_TRUE(axis.write_register<regs::VSTART>(777U));
+
+    (void)exchange(chip, 0x23U);
+    EXPECT_EQ(data_of(exchange(chip, 0x00U)), 0U);
+    EXPECT_EQ(chip.peek(RegAddress::VSTART), 777U);
+}
+
+TEST_F(TMC5160EmulatorTest, SpiWritesLeaveIfcntAtZero)
+{
+    ASSERT_TRUE(axis.write_register<regs::GCONF>(0x4U));
+
+    EXPECT_EQ(chip.peek(RegAddress::IFCNT), 0U);
+}
+
+TEST_F(TMC5160EmulatorTest, ReadOnlyWritesAreDroppedAndNotCounted)
+{
+    constexpr uint8_t write_bit{0x80U};
+    chip.set_uart_mode(true);
+    ASSERT_TRUE(axis.write_register<regs::GCONF>(0x4U));
+
+    (void)exchange(chip, write_bit | 0x22U, 1000U);
+
+    EXPECT_EQ(chip.peek(RegAddress::VACTUAL), 0U);
+    EXPECT_EQ(chip.peek(RegAddress::IFCNT), 1U);
+}
+
+TEST_F(TMC5160EmulatorTest, GstatClearsOnRead)
+{
+    ASSERT_TRUE(axis.poll_status());
+    EXPECT_TRUE(axis.last_status().reset_flag());
+
+    const auto first{axis.read_registers<regs::GSTAT>()};
+    const auto second{axis.read_registers<regs::GSTAT>()};
+
+    ASSERT_TRUE(first);
+    ASSERT_TRUE(second);
+    EXPECT_EQ((*first)[0], 1U);
+    EXPECT_EQ((*second)[0], 0U);
+    EXPECT_FALSE(axis.last_status().reset_flag());
+}
+
+TEST_F(TMC5160EmulatorTest, VelocityModeRampsToVmax)
+{
+    ASSERT_TRUE(axis.apply_settings());
+    ASSERT_TRUE(axis.rotate(-150_rpm));
+
+    chip.advance(100ms);
+    EXPECT_LT(chip.velocity(), 0.0);
+    EXPECT_FALSE(chip.velocity() == -vmax_of(chip));
+
+    ASSERT_TRUE(axis.wait_for_velocity(1'000'000U, clock));
+    EXPECT_DOUBLE_EQ(chip.velocity(), -vmax_of(chip));
+
+    const auto velocity{axis.get_actual_velocity()};
+    ASSERT_TRUE(velocity);
+    EXPECT_NEAR(velocity->raw(), 150.0F, 0.1F) << "Absolute velocity";
+}
+
+TEST_F(TMC5160EmulatorTest, TrapezoidMoveTakesPredictedTime)
+{
+    constexpr int32_t target{204'800};
+    ASSERT_TRUE(axis.apply_settings());
+
+    const auto start{chip.now()};
+    start_move(axis, target);
+    ASSERT_TRUE(axis.wait_for_position(5'000'000U, clock));
+
+    const double elapsed{std::chrono::duration<double>{chip.now() - start}.count()};
+    const double expected{(target / vmax_of(chip)) + (vmax_of(chip) / amax_of(chip))};
+
+    EXPECT_NEAR(elapsed, expected, 0.02);
+    EXPECT_EQ(static_cast<int32_t>(chip.peek(RegAddress::XACTUAL)), target);
+    EXPECT_EQ(chip.velocity(), 0.0);
+    EXPECT_NE(chip.peek(RegAddress::RAMP_STAT) & regs::RAMP_STAT::event_pos_reached_t{1U}.value, 0U);
+}
+
+TEST_F(TMC5160EmulatorTest, SixPointRampUsesFirstAccelerationBelowV1)
+{
+    auto settings{ramp_settings};
+    settings.v_1 = 100_rpm;
+    settings.a_1 = 128000_pps2;
+    settings.d_1 = 128000_pps2;
+    driver_t six_point{chip, settings};
+    ASSERT_TRUE(six_point.apply_settings());
+
+    start_move(six_point, 400'000);
+    chip.advance(100ms);
+    EXPECT_NEAR(chip.velocity(), 12'800.0, 200.0) << "A1 phase";
+
+    ASSERT_TRUE(six_point.wait_for_position(10'000'000U, clock));
+    EXPECT_EQ(static_cast<int32_t>(chip.peek(RegAddress::XACTUAL)), 400'000);
+}
+
+TEST_F(TMC5160EmulatorTest, TargetBehindReversesAndArrives)
+{
+    ASSERT_TRUE(axis.apply_settings());
+    start_move(axis, 100'000);
+    chip.advance(300ms);
+    ASSERT_GT(chip.velocity(), 0.0);
+
+    start_move(axis, 0);
+    ASSERT_TRUE(axis.wait_for_position(5'000'000U, clock));
+
+    EXPECT_EQ(chip.peek(RegAddress::XACTUAL), 0U);
+    EXPECT_EQ(chip.velocity(), 0.0);
+}
+
+TEST_F(TMC5160EmulatorTest, DatagramTimeAdvancesSimulatedClock)
+{
+    chip.set_datagram_time(4us);
+
+    ASSERT_TRUE((axis.read_registers<regs::XACTUAL, regs::VACTUAL, regs::DRV_STATUS>()));
+
+    EXPECT_EQ(chip.now(), 16us) << "Three requests and one trailing datagram";
+}
+
+TEST_F(TMC5160EmulatorTest, WriteHookMeasuresCommandLatency)
+{
+    struct Landing
+    {
+        TMC5160Emulator* chip;
+        std::chrono::nanoseconds vmax_at{-1};
+    } landing{&chip};
+
+    chip.set_write_hook(
+        [](void* context, uint8_t address, uint32_t) {
+            auto* self{static_cast<Landing*>(context)};
+            if (static_cast<uint8_t>(RegAddress::VMAX) == address)
+            {
+                self->vmax_at = self->chip->now();
+            }
+        },
+        &landing);
+    chip.set_datagram_time(5us);
+
+    ASSERT_TRUE(axis.rotate(60_rpm));
+
+    EXPECT_EQ(landing.vmax_at, 10us) << "RAMPMODE first, then VMAX";
+}
+
+TEST(TMC5160EmulatorHomingTest, StallStopsAndHomingZeroesAxis)
+{
+    TMC5160Emulator chip;
+    driver_t axis{chip, ramp_settings};
+    ASSERT_TRUE(axis.apply_settings());
+
+    features::SensorlessHoming homing{axis, {.velocity = -120_rpm, .home_position = 0}};
+    ASSERT_TRUE(homing.start());
+
+    bool homed{};
+    for (int tick{}; tick < 1000 && !homed; ++tick)
+    {
+        chip.advance(1ms);
+        if (chip.position() < -20'000.0)
+        {
+            chip.set_sg_result(0U);
+        }
+
+        const auto res{homing.poll()};
+        ASSERT_TRUE(res);
+        homed = *res;
+    }
+
+    ASSERT_TRUE(homed);
+    EXPECT_LT(homing.latched_position(), -20'000);
+    EXPECT_EQ(chip.peek(RegAddress::XACTUAL), 0U);
+
+    chip.advance(100ms);
+    EXPECT_EQ(chip.velocity(), 0.0) << "Zeroed axis stays put after the stop event is released";
+    EXPECT_EQ(chip.peek(RegAddress::XACTUAL), 0U);
+}
+
+TEST(TMC5160EmulatorSoakTest, HundredsOfAxesReachTheirTargets)
+{
+    constexpr std::size_t axis_count{200U};
+
+    std::vector<std::unique_ptr<TMC5160Emulator>> chips{};
+    std::vector<std::unique_ptr<driver_t>> axes{};
+
+    for (std::size_t idx{}; idx < axis_count; ++idx)
+    {
+        chips.push_back(std::make_unique<TMC5160Emulator>());
+        chips.back()->set_integration_step(100us);
+        axes.push_back(std::make_unique<driver_t>(*chips.back(), ramp_settings));
+        ASSERT_TRUE(axes.back()->apply_settings());
+
+        const int32_t target{static_cast<int32_t>((idx % 7U) * 5'000U) - 12'000};
+        start_move(*axes.back(), target);
+    }
+
+    std::size_t arrived{};
+    for (int tick{}; tick < 2000 && arrived < axis_count; ++tick)
+    {
+        arrived = 0U;
+        for (std::size_t idx{}; idx < axis_count; ++idx)
+        {
+            chips[idx]->advance(1ms);
+            const auto status{axes[idx]->poll_status()};
+            ASSERT_TRUE(status);
+            arrived += status->position_reached() && status->standstill();
+        }
+    }
+
+    EXPECT_EQ(arrived, axis_count);
+    for (std::size_t idx{}; idx < axis_count; ++idx)
+    {
+        const int32_t target{static_cast<int32_t>((idx % 7U) * 5'000U) - 12'000};
+        EXPECT_EQ(static_cast<int32_t>(chips[idx]->peek(RegAddress::XACTUAL)), target);
+        EXPECT_EQ(chips[idx]->framing_errors(), 0U);
+    }
+}
+
+} // namespace tmcxx::test
@@ -1,9 +1,12 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <chrono>
+#include <cstddef>
 #include <ranges>
 
 #include "mocks/mock_spi.hpp"
+#include "mocks/tmc5160_emulator.hpp"
 #include "tmcxx/tmc5160.hpp"
 
 namespace tmcxx::test {
@@ -107,4 +110,141 @@ TEST_F(TMC5160IntegrationTest, MoveToSequence)
     EXPECT_TRUE(xtarget_found) << "XTARGET write missing";
 }
 
+TEST_F(TMC5160IntegrationTest, ApplySettingsWritesEachRegisterOnce)
+{
+    TMC5160 driver{spi, settings};
+
+    ASSERT_TRUE(driver.apply_settings().has_value());
+
+    EXPECT_EQ(spi.find_writes_to(0x10).size(), 1U) << "IHOLD_IRUN must be coalesced";
+    EXPECT_EQ(spi.find_writes_to(0x6C).size(), 1U) << "CHOPCONF must be coalesced";
+    EXPECT_EQ(spi.get_transaction_count(), 14U);
+}
+
+/**
+ * @brief Emulator wrapper counting datagrams after which XACTUAL and XTARGET disagree.
+ */
+struct PositionProbe
+{
+    TMC5160Emulator& chip;
+    std::size_t mismatches{};
+
+    bool transfer(std::span<const uint8_t> tx_data, std::span<uint8_t> rx_data, uint32_t timeout_ms)
+    {
+        const bool res{chip.transfer(tx_data, rx_data, timeout_ms)};
+        mismatches += chip.peek(chip::tmc5160::RegAddress::XACTUAL) != chip.peek(chip::tmc5160::RegAddress::XTARGET);
+        return res;
+    }
+
+    void select() noexcept
+    {
+        chip.select();
+    }
+
+    void deselect() noexcept
+    {
+        chip.deselect();
+    }
+};
+
+TEST_F(TMC5160IntegrationTest, ApplySettingsZeroesTargetRightBeforePosition)
+{
+    using namespace std::chrono_literals;
+
+    const TMC5160<PositionProbe>::Settings motion_settings{
+        .run_current = 1.0_A,
+        .hold_current = 0.5_A,
+        .v_stop = 1_rpm,
+        .v_max = 300_rpm,
+        .a_max = 512000_pps2,
+        .d_max = 512000_pps2,
+    };
+
+    TMC5160Emulator chip;
+    PositionProbe probe{chip};
+    TMC5160 driver{probe, motion_settings};
+
+    ASSERT_TRUE(driver.apply_settings());
+    ASSERT_TRUE(driver.write_register<chip::tmc5160::XTARGET>(51'200U));
+    chip.advance(2s);
+    ASSERT_NE(chip.peek(chip::tmc5160::RegAddress::XTARGET), 0U);
+    ASSERT_EQ(chip.peek(chip::tmc5160::RegAddress::XACTUAL), chip.peek(chip::tmc5160::RegAddress::XTARGET));
+
+    probe.mismatches = 0U;
+    ASSERT_TRUE(driver.apply_settings()) << "Recipe change at a non-zero target";
+
+    EXPECT_EQ(probe.mismatches, 1U) << "Only between the XTARGET and XACTUAL datagrams";
+    EXPECT_EQ(chip.peek(chip::tmc5160::RegAddress::XACTUAL), 0U);
+    EXPECT_EQ(chip.peek(chip::tmc5160::RegAddress::XTARGET), 0U);
+}
+
+TEST_F(TMC5160IntegrationTest, ClearRampEventsTouchesOnlyTheGivenEvents)
+{
+    using chip::tmc5160::RAMP_STAT;
+
+    static_assert(!core::concepts::WritableRegister<RAMP_STAT>, "No shadow, no read-modify-write");
+
+    TMC5160 driver{spi, settings};
+    spi.set_register_value(RAMP_STAT::address, RAMP_STAT::event_stop_sg_t{1U}.value | 0x0200U);
+    ASSERT_TRUE(driver.read_registers<RAMP_STAT>());
+    spi.clear_transactions();
+
+    ASSERT_TRUE(driver.clear_ramp_events(RAMP_STAT::event_pos_reached_t{1U}.value | 0x0200U));
+
+    ASSERT_EQ(spi.get_transaction_count(), 1U);
+    EXPECT_EQ(spi.get_last_written_value(RAMP_STAT::address), RAMP_STAT::event_pos_reached_t{1U}.value)
+        << "Status bits dropped, the unread event_stop_sg left alone";
+}
+
+TEST_F(TMC5160IntegrationTest, ApplyDefaultConfigurationWritesRampModeLast)
+{
+    TMC5160 driver{spi, settings};
+
+    ASSERT_TRUE(driver.apply_default_configuration().has_value());
+
+    EXPECT_EQ(spi.find_writes_to(0x10).size(), 1U);
+    EXPECT_EQ(spi.find_writes_to(0x6C).size(), 1U);
+    EXPECT_EQ(spi.get_last_transaction().get_address(), 0x20);
+}
+
+TEST_F(TMC5160IntegrationTest, UserTransactionCoalescesCurrentWrites)
+{
+    TMC5160 driver{spi, settings};
+
+    driver.begin_transaction();
+    EXPECT_TRUE(driver.set_irun(1.0_A));
+    EXPECT_TRUE(driver.set_ihold(0.5_A));
+    EXPECT_EQ(spi.get_transaction_count(), 0U);
+
+    EXPECT_TRUE(driver.commit());
+    EXPECT_EQ(spi.find_writes_to(0x10).size(), 1U);
+}
+
+TEST_F(TMC5160IntegrationTest, FixedPointConverterDrivesMotion)
+{
+    TMC5160<MockSpi, features::FixedPointConverter> driver{spi, settings};
+    const features::Converter reference{settings.f_clk_hz, settings.full_steps, settings.r_sense};
+
+    ASSERT_TRUE(driver.rotate(60.0_rpm));
+
+    const auto vmax{spi.get_last_written_value(0x27)};
+    ASSERT_TRUE(vmax.has_value());
+    EXPECT_NEAR(static_cast<double>(*vmax), static_cast<double>(reference.rpm_to_vmax(60.0_rpm)), 1.0);
+}
+
+TEST_F(TMC5160IntegrationTest, RestoreFromShadowReplaysConfigurationOnly)
+{
+    TMC5160 driver{spi, settings};
+    ASSERT_TRUE(driver.apply_settings());
+    ASSERT_TRUE(driver.move_to(1000_steps, 60.0_rpm));
+    spi.clear_transactions();
+
+    ASSERT_TRUE(driver.restore_from_shadow());
+
+    EXPECT_EQ(spi.get_transaction_count(), 12U) << "apply_settings() minus XTARGET and XACTUAL";
+    EXPECT_TRUE(spi.find_writes_to(0x2D).empty()) << "XTARGET must not be replayed";
+    EXPECT_TRUE(spi.find_writes_to(0x21).empty()) << "XACTUAL must not be replayed";
+    EXPECT_EQ(spi.find_writes_to(0x10).size(), 1U);
+}
+
 } // namespace tmcxx::test
@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+
+#include <type_traits>
+#include <vector>
+
+#include "mocks/mock_spi.hpp"
+
+#include "tmcxx/chips/tmc5160_registers.hpp"
+#include "tmcxx/features/core_communicator.hpp"
+#include "tmcxx/features/transfer_instrument.hpp"
+#include "tmcxx/tmc5160.hpp"
+
+namespace tmcxx::features::test {
+
+using namespace chip::tmc5160;
+
+static_assert(std::is_empty_v<NoInstrumentation>);
+
+static_assert(TransferStats::bucket(0U) == 0U);
+static_assert(TransferStats::bucket(1U) == 1U);
+static_assert(TransferStats::bucket(3U) == 2U);
+static_assert(TransferStats::bucket(4U) == 3U);
+static_assert(TransferStats::bucket(0xFFFFFFFFU) == TransferStats::histogram_buckets - 1U);
+
+namespace {
+
+uint32_t fake_ticks{};
+
+/**
+ * @brief Clock advancing 3 ticks per sample, so each transfer measures 3 ticks.
+ */
+uint32_t fake_clock() noexcept
+{
+    fake_ticks += 3U;
+    return fake_ticks;
+}
+
+struct Trace
+{
+    std::vector<std::size_t> datagrams{};
+    std::vector<bool> success{};
+};
+
+void record_trace(void* context, const TransferEvent& event)
+{
+    auto* trace{static_cast<Trace*>(context)};
+    trace->datagrams.push_back(event.datagrams());
+    trace->success.push_back(event.success);
+}
+
+} // namespace
+
+class TransferStatsTest : public ::testing::Test {
+  protected:
+    ::tmcxx::test::MockSpi spi;
+    CoreCommunicator<::tmcxx::test::MockSpi, TransferStats> comm{spi};
+};
+
+TEST_F(TransferStatsTest, CountsWritesPerRegister)
+{
+    ASSERT_TRUE(comm.write<XTARGET>(100U));
+    ASSERT_TRUE(comm.write<XTARGET>(200U));
+    ASSERT_TRUE(comm.write<VMAX>(300U));
+
+    const auto& stats{comm.instrument()};
+    EXPECT_EQ(stats.writes(RegAddress::XTARGET), 2U);
+    EXPECT_EQ(stats.writes(RegAddress::VMAX), 1U);
+    EXPECT_EQ(stats.reads(RegAddress::XTARGET), 0U);
+    EXPECT_EQ(stats.transfers(), 3U);
+    EXPECT_EQ(stats.bytes(), 15U);
+    EXPECT_EQ(stats.failed_transfers(), 0U);
+}
+
+TEST_F(TransferStatsTest, ReadCountsRequestAndDummyDatagram)
+{
+    ASSERT_TRUE(comm.read<XACTUAL>());
+
+    const auto& stats{comm.instrument()};
+    EXPECT_EQ(stats.reads(RegAddress::XACTUAL), 1U);
+    EXPECT_EQ(stats.counters(0x00U).reads, 1U) << "Dummy request fetching the reply";
+    EXPECT_EQ(stats.transfers(), 2U);
+}
+
+TEST_F(TransferStatsTest, RecordsFailures)
+{
+    spi.set_next_transfer_failure(true);
+
+    EXPECT_FALSE(comm.write<XTARGET>(1U));
+
+    const auto& stats{comm.instrument()};
+    EXPECT_EQ(stats.failed_transfers(), 1U);
+    EXPECT_EQ(stats.counters(static_cast<uint8_t>(RegAddress::XTARGET)).failures, 1U);
+}
+
+TEST_F(TransferStatsTest, LatencyHistogramUsesClock)
+{
+    comm.instrument().set_clock(&fake_clock);
+
+    ASSERT_TRUE(comm.write<XTARGET>(1U));
+    ASSERT_TRUE(comm.write<VMAX>(1U));
+
+    EXPECT_EQ(comm.instrument().latency_histogram()[TransferStats::bucket(3U)], 2U);
+    EXPECT_EQ(comm.instrument().latency_histogram()[0], 0U);
+}
+
+TEST_F(TransferStatsTest, WithoutClockLatencyIsZero)
+{
+    ASSERT_TRUE(comm.write<XTARGET>(1U));
+
+    EXPECT_EQ(comm.instrument().latency_histogram()[0], 1U);
+}
+
+TEST_F(TransferStatsTest, TraceHookSeesEveryTransfer)
+{
+    Trace trace{};
+    comm.instrument().set_trace_hook(&record_trace, &trace);
+
+    ASSERT_TRUE(comm.write<XTARGET>(1U));
+    spi.set_next_transfer_failure(true);
+    EXPECT_FALSE(comm.write<VMAX>(1U));
+
+    EXPECT_EQ(trace.datagrams, (std::vector<std::size_t>{1U, 1U}));
+    EXPECT_EQ(trace.success, (std::vector<bool>{true, false}));
+}
+
+TEST_F(TransferStatsTest, ResetClearsCounters)
+{
+    ASSERT_TRUE(comm.write<XTARGET>(1U));
+
+    comm.instrument().reset();
+
+    EXPECT_EQ(comm.instrument().transfers(), 0U);
+    EXPECT_EQ(comm.instrument().bytes(), 0U);
+    EXPECT_EQ(comm.instrument().writes(RegAddress::XTARGET), 0U);
+}
+
+TEST(TransferStatsBatchTest, BatchCountsOnceWithEveryDatagram)
+{
+    ::tmcxx::test::MockBatchSpi spi;
+    CoreCommunicator<::tmcxx::test::MockBatchSpi, TransferStats> comm{spi};
+
+    Trace trace{};
+    comm.instrument().set_trace_hook(&record_trace, &trace);
+
+    ASSERT_TRUE((comm.read_many<XACTUAL, VACTUAL, DRV_STATUS>()));
+
+    EXPECT_EQ(comm.instrument().transfers(), 1U);
+    EXPECT_EQ(comm.instrument().bytes(), 20U);
+    EXPECT_EQ(comm.instrument().reads(RegAddress::VACTUAL), 1U);
+    EXPECT_EQ(trace.datagrams, (std::vector<std::size_t>{4U}));
+}
+
+TEST(TransferStatsAsyncTest, AsyncDatagramsAreRecordedOnCompletion)
+{
+    ::tmcxx::test::MockAsyncSpi spi;
+    CoreCommunicator<::tmcxx::test::MockAsyncSpi, TransferStats> comm{spi};
+
+    ASSERT_TRUE(comm.submit_write<XTARGET>(5U, [](void*, helpers::result_t<uint32_t>) {}, nullptr));
+    EXPECT_EQ(comm.instrument().transfers(), 0U);
+
+    spi.complete_pending();
+
+    EXPECT_EQ(comm.instrument().transfers(), 1U);
+    EXPECT_EQ(comm.instrument().writes(RegAddress::XTARGET), 1U);
+}
+
+TEST(TransferStatsDriverTest, ApplyConfigurationWritesEachRegisterOnce)
+{
+    ::tmcxx::test::MockSpi spi;
+    TMC5160<::tmcxx::test::MockSpi, Converter, TransferStats> motor{spi, {}};
+
+    ASSERT_TRUE(motor.apply_default_configuration());
+
+    EXPECT_EQ(motor.instrument().writes(RegAddress::CHOPCONF), 1U);
+    EXPECT_EQ(motor.instrument().writes(RegAddress::IHOLD_IRUN), 1U);
+    EXPECT_EQ(motor.instrument().transfers(), spi.get_transaction_count());
+}
+
+} // namespace tmcxx::features::test